@@ -783,16 +783,8 @@ namespace Euler_DG
                 // Interpolate the values from the cell quadrature points to the
                 // quadrature points of the current face via a simple 1d
                 // interpolation:
-                internal::FEFaceNormalEvaluationImpl<dim,
-                                                     n_points_1d - 1,
-                                                     VectorizedArrayType>::
-                  template interpolate_quadrature<true, false>(
-                    dim + 2,
-                    EvaluationFlags::values,
-                    data.get_shape_info(),
-                    buffer.data(),
-                    phi_m.begin_values(),
-                    face);
+                phi_m.evaluate_from_cell_quadrature(buffer.data(),
+                                                    EvaluationFlags::values);
 
                 // Check if the face is an internal or a boundary face and
                 // select a different code path based on this information:
@@ -887,16 +879,8 @@ namespace Euler_DG
 
                 // Evaluate local integrals related to cell by quadrature and
                 // add into cell contribution via a simple 1d interpolation:
-                internal::FEFaceNormalEvaluationImpl<dim,
-                                                     n_points_1d - 1,
-                                                     VectorizedArrayType>::
-                  template interpolate_quadrature<false, true>(
-                    dim + 2,
-                    EvaluationFlags::values,
-                    data.get_shape_info(),
-                    phi_m.begin_values(),
-                    phi.begin_values(),
-                    face);
+                phi_m.integrate_into_cell_quadrature(EvaluationFlags::values,
+                                                     phi.begin_values());
               }
 
             // Apply inverse mass matrix in the cell quadrature points. See
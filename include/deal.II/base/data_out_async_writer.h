@@ -0,0 +1,183 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_data_out_async_writer_h
+#define dealii_data_out_async_writer_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/data_out_base.h>
+#include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/thread_management.h>
+
+#include <list>
+#include <string>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A class that writes the output of DataOut and the other classes derived
+ * from DataOutInterface on a background task, so that a simulation can
+ * continue with its next time steps while the output of a previous one is
+ * still being compressed and written to disk.
+ *
+ * The output functions of this class take a snapshot of the patches, the
+ * names of the data sets, and the output flags of the given object, and
+ * return as soon as the snapshot is taken. The object passed in can then be
+ * modified, reused for the next call to DataOut::build_patches(), or
+ * destroyed. The actual output is generated from the snapshot on a task
+ * created by Threads::new_task(), using the same functions as the ones of
+ * DataOutInterface.
+ *
+ * A typical use in a time stepping loop looks as follows:
+ * @code
+ *   DataOutAsyncWriter<dim> writer;
+ *
+ *   for (unsigned int step = 0; step < n_steps; ++step)
+ *     {
+ *       ... // solve for the next time step
+ *
+ *       if (step % 10 == 0)
+ *         {
+ *           DataOut<dim> data_out;
+ *           data_out.attach_dof_handler(dof_handler);
+ *           data_out.add_data_vector(solution, "solution");
+ *           data_out.build_patches();
+ *           writer.write_vtu_with_pvtu_record(
+ *             data_out, "./", "solution", step, mpi_communicator);
+ *         }
+ *     }
+ *
+ *   writer.wait();
+ * @endcode
+ *
+ * Each snapshot holds a copy of the patches, so the memory of the
+ * outputs that are still being written adds to the memory of the
+ * simulation. The number of outputs in flight is therefore bounded by the
+ * argument given to the constructor: when a new output is requested while
+ * this many outputs are still being written, the function waits until the
+ * oldest one has finished.
+ *
+ * Exceptions thrown while writing, e.g. because a file could not be opened,
+ * are re-thrown by the call that waits for the respective output, i.e.,
+ * either a later output function that needs to wait for room in the queue,
+ * or wait(). The destructor waits for all outputs in flight, but ignores
+ * their exceptions, so wait() should be called explicitly at the end of a
+ * simulation.
+ *
+ * @note If MultithreadInfo::n_threads() is one, Threads::new_task() runs the
+ * output immediately, and the output functions of this class only return
+ * once the output has been written.
+ *
+ * @ingroup output
+ */
+template <int dim, int spacedim = dim>
+class DataOutAsyncWriter
+{
+public:
+  /**
+   * Constructor. The argument denotes the maximal number of outputs that
+   * are written in the background at the same time.
+   */
+  explicit DataOutAsyncWriter(const unsigned int max_outputs_in_flight = 2);
+
+  /**
+   * Destructor. Waits for all outputs in flight to finish.
+   */
+  ~DataOutAsyncWriter() = default;
+
+  /**
+   * Take a snapshot of the output of @p data_out and write it to the file
+   * @p filename in the background, in the same way as
+   * DataOutInterface::write_vtu().
+   */
+  void
+  write_vtu(const DataOutInterface<dim, spacedim> &data_out,
+            const std::string                     &filename);
+
+  /**
+   * Take a snapshot of the output of @p data_out and write it in the
+   * background, in the same way as
+   * DataOutInterface::write_vtu_with_pvtu_record() with the same arguments.
+   * The name of the pvtu file is determined right away and returned.
+   *
+   * If every process writes its own file, i.e., if @p n_groups is zero or
+   * larger than the number of processes, the background task does not
+   * communicate. Otherwise, the files are written with MPI I/O, which may
+   * only happen on the background task if MPI was initialized with support
+   * for <code>MPI_THREAD_MULTIPLE</code>; the background task then works on
+   * a duplicate of @p mpi_communicator. If MPI does not provide this level of
+   * thread support, which is the case with the default initialization by
+   * Utilities::MPI::MPI_InitFinalize, this function waits for all outputs in
+   * flight and then writes the files right away.
+   */
+  std::string
+  write_vtu_with_pvtu_record(
+    const DataOutInterface<dim, spacedim> &data_out,
+    const std::string                     &directory,
+    const std::string                     &filename_without_extension,
+    const unsigned int                     counter,
+    const MPI_Comm                         mpi_communicator,
+    const unsigned int                     n_digits_for_counter = 4,
+    const unsigned int                     n_groups             = 0);
+
+  /**
+   * Wait until all outputs in flight have been written. If one of them
+   * threw an exception, the exception is re-thrown here.
+   */
+  void
+  wait();
+
+  /**
+   * Return the number of outputs that have been requested but whose
+   * background task has not been waited for yet. Some of them may already
+   * have finished.
+   */
+  unsigned int
+  n_outputs_in_flight() const;
+
+private:
+  /**
+   * The maximal number of outputs in flight.
+   */
+  const unsigned int max_outputs_in_flight;
+
+  /**
+   * The tasks that write the outputs in flight, in the order in which the
+   * outputs were requested.
+   */
+  std::list<Threads::Task<>> outputs_in_flight;
+
+  /**
+   * Wait for the oldest outputs in flight until there is room for another
+   * one, then start @p write on a background task.
+   */
+  void
+  enqueue(const std::function<void()> &write);
+};
+
+
+
+/* ---------------------------- inline functions --------------------------- */
+
+template <int dim, int spacedim>
+inline unsigned int
+DataOutAsyncWriter<dim, spacedim>::n_outputs_in_flight() const
+{
+  return outputs_in_flight.size();
+}
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -43,6 +43,8 @@ DEAL_II_NAMESPACE_OPEN
 #ifndef DOXYGEN
 class ParameterHandler;
 class XDMFEntry;
+template <int, int>
+class DataOutAsyncWriter;
 #endif
 
 /**
@@ -1205,6 +1207,32 @@ namespace DataOutBase
      */
     std::map<std::string, std::string> physical_units;
 
+    /**
+     * Flag determining whether the data arrays of VTU files are written in
+     * the "appended raw" encoding of the VTK XML format, rather than inline
+     * within the XML elements. In this encoding, the XML part of the file
+     * only records the offset of each array, and the binary data of all
+     * arrays follows in a single section at the end of the file. This avoids
+     * the base64 encoding of binary data, which increases the size of the
+     * file by a third and takes a significant part of the time for writing
+     * large files.
+     *
+     * If zlib is available and the #compression_level is not
+     * CompressionLevel::plain_text, each array is compressed in blocks of a
+     * fixed size, so that the temporary memory for compression does not grow
+     * with the size of the array. Otherwise, the arrays are written
+     * uncompressed. In either case, the sizes in the file are 64-bit
+     * integers, so arrays larger than 4 GB can be written.
+     *
+     * DataOutInterface::write_vtu_in_parallel() writes the binary arrays of
+     * each process directly to their final position in the file, so the
+     * XML text and the data only need to be collected on the process that
+     * owns them.
+     *
+     * Default is <tt>false</tt>. This flag is ignored for VTK files.
+     */
+    bool write_appended_raw_data;
+
     /**
      * Constructor. Initializes the member variables with names corresponding
      * to the argument names of this function.
@@ -1215,7 +1243,8 @@ namespace DataOutBase
       const bool             print_date_and_time = true,
       const CompressionLevel compression_level   = CompressionLevel::best_speed,
       const bool             write_higher_order_cells          = false,
-      const std::map<std::string, std::string> &physical_units = {});
+      const std::map<std::string, std::string> &physical_units = {},
+      const bool                                write_appended_raw_data = false);
   };
 
 
@@ -3175,6 +3204,13 @@ private:
    * dimension. Can be changed by using the <tt>set_flags</tt> function.
    */
   DataOutBase::Deal_II_IntermediateFlags deal_II_intermediate_flags;
+
+  /**
+   * DataOutAsyncWriter takes a copy of the patches of an object of this
+   * class to write them in the background.
+   */
+  template <int, int>
+  friend class DataOutAsyncWriter;
 };
 
 
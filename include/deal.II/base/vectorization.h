@@ -1735,9 +1735,8 @@ public:
   void
   load(const float *ptr)
   {
-    DEAL_II_OPENMP_SIMD_PRAGMA
-    for (unsigned int i = 0; i < 2; ++i)
-      data[i] = ptr[i];
+    data = _mm_cvtps_pd(_mm_castsi128_ps(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr))));
   }
 
   /**
@@ -1757,9 +1756,8 @@ public:
   void
   store(float *ptr) const
   {
-    DEAL_II_OPENMP_SIMD_PRAGMA
-    for (unsigned int i = 0; i < 2; ++i)
-      ptr[i] = data[i];
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(ptr),
+                     _mm_castps_si128(_mm_cvtpd_ps(data)));
   }
 
   /**
@@ -6399,6 +6397,199 @@ compare_and_apply_mask(const VectorizedArray<double, 2> &left,
 #endif // DOXYGEN
 
 
+
+/**
+ * @name Transposes between VectorizedArray and data of a different precision
+ * @{
+ */
+
+/**
+ * Same as vectorized_load_and_transpose() for data stored in a number type
+ * @p OtherNumber different from the one of the VectorizedArray, e.g., data
+ * stored in single precision that is read into VectorizedArray<double> for
+ * computations in double precision. The function converts chunks of size()
+ * entries of each lane with VectorizedArray::load(), which uses the
+ * conversion instructions of the processor for supported types, and then
+ * transposes them with the optimized implementation for the number type of
+ * the VectorizedArray.
+ *
+ * @relatesalso VectorizedArray
+ */
+template <typename Number, typename OtherNumber, std::size_t width>
+inline DEAL_II_ALWAYS_INLINE void
+vectorized_load_and_transpose(const unsigned int              n_entries,
+                              const OtherNumber              *in,
+                              const unsigned int             *offsets,
+                              VectorizedArray<Number, width> *out)
+{
+  std::array<unsigned int, width> chunk_offsets;
+  for (unsigned int v = 0; v < width; ++v)
+    chunk_offsets[v] = v * width;
+
+  const unsigned int n_chunks = n_entries / width;
+  for (unsigned int i = 0; i < n_chunks; ++i)
+    {
+      Number chunk[width * width];
+      for (unsigned int v = 0; v < width; ++v)
+        {
+          VectorizedArray<Number, width> tmp;
+          tmp.load(in + offsets[v] + i * width);
+          tmp.store(chunk + v * width);
+        }
+      vectorized_load_and_transpose(width,
+                                    chunk,
+                                    chunk_offsets.data(),
+                                    out + i * width);
+    }
+
+  // remainder loop of work that does not divide by the width
+  for (unsigned int i = n_chunks * width; i < n_entries; ++i)
+    for (unsigned int v = 0; v < width; ++v)
+      out[i][v] = in[offsets[v] + i];
+}
+
+
+
+/**
+ * Same as above, but with an array of pointers passed as input argument
+ * @p in.
+ *
+ * @relatesalso VectorizedArray
+ */
+template <typename Number, typename OtherNumber, std::size_t width>
+inline DEAL_II_ALWAYS_INLINE void
+vectorized_load_and_transpose(const unsigned int                      n_entries,
+                              const std::array<OtherNumber *, width> &in,
+                              VectorizedArray<Number, width>         *out)
+{
+  std::array<unsigned int, width> chunk_offsets;
+  for (unsigned int v = 0; v < width; ++v)
+    chunk_offsets[v] = v * width;
+
+  const unsigned int n_chunks = n_entries / width;
+  for (unsigned int i = 0; i < n_chunks; ++i)
+    {
+      Number chunk[width * width];
+      for (unsigned int v = 0; v < width; ++v)
+        {
+          VectorizedArray<Number, width> tmp;
+          tmp.load(in[v] + i * width);
+          tmp.store(chunk + v * width);
+        }
+      vectorized_load_and_transpose(width,
+                                    chunk,
+                                    chunk_offsets.data(),
+                                    out + i * width);
+    }
+
+  for (unsigned int i = n_chunks * width; i < n_entries; ++i)
+    for (unsigned int v = 0; v < width; ++v)
+      out[i][v] = in[v][i];
+}
+
+
+
+/**
+ * Same as vectorized_transpose_and_store() for an output array of a number
+ * type @p OtherNumber different from the one of the VectorizedArray, e.g.,
+ * for writing results computed in VectorizedArray<double> into data stored
+ * in single precision. The function transposes chunks of size() entries with
+ * the optimized implementation for the number type of the VectorizedArray
+ * and converts them with VectorizedArray::store().
+ *
+ * @relatesalso VectorizedArray
+ */
+template <typename Number, typename OtherNumber, std::size_t width>
+inline DEAL_II_ALWAYS_INLINE void
+vectorized_transpose_and_store(const bool                            add_into,
+                               const unsigned int                    n_entries,
+                               const VectorizedArray<Number, width> *in,
+                               const unsigned int                   *offsets,
+                               OtherNumber                          *out)
+{
+  std::array<unsigned int, width> chunk_offsets;
+  for (unsigned int v = 0; v < width; ++v)
+    chunk_offsets[v] = v * width;
+
+  const unsigned int n_chunks = n_entries / width;
+  for (unsigned int i = 0; i < n_chunks; ++i)
+    {
+      Number chunk[width * width];
+      vectorized_transpose_and_store(
+        false, width, in + i * width, chunk_offsets.data(), chunk);
+      for (unsigned int v = 0; v < width; ++v)
+        {
+          VectorizedArray<Number, width> tmp;
+          tmp.load(chunk + v * width);
+          if (add_into)
+            {
+              VectorizedArray<Number, width> old_value;
+              old_value.load(out + offsets[v] + i * width);
+              tmp += old_value;
+            }
+          tmp.store(out + offsets[v] + i * width);
+        }
+    }
+
+  // remainder loop of work that does not divide by the width
+  for (unsigned int i = n_chunks * width; i < n_entries; ++i)
+    for (unsigned int v = 0; v < width; ++v)
+      if (add_into)
+        out[offsets[v] + i] += in[i][v];
+      else
+        out[offsets[v] + i] = in[i][v];
+}
+
+
+
+/**
+ * Same as above, but with an array of pointers passed as output argument
+ * @p out.
+ *
+ * @relatesalso VectorizedArray
+ */
+template <typename Number, typename OtherNumber, std::size_t width>
+inline DEAL_II_ALWAYS_INLINE void
+vectorized_transpose_and_store(const bool                            add_into,
+                               const unsigned int                    n_entries,
+                               const VectorizedArray<Number, width> *in,
+                               std::array<OtherNumber *, width>     &out)
+{
+  std::array<unsigned int, width> chunk_offsets;
+  for (unsigned int v = 0; v < width; ++v)
+    chunk_offsets[v] = v * width;
+
+  const unsigned int n_chunks = n_entries / width;
+  for (unsigned int i = 0; i < n_chunks; ++i)
+    {
+      Number chunk[width * width];
+      vectorized_transpose_and_store(
+        false, width, in + i * width, chunk_offsets.data(), chunk);
+      for (unsigned int v = 0; v < width; ++v)
+        {
+          VectorizedArray<Number, width> tmp;
+          tmp.load(chunk + v * width);
+          if (add_into)
+            {
+              VectorizedArray<Number, width> old_value;
+              old_value.load(out[v] + i * width);
+              tmp += old_value;
+            }
+          tmp.store(out[v] + i * width);
+        }
+    }
+
+  for (unsigned int i = n_chunks * width; i < n_entries; ++i)
+    for (unsigned int v = 0; v < width; ++v)
+      if (add_into)
+        out[v][i] += in[i][v];
+      else
+        out[v][i] = in[i][v];
+}
+
+/** @} */
+
+
 namespace internal
 {
   template <typename T>
@@ -148,6 +148,26 @@ class MatrixFree;
  * algorithms), searching a best starting point may be difficult, however, and
  * in many cases will not justify the effort.
  *
+ * For large meshes, the search for the next level of degrees of freedom
+ * runs in parallel, without changing the result.
+ *
+ *
+ * <h3>Nested dissection</h3>
+ *
+ * The nested_dissection() function splits the graph of couplings between
+ * degrees of freedom recursively into two parts and a separator that
+ * connects them, numbering the parts first and the separator last. The
+ * recursion stops at blocks of a given size, which are numbered
+ * consecutively. Unlike the Cuthill-McKee algorithm, this does not minimize
+ * the bandwidth of the matrix, but it groups the degrees of freedom into
+ * blocks that couple mostly with themselves. If the blocks are chosen small
+ * enough for their part of the matrix and vectors to fit into the cache,
+ * matrix-vector products, SparseILU, and relaxation methods such as
+ * PreconditionSOR benefit from better data locality. The
+ * SparsityTools::compute_profile() function and
+ * DynamicSparsityPattern::bandwidth() can be used to compare the
+ * numberings.
+ *
  *
  * <h3>Component-wise and block-wise numberings</h3>
  *
@@ -638,6 +658,48 @@ namespace DoFRenumbering
                 const std::vector<types::global_dof_index> &starting_indices =
                   std::vector<types::global_dof_index>());
 
+  /**
+   * Renumber the degrees of freedom by nested dissection of the graph of
+   * couplings between them, see SparsityTools::reorder_nested_dissection()
+   * for the algorithm. The degrees of freedom are split into blocks of at
+   * most @p max_block_size indices that are numbered consecutively, with
+   * the separators between the blocks numbered after them. This makes
+   * operations on matrices with this numbering cache friendly, and the
+   * recursive splitting works on independent parts in parallel.
+   *
+   * See the general documentation of this namespace for a comparison with
+   * the other methods.
+   *
+   * @param dof_handler The DoFHandler object to work on.
+   * @param max_block_size The maximal number of degrees of freedom of a
+   *   block that is not split any further.
+   * @param use_constraints Whether or not to use hanging node constraints in
+   *   determining the reordering of degrees of freedom.
+   *
+   * If the DoFHandler is built on a parallel triangulation, each process
+   * renumbers its locally owned degrees of freedom, ignoring the couplings
+   * to degrees of freedom owned by other processes, in the same way as
+   * Cuthill_McKee() does.
+   */
+  template <int dim, int spacedim>
+  void
+  nested_dissection(DoFHandler<dim, spacedim> &dof_handler,
+                    const unsigned int         max_block_size  = 1024,
+                    const bool                 use_constraints = false);
+
+  /**
+   * Compute the renumbering vector needed by the nested_dissection()
+   * function. This function does not perform the renumbering on the
+   * DoFHandler DoFs but only returns the renumbering vector.
+   */
+  template <int dim, int spacedim>
+  void
+  compute_nested_dissection(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim> &,
+    const unsigned int max_block_size  = 1024,
+    const bool         use_constraints = false);
+
   /**
    * @name Component-wise numberings
    * @{
@@ -57,6 +57,7 @@ DEAL_II_CXX20_REQUIRES(concepts::is_triangulation_or_dof_handler<MeshType>)
 class InterGridMap;
 template <int dim, int spacedim>
 class Mapping;
+class SparsityPattern;
 template <int dim, class T>
 class Table;
 template <typename Number>
@@ -429,6 +430,43 @@ namespace DoFTools
     const bool                       keep_constrained_dofs = true,
     const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id);
 
+  /**
+   * Compute the same sparsity pattern as the previous function, but build it
+   * with several threads and store it directly in the compressed format of
+   * @p sparsity_pattern. Previous content of @p sparsity_pattern is lost;
+   * the object is resized to the number of degrees of freedom and is
+   * compressed afterwards, so there is no need to go through a
+   * DynamicSparsityPattern and call SparsityPattern::copy_from().
+   *
+   * The rows of the pattern are split into contiguous ranges, a few per
+   * thread as given by MultithreadInfo::n_threads(). In a first parallel
+   * step, the cells are sorted into lists according to the row ranges their
+   * degrees of freedom and those of the constraints they are subject to
+   * fall into. In a second step, one task per row range runs
+   * AffineConstraints::add_entries_local_to_global() on the cells in its
+   * list and keeps the entries in its rows as a sorted list of (row,
+   * column) pairs. Since every task owns its rows, no locking is needed.
+   * The lists are finally merged into @p sparsity_pattern in parallel.
+   *
+   * Cells whose degrees of freedom fall into several row ranges are
+   * processed by each of the respective tasks. The function therefore
+   * scales best for numberings in which the degrees of freedom of a cell
+   * are close to each other, as is the case for the numbering generated by
+   * DoFHandler::distribute_dofs() or DoFRenumbering::Cuthill_McKee().
+   *
+   * See the previous function for a description of the other arguments.
+   *
+   * @ingroup constraints
+   */
+  template <int dim, int spacedim, typename number = double>
+  void
+  make_compressed_sparsity_pattern(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    SparsityPattern                 &sparsity_pattern,
+    const AffineConstraints<number> &constraints           = {},
+    const bool                       keep_constrained_dofs = true,
+    const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id);
+
   /**
    * Compute which entries of a matrix built on the given @p dof_handler may
    * possibly be nonzero, and create a sparsity pattern object that represents
@@ -491,10 +491,20 @@ public:
    * Of course, deal.II today also supports triangular, tetrahedral, and mixed
    * meshes including wedges and pyramids.
    *
-   * %Gmsh has several versions of the file format. The reader supports versions
-   * 1.0 and 2.0. If you want to use a specific version, you can instruct %Gmsh
+   * %Gmsh has several versions of the file format. The reader supports the
+   * ASCII variants of versions 1.0 up to 4.1 as well as the binary variant of
+   * version 4.1. If you want to use a specific version, you can instruct %Gmsh
    * to output the file in that version by adding a line such as
-   * "Mesh.MshFileVersion = 1" to the gmsh input file.
+   * "Mesh.MshFileVersion = 4.1" to the gmsh input file, and the binary
+   * format with "Mesh.Binary = 1".
+   *
+   * For large meshes, the binary format is considerably faster to read: the
+   * file is read into memory in large chunks and the nodes and elements are
+   * converted from the raw data on all available threads, whereas the ASCII
+   * formats have to be parsed sequentially. When such a mesh is to be used
+   * for a parallel::fullydistributed::Triangulation, it suffices that only
+   * the root process of each group reads the file, see
+   * TriangulationDescription::Utilities::create_description_from_triangulation_in_groups().
    *
    * Also see
    * @ref simplex "Simplex support".
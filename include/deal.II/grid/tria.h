@@ -3572,6 +3572,16 @@ public:
   virtual std::size_t
   memory_consumption() const;
 
+  /**
+   * Print a breakdown of the memory consumption of this object to @p out.
+   * The breakdown lists the vertices, the different fields stored for the
+   * cells summed over all levels, and the faces, as well as the total
+   * returned by memory_consumption(). This is useful to find out which data
+   * dominates the memory footprint of large meshes.
+   */
+  void
+  print_memory_consumption(std::ostream &out) const;
+
   /**
    * Write the data of this object to a stream for the purpose of
    * serialization using the [BOOST serialization
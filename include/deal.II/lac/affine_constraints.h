@@ -990,6 +990,11 @@ public:
    * cycles in this graph of constraints are not allowed, i.e., for example
    * $u_4$ may not itself be constrained, directly or indirectly, to $u_{13}$
    * again.
+   *
+   * The sorting, the resolution of chains, and the work on the individual
+   * lines are done in parallel using the number of threads given by
+   * MultithreadInfo::n_threads(). The result does not depend on the number
+   * of threads.
    */
   void
   close();
@@ -1870,6 +1875,10 @@ public:
    * the current object stores the constraint $x_{42}=208$, then this
    * function will set the 42nd element of the given vector to 208.
    *
+   * For serial vectors and for LinearAlgebra::distributed::Vector, the
+   * constrained entries are computed in parallel using the number of threads
+   * given by MultithreadInfo::n_threads().
+   *
    * @note If this function is called with a parallel vector @p vec, then the
    * vector must not contain ghost elements.
    */
@@ -18,6 +18,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parallel.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/thread_local_storage.h>
@@ -36,6 +37,7 @@
 #include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/matrix_block.h>
+#include <deal.II/lac/node_block_sparse_matrix.h>
 #include <deal.II/lac/petsc_block_sparse_matrix.h>
 #include <deal.II/lac/petsc_block_vector.h>
 #include <deal.II/lac/petsc_sparse_matrix.h>
@@ -301,6 +303,34 @@ AffineConstraints<number>::is_consistent_in_parallel(
 
 namespace internal
 {
+  // A helper function that sorts the range [begin,end) by a merge sort in
+  // which the two halves are sorted in separate tasks, down to ranges of
+  // the given grain size that are sorted by std::sort:
+  template <typename Iterator, typename Comparator>
+  void
+  parallel_sort(const Iterator    begin,
+                const Iterator    end,
+                const Comparator &comparator,
+                const std::size_t grain_size)
+  {
+    if (static_cast<std::size_t>(end - begin) <= grain_size ||
+        MultithreadInfo::n_threads() == 1)
+      {
+        std::sort(begin, end, comparator);
+        return;
+      }
+
+    const Iterator  middle     = begin + (end - begin) / 2;
+    Threads::Task<> lower_half = Threads::new_task(
+      [&]() { parallel_sort(begin, middle, comparator, grain_size); });
+    parallel_sort(middle, end, comparator, grain_size);
+    lower_half.join();
+
+    std::inplace_merge(begin, middle, end, comparator);
+  }
+
+
+
   // A helper function that sorts and normalizes the constraints
   // provided through the function's argument:
   template <typename number>
@@ -743,24 +773,33 @@ AffineConstraints<number>::close()
   if (sorted == true)
     return;
 
-  // sort the lines
-  std::sort(lines.begin(),
-            lines.end(),
-            [](const ConstraintLine &l1, const ConstraintLine &l2) {
-              return l1.index < l2.index;
-            });
+  // sort the lines. for many constraints, this is done by a parallel merge
+  // sort; the line indices are unique, so the result does not depend on the
+  // number of threads
+  const auto compare_lines = [](const ConstraintLine &l1,
+                                const ConstraintLine &l2) {
+    return l1.index < l2.index;
+  };
+  if (!std::is_sorted(lines.begin(), lines.end(), compare_lines))
+    internal::parallel_sort(lines.begin(),
+                            lines.end(),
+                            compare_lines,
+                            /* grain_size = */ 10000);
 
   // update list of pointers and give the vector a sharp size since we
-  // won't modify the size any more after this point.
+  // won't modify the size any more after this point. every line writes to
+  // its own slot, so this can be done in parallel.
   {
     std::vector<size_type> new_lines(lines_cache.size(),
                                      numbers::invalid_size_type);
-    size_type              counter = 0;
-    for (const ConstraintLine &line : lines)
-      {
-        new_lines[calculate_line_index(line.index)] = counter;
-        ++counter;
-      }
+    parallel::apply_to_subranges(
+      size_type(0),
+      size_type(lines.size()),
+      [this, &new_lines](const size_type begin, const size_type end) {
+        for (size_type counter = begin; counter < end; ++counter)
+          new_lines[calculate_line_index(lines[counter].index)] = counter;
+      },
+      /* grainsize = */ 1000);
     lines_cache = std::move(new_lines);
   }
 
@@ -812,157 +851,156 @@ AffineConstraints<number>::close()
 
   // replace references to dofs that are themselves constrained. note that
   // because we may replace references to other dofs that may themselves be
-  // constrained to third ones, we have to iterate over all this until we
-  // replace no chains of constraints any more
+  // constrained to third ones, we have to continue with the entries that
+  // replaced a reference until no chains of constraints are left
   //
-  // the iteration replaces references to constrained degrees of freedom by
-  // second-order references. for example if x3=x0/2+x2/2 and x2=x0/2+x1/2,
-  // then the new list will be x3=x0/2+x0/4+x1/4. note that x0 appear
-  // twice. we will throw this duplicate out in the following step, where
-  // we sort the list so that throwing out duplicates becomes much more
-  // efficient. also, we have to do it only once, rather than in each
-  // iteration
-  [[maybe_unused]] size_type iteration                   = 0;
-  bool                       chained_constraint_replaced = false;
-  std::vector<bool>          line_finalized(lines.size(), false);
-  do
-    {
-      chained_constraint_replaced = false;
-      for (unsigned int line_index = 0; line_index < lines.size(); ++line_index)
-        if (line_finalized[line_index] == false)
-          {
-            ConstraintLine &line = lines[line_index];
-
-            // we need to keep track of how many replacements we do in this
-            // line, because we can end up in a cycle A->B->C->A without the
-            // number of entries growing.
-            [[maybe_unused]] size_type n_replacements = 0;
-
-            // loop over all entries of this line (including ones that we
-            // have appended in this go around) and see whether they are
-            // further constrained. ignore elements that we don't store on
-            // the current processor.
-            const unsigned int n_original_entries  = line.entries.size();
-            bool               has_sub_constraints = false;
-            const size_type    lines_cache_size    = lines_cache.size();
-            for (unsigned int entry = 0; entry < n_original_entries; ++entry)
-              {
-                const size_type dof_index =
-                  calculate_line_index(line.entries[entry].first);
+  // the replacement substitutes references to constrained degrees of freedom
+  // by second-order references. for example if x3=x0/2+x2/2 and
+  // x2=x0/2+x1/2, then the new list will be x3=x0/2+x0/4+x1/4. note that x0
+  // appear twice. we will throw this duplicate out in the following step,
+  // where we sort the list so that throwing out duplicates becomes much more
+  // efficient.
+  //
+  // every line is resolved against the lines as they were before this step,
+  // and the results are only written back once all lines are done. this
+  // way, the lines can be resolved in parallel without one task reading a
+  // line that another one modifies
+  std::vector<typename ConstraintLine::Entries> resolved_entries(lines.size());
+  std::vector<number>        resolved_inhomogeneities(lines.size());
+  std::vector<unsigned char> line_has_sub_constraints(lines.size(), 0);
+
+  const auto is_constrained_here = [this](const size_type index) {
+    const size_type line_index = calculate_line_index(index);
+    return (line_index < lines_cache.size() &&
+            lines_cache[line_index] != numbers::invalid_size_type);
+  };
 
-                if (dof_index < lines_cache_size &&
-                    lines_cache[dof_index] != numbers::invalid_size_type)
-                  {
-                    // Now we found an index that is further constrained, so
-                    // we need to resolve the entries.  We may replace some of
-                    // them, and we may add some, but we only walk through the
-                    // original entries (and also don't touch the
-                    // replacements) even though in principle we could also do
-                    // the ones we have added or replaced. There is no harm in
-                    // doing so: we will simply treat those in the next round
-                    // around of the outer iteration.
-                    has_sub_constraints = true;
-
-                    const number weight = line.entries[entry].second;
-                    Assert(line.entries[entry].first != line.index,
-                           ExcMessage("Cycle in constraints detected!"));
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(lines.size()),
+    [&](const size_type begin, const size_type end) {
+      for (size_type line_index = begin; line_index < end; ++line_index)
+        {
+          const ConstraintLine &line = lines[line_index];
+          if (std::none_of(line.entries.begin(),
+                           line.entries.end(),
+                           [&](const std::pair<size_type, number> &entry) {
+                             return is_constrained_here(entry.first);
+                           }))
+            continue;
 
-                    const ConstraintLine &constrained_line =
-                      lines[lines_cache[dof_index]];
-                    Assert(constrained_line.index == line.entries[entry].first,
-                           ExcInternalError());
+          line_has_sub_constraints[line_index] = 1;
 
-                    // now we have to replace an entry by its expansion. we do
-                    // that by overwriting the entry by the first entry of the
-                    // expansion and adding the remaining ones to the end,
-                    // where we will later process them once more
-                    //
-                    // we can of course only do that if the DoF that we are
-                    // currently handling is constrained by a linear combination
-                    // of other dofs:
-                    if (constrained_line.entries.size() > 0)
-                      {
-                        for (size_type i = 0;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          Assert(line.entries[entry].first !=
-                                   constrained_line.entries[i].first,
-                                 ExcMessage("Cycle in constraints detected!"));
-
-                        // replace first entry, then tack the rest to the end
-                        // of the list
-                        line.entries[entry] = std::pair<size_type, number>(
-                          constrained_line.entries[0].first,
-                          constrained_line.entries[0].second * weight);
-
-                        for (size_type i = 1;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          line.entries.emplace_back(
-                            constrained_line.entries[i].first,
-                            constrained_line.entries[i].second * weight);
-
-                        if constexpr (library_build_mode ==
-                                      LibraryBuildMode::debug)
-                          {
-                            // keep track of how many entries we replace in this
-                            // line. If we do more than there are constraints or
-                            // dofs in our system, we must have a cycle.
-                            ++n_replacements;
-                            Assert(n_replacements / 2 < largest_idx,
-                                   ExcMessage(
-                                     "Cycle in constraints detected!"));
-                          }
-                      }
-                    else
-                      // the DoF that we encountered is not constrained by a
-                      // linear combination of other dofs but is equal to just
-                      // the inhomogeneity (i.e. its chain of entries is
-                      // empty). in that case, we can't just overwrite the
-                      // current entry, but we have to actually eliminate
-                      // it. we do not want to change the loop length above we
-                      // do so by setting the 'first' entry to
-                      // invalid_size_type here to finally remove entries in a
-                      // second loop
-                      {
-                        line.entries[entry].first = numbers::invalid_size_type;
-                      }
+          typename ConstraintLine::Entries &entries =
+            resolved_entries[line_index];
+          number &inhomogeneity = resolved_inhomogeneities[line_index];
+          entries               = line.entries;
+          inhomogeneity         = line.inhomogeneity;
 
-                    line.inhomogeneity +=
-                      constrained_line.inhomogeneity * weight;
-                  }
-              }
+          // we need to keep track of how many replacements we do in this
+          // line, because we can end up in a cycle A->B->C->A without the
+          // number of entries growing.
+          [[maybe_unused]] size_type n_replacements = 0;
 
-            // If none of the entries in the current line refer to DoFs that are
-            // themselves constrained, then we can move on:
-            if (has_sub_constraints == false)
-              line_finalized[line_index] = true;
-            else
-              {
-                chained_constraint_replaced = true;
+          // loop over all entries of this line, including the ones we append
+          // on the way, and see whether they are further constrained. ignore
+          // elements that we don't store on the current processor.
+          for (size_type entry = 0; entry < entries.size();)
+            {
+              if (entries[entry].first == numbers::invalid_size_type ||
+                  !is_constrained_here(entries[entry].first))
+                {
+                  ++entry;
+                  continue;
+                }
+
+              const number weight = entries[entry].second;
+              Assert(entries[entry].first != line.index,
+                     ExcMessage("Cycle in constraints detected!"));
 
-                // Now delete the elements we have marked for deletion.
-                auto remaining_entries = line.entries.begin();
-                for (const auto &entry : line.entries)
-                  if (entry.first != numbers::invalid_size_type)
+              const ConstraintLine &constrained_line =
+                lines[lines_cache[calculate_line_index(entries[entry].first)]];
+              Assert(constrained_line.index == entries[entry].first,
+                     ExcInternalError());
+
+              inhomogeneity += constrained_line.inhomogeneity * weight;
+
+              // now we have to replace an entry by its expansion. we do that
+              // by overwriting the entry by the first entry of the expansion
+              // and adding the remaining ones to the end. the replaced entry
+              // is checked once more, as it may be constrained itself.
+              //
+              // we can of course only do that if the DoF that we are
+              // currently handling is constrained by a linear combination of
+              // other dofs:
+              if (constrained_line.entries.size() > 0)
+                {
+                  for (size_type i = 0; i < constrained_line.entries.size();
+                       ++i)
+                    Assert(entries[entry].first !=
+                             constrained_line.entries[i].first,
+                           ExcMessage("Cycle in constraints detected!"));
+
+                  entries[entry] = std::pair<size_type, number>(
+                    constrained_line.entries[0].first,
+                    constrained_line.entries[0].second * weight);
+
+                  for (size_type i = 1; i < constrained_line.entries.size();
+                       ++i)
+                    entries.emplace_back(constrained_line.entries[i].first,
+                                         constrained_line.entries[i].second *
+                                           weight);
+
+                  if constexpr (library_build_mode == LibraryBuildMode::debug)
                     {
-                      *remaining_entries = entry;
-                      ++remaining_entries;
+                      // keep track of how many entries we replace in this
+                      // line. If we do more than there are constraints or
+                      // dofs in our system, we must have a cycle.
+                      ++n_replacements;
+                      Assert(n_replacements / 2 < largest_idx + lines.size(),
+                             ExcMessage("Cycle in constraints detected!"));
                     }
-                line.entries.erase(remaining_entries, line.entries.end());
-              }
-          }
+                }
+              else
+                // the DoF that we encountered is not constrained by a linear
+                // combination of other dofs but is equal to just the
+                // inhomogeneity (i.e. its chain of entries is empty). in that
+                // case, we can't just overwrite the current entry, but we
+                // have to actually eliminate it. we do this by setting the
+                // 'first' entry to invalid_size_type here to finally remove
+                // entries in a second loop
+                {
+                  entries[entry].first = numbers::invalid_size_type;
+                  ++entry;
+                }
+            }
 
-      if constexpr (running_in_debug_mode())
-        {
-          // increase iteration count. note that we should not iterate more
-          // times than there are constraints, since this puts a natural upper
-          // bound on the length of constraint chains
-          ++iteration;
-          Assert(iteration <= lines.size() + 1, ExcInternalError());
+          // Now delete the elements we have marked for deletion.
+          entries.erase(std::remove_if(
+                          entries.begin(),
+                          entries.end(),
+                          [](const std::pair<size_type, number> &entry) {
+                            return entry.first == numbers::invalid_size_type;
+                          }),
+                        entries.end());
         }
-    }
-  while (chained_constraint_replaced == true);
+    },
+    /* grainsize = */ 100);
+
+  // now write the resolved lines back
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(lines.size()),
+    [&](const size_type begin, const size_type end) {
+      for (size_type line_index = begin; line_index < end; ++line_index)
+        if (line_has_sub_constraints[line_index] != 0)
+          {
+            lines[line_index].entries.swap(resolved_entries[line_index]);
+            lines[line_index].inhomogeneity =
+              resolved_inhomogeneities[line_index];
+          }
+    },
+    /* grainsize = */ 100);
 
   // Finally sort the entries and re-scale them if necessary. in this step,
   // we also throw out duplicates as mentioned above. moreover, as some
@@ -2798,6 +2836,21 @@ namespace internal
 
     template <typename V>
     using is_compressed_op = decltype(std::declval<V>().is_compressed());
+
+
+
+    // Whether the entries of a vector can be read and written through
+    // internal::ElementAccess from several threads at the same time, as long
+    // as every entry is written by at most one thread. This is the case for
+    // vectors that store their elements in plain arrays, but not for the
+    // wrappers of external libraries.
+    template <typename VectorType>
+    constexpr bool has_thread_safe_element_access =
+      dealii::is_serial_vector<VectorType>::value;
+
+    template <typename Number>
+    constexpr bool has_thread_safe_element_access<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>> = true;
   } // namespace AffineConstraints
 } // namespace internal
 
@@ -2953,21 +3006,41 @@ AffineConstraints<number>::distribute(VectorType &vec) const
                 std::bool_constant<IsBlockVector<VectorType>::value>());
             }
 
-          for (const ConstraintLine &line : lines)
-            if (vec_owned_elements.is_element(line.index))
-              {
-                typename VectorType::value_type new_value = line.inhomogeneity;
-                for (const std::pair<size_type, number> &entry : line.entries)
-                  new_value +=
-                    (static_cast<typename VectorType::value_type>(
-                       internal::ElementAccess<VectorType>::get(ghosted_vector,
-                                                                entry.first)) *
-                     entry.second);
-                AssertIsFinite(new_value);
-                internal::ElementAccess<VectorType>::set(new_value,
-                                                         line.index,
-                                                         vec);
-              }
+          // the lines only refer to unconstrained degrees of freedom after
+          // close(), so they can be processed in any order, and in parallel
+          // if the vector allows it
+          const auto distribute_lines =
+            [&](const typename std::vector<ConstraintLine>::const_iterator
+                  &begin,
+                const typename std::vector<ConstraintLine>::const_iterator
+                  &end) {
+              for (const ConstraintLine &line : boost::iterator_range<
+                     typename std::vector<ConstraintLine>::const_iterator>(
+                     begin, end))
+                if (vec_owned_elements.is_element(line.index))
+                  {
+                    typename VectorType::value_type new_value =
+                      line.inhomogeneity;
+                    for (const std::pair<size_type, number> &entry :
+                         line.entries)
+                      new_value += (static_cast<typename VectorType::value_type>(
+                                      internal::ElementAccess<VectorType>::get(
+                                        ghosted_vector, entry.first)) *
+                                    entry.second);
+                    AssertIsFinite(new_value);
+                    internal::ElementAccess<VectorType>::set(new_value,
+                                                             line.index,
+                                                             vec);
+                  }
+            };
+          if constexpr (internal::AffineConstraints::
+                          has_thread_safe_element_access<VectorType>)
+            parallel::apply_to_subranges(lines.cbegin(),
+                                         lines.cend(),
+                                         distribute_lines,
+                                         /* grainsize = */ 1000);
+          else
+            distribute_lines(lines.cbegin(), lines.cend());
 
           // now compress to communicate the entries that we added to
           // and that weren't to local processors to the owner
@@ -2982,24 +3055,37 @@ AffineConstraints<number>::distribute(VectorType &vec) const
     // support anything else or because it's completely stored
     // locally)
     {
-      for (const ConstraintLine &next_constraint : lines)
-        {
-          // fill entry in line
-          // next_constraint.index by adding the
-          // different contributions
-          typename VectorType::value_type new_value =
-            next_constraint.inhomogeneity;
-          for (const std::pair<size_type, number> &entry :
-               next_constraint.entries)
-            new_value +=
-              (static_cast<typename VectorType::value_type>(
-                 internal::ElementAccess<VectorType>::get(vec, entry.first)) *
-               entry.second);
-          AssertIsFinite(new_value);
-          internal::ElementAccess<VectorType>::set(new_value,
-                                                   next_constraint.index,
-                                                   vec);
-        }
+      // the lines only refer to unconstrained degrees of freedom after
+      // close(), so every task can write the lines of its range without
+      // reading values written by another task
+      parallel::apply_to_subranges(
+        lines.cbegin(),
+        lines.cend(),
+        [&vec](
+          const typename std::vector<ConstraintLine>::const_iterator &begin,
+          const typename std::vector<ConstraintLine>::const_iterator &end) {
+          for (const ConstraintLine &next_constraint : boost::iterator_range<
+                 typename std::vector<ConstraintLine>::const_iterator>(begin,
+                                                                       end))
+            {
+              // fill entry in line
+              // next_constraint.index by adding the
+              // different contributions
+              typename VectorType::value_type new_value =
+                next_constraint.inhomogeneity;
+              for (const std::pair<size_type, number> &entry :
+                   next_constraint.entries)
+                new_value += (static_cast<typename VectorType::value_type>(
+                                internal::ElementAccess<VectorType>::get(
+                                  vec, entry.first)) *
+                              entry.second);
+              AssertIsFinite(new_value);
+              internal::ElementAccess<VectorType>::set(new_value,
+                                                       next_constraint.index,
+                                                       vec);
+            }
+        },
+        /* grainsize = */ 1000);
     }
 }
 
@@ -0,0 +1,873 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_batched_full_matrix_h
+#define dealii_batched_full_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_support.h>
+
+#include <cmath>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * A collection of many small dense matrices of the same size, stored in a
+ * layout that allows to apply the typical operations of dense linear algebra
+ * to all matrices at once with SIMD instructions. The typical use case are
+ * the many small matrices that appear in local operations on cells, e.g.,
+ * the inverses of cell mass matrices for discontinuous Galerkin methods, or
+ * the local solves and Schur complements of static condensation and
+ * hybridization, where the overhead of calling FullMatrix or
+ * LAPACKFullMatrix functions for each of the tiny matrices dominates the
+ * actual arithmetic work.
+ *
+ * The matrices are grouped into batches of VectorizedArray::size() matrices,
+ * where each lane of the VectorizedArray holds the entries of a different
+ * matrix. The operations of this class, i.e., matrix-vector and
+ * matrix-matrix products, LU factorization with partial pivoting, Cholesky
+ * factorization, forward and backward substitution, and the inversion, then
+ * work on all lanes simultaneously. Only the search for pivots and the
+ * exchange of rows is done lane by lane. If the number of matrices is not a
+ * multiple of the width of the vectorization, the unused lanes of the last
+ * batch are initialized with the identity matrix, such that the
+ * factorizations on these lanes do not break down.
+ *
+ * As for FullMatrix, the entries of each batch are stored row by row, and
+ * vectors operated on by this class are arrays of VectorizedArray with
+ * m() or n() entries per batch, stored consecutively for all batches.
+ *
+ * @note This class allows for two modes of usage, similarly to
+ * TensorProductMatrixSymmetricSum. The first is a use case with run time
+ * constants for the matrix dimensions that is achieved by setting the
+ * optional template parameters @p n_rows_static and @p n_columns_static to
+ * -1. The second mode sets the dimensions as compile time constants, which
+ * allows the compiler to fully unroll the loops and keep entries in
+ * registers, giving considerably faster code for the small sizes this class
+ * is designed for, say up to 64 rows. For larger matrices, the
+ * cache-blocked algorithms of LAPACKFullMatrix are preferable.
+ *
+ * @tparam Number The type of the entries, typically VectorizedArray<double>
+ * or VectorizedArray<float>. Scalar types are also supported, in which case
+ * each batch contains a single matrix.
+ *
+ * @tparam n_rows_static Compile-time number of rows of the matrices, or -1
+ * if the number is set at run time in reinit().
+ *
+ * @tparam n_columns_static Compile-time number of columns of the matrices,
+ * or -1 if the number is set at run time in reinit(). Defaults to
+ * @p n_rows_static.
+ */
+template <typename Number,
+          int n_rows_static    = -1,
+          int n_columns_static = n_rows_static>
+class BatchedFullMatrix
+{
+public:
+  /**
+   * Type of matrix entries. This alias is analogous to <tt>value_type</tt>
+   * in the standard library containers.
+   */
+  using value_type = Number;
+
+  /**
+   * The scalar type of the entries of the individual matrices.
+   */
+  using scalar_type =
+    typename internal::VectorizedArrayTrait<Number>::value_type;
+
+  /**
+   * The number of matrices that are processed together in a batch.
+   */
+  static constexpr unsigned int n_lanes =
+    internal::VectorizedArrayTrait<Number>::width();
+
+  /**
+   * Default constructor, creating an empty object.
+   */
+  BatchedFullMatrix();
+
+  /**
+   * Constructor that immediately calls reinit().
+   */
+  BatchedFullMatrix(const unsigned int n_matrices,
+                    const unsigned int n_rows    = n_rows_static,
+                    const unsigned int n_columns = n_columns_static);
+
+  /**
+   * Set the number of matrices to @p n_matrices, each of size @p n_rows
+   * times @p n_columns. If the sizes have been specified as template
+   * arguments, the run time sizes must either match them or be left at
+   * their default values. All entries are set to zero, except the diagonal
+   * entries of the unused lanes in the last batch that are set to one.
+   */
+  void
+  reinit(const unsigned int n_matrices,
+         const unsigned int n_rows    = n_rows_static,
+         const unsigned int n_columns = n_columns_static);
+
+  /**
+   * Return the number of rows of each matrix.
+   */
+  unsigned int
+  m() const;
+
+  /**
+   * Return the number of columns of each matrix.
+   */
+  unsigned int
+  n() const;
+
+  /**
+   * Return the number of matrices stored in this object.
+   */
+  unsigned int
+  n_matrices() const;
+
+  /**
+   * Return the number of batches, i.e., the number of matrices divided by
+   * the number of lanes and rounded up.
+   */
+  unsigned int
+  n_batches() const;
+
+  /**
+   * Return the state of the matrices, i.e., whether they hold the matrices
+   * themselves or have been factorized or inverted.
+   */
+  LAPACKSupport::State
+  get_state() const;
+
+  /**
+   * Read-write access to the entry in row @p i and column @p j of all
+   * matrices in the batch @p batch.
+   */
+  Number &
+  operator()(const unsigned int batch,
+             const unsigned int i,
+             const unsigned int j);
+
+  /**
+   * Read access to the entry in row @p i and column @p j of all matrices in
+   * the batch @p batch.
+   */
+  const Number &
+  operator()(const unsigned int batch,
+             const unsigned int i,
+             const unsigned int j) const;
+
+  /**
+   * Copy the entries of @p matrix into the matrix with index
+   * @p matrix_index, which is located in the lane
+   * <code>matrix_index % n_lanes</code> of the batch
+   * <code>matrix_index / n_lanes</code>. This sets the state to
+   * LAPACKSupport::matrix.
+   */
+  template <typename OtherNumber>
+  void
+  set_matrix(const unsigned int             matrix_index,
+             const FullMatrix<OtherNumber> &matrix);
+
+  /**
+   * Copy the matrix with index @p matrix_index into @p matrix, which is
+   * resized to the size of the matrices stored in this object.
+   */
+  template <typename OtherNumber>
+  void
+  get_matrix(const unsigned int matrix_index,
+             FullMatrix<OtherNumber> &matrix) const;
+
+  /**
+   * Matrix-vector multiplication <code>dst = A * src</code> for all
+   * matrices, or <code>dst += A * src</code> if @p adding is true. The
+   * vector @p src holds n() entries per batch and @p dst holds m()
+   * entries per batch. If the matrices have been inverted by invert(), this
+   * applies the inverse.
+   */
+  void
+  vmult(const ArrayView<Number>       &dst,
+        const ArrayView<const Number> &src,
+        const bool                     adding = false) const;
+
+  /**
+   * Matrix-matrix multiplication <code>C = A * B</code> for all matrices,
+   * or <code>C += A * B</code> if @p adding is true, where A is this
+   * object. The matrices @p B must have as many rows as this object has
+   * columns, and @p C is resized if necessary. The object @p C must not be
+   * this object or @p B.
+   */
+  template <int n_columns_static_b>
+  void
+  mmult(BatchedFullMatrix<Number, n_rows_static, n_columns_static_b> &C,
+        const BatchedFullMatrix<Number, n_columns_static, n_columns_static_b>
+                  &B,
+        const bool adding = false) const;
+
+  /**
+   * Compute the LU factorization with partial pivoting of all matrices.
+   * The pivots are selected for each matrix, i.e., each lane, separately.
+   * Afterwards, solve() can be called. The matrices must be square.
+   */
+  void
+  compute_lu_factorization();
+
+  /**
+   * Compute the Cholesky factorization $A = LL^T$ of all matrices, which
+   * must be symmetric and positive definite. Only the lower triangle of the
+   * matrices is accessed. Afterwards, solve() can be called.
+   */
+  void
+  compute_cholesky_factorization();
+
+  /**
+   * Replace all matrices by their inverses, computed by an LU factorization
+   * with partial pivoting unless the matrices have already been factorized
+   * by compute_lu_factorization() or compute_cholesky_factorization().
+   * Afterwards, the inverses are applied by vmult().
+   */
+  void
+  invert();
+
+  /**
+   * Solve the linear systems with the factorized matrices and the
+   * right-hand sides given in @p rhs_and_solution, holding m() entries per
+   * batch, and overwrite them by the solutions. This function requires a
+   * previous call to compute_lu_factorization() or
+   * compute_cholesky_factorization().
+   */
+  void
+  solve(const ArrayView<Number> &rhs_and_solution) const;
+
+  /**
+   * Return the memory consumption of this object in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The number of rows of each matrix.
+   */
+  unsigned int n_rows;
+
+  /**
+   * The number of columns of each matrix.
+   */
+  unsigned int n_columns;
+
+  /**
+   * The number of matrices.
+   */
+  unsigned int n_stored_matrices;
+
+  /**
+   * The entries of all matrices, stored batch by batch and row by row
+   * within each batch.
+   */
+  AlignedVector<Number> data;
+
+  /**
+   * The inverses of the diagonal entries of the factors U (for the LU
+   * factorization) or L (for the Cholesky factorization), avoiding
+   * divisions in solve().
+   */
+  AlignedVector<Number> inverse_diagonal;
+
+  /**
+   * The row indices of the pivots of the LU factorization, with n() entries
+   * for each lane of each batch.
+   */
+  std::vector<unsigned int> pivots;
+
+  /**
+   * The state of the matrices.
+   */
+  LAPACKSupport::State state;
+};
+
+
+
+#ifndef DOXYGEN
+
+/*----------------------- Inline functions ----------------------------------*/
+
+namespace internal
+{
+  namespace BatchedFullMatrixImplementation
+  {
+    template <int n_rows_static,
+              int n_columns_static,
+              typename Number,
+              typename Number2>
+    inline void
+    vmult(const unsigned int n_rows_runtime,
+          const unsigned int n_columns_runtime,
+          const Number      *matrix,
+          const Number2     *src,
+          Number2           *dst,
+          const bool         adding)
+    {
+      const unsigned int n_rows =
+        n_rows_static > 0 ? n_rows_static : n_rows_runtime;
+      const unsigned int n_columns =
+        n_columns_static > 0 ? n_columns_static : n_columns_runtime;
+      for (unsigned int i = 0; i < n_rows; ++i)
+        {
+          Number2 sum = adding ? dst[i] : Number2();
+          for (unsigned int j = 0; j < n_columns; ++j)
+            sum += matrix[i * n_columns + j] * src[j];
+          dst[i] = sum;
+        }
+    }
+
+
+
+    template <int n_rows_static, typename Number>
+    inline void
+    lu_factorize(const unsigned int n_rows_runtime,
+                 Number            *matrix,
+                 Number            *inverse_diagonal,
+                 unsigned int      *pivots)
+    {
+      using Trait = VectorizedArrayTrait<Number>;
+
+      const unsigned int n = n_rows_static > 0 ? n_rows_static : n_rows_runtime;
+      for (unsigned int k = 0; k < n; ++k)
+        {
+          // search for the pivot and exchange the rows lane by lane
+          for (unsigned int v = 0; v < Trait::width(); ++v)
+            {
+              unsigned int pivot = k;
+              auto max_value     = std::abs(Trait::get(matrix[k * n + k], v));
+              for (unsigned int i = k + 1; i < n; ++i)
+                if (std::abs(Trait::get(matrix[i * n + k], v)) > max_value)
+                  {
+                    pivot     = i;
+                    max_value = std::abs(Trait::get(matrix[i * n + k], v));
+                  }
+              Assert(max_value > 0,
+                     ExcMessage("Singular matrix in LU factorization"));
+              pivots[k * Trait::width() + v] = pivot;
+              if (pivot != k)
+                for (unsigned int j = 0; j < n; ++j)
+                  std::swap(Trait::get(matrix[k * n + j], v),
+                            Trait::get(matrix[pivot * n + j], v));
+            }
+
+          // elimination on all lanes
+          const Number inverse = Number(1.) / matrix[k * n + k];
+          inverse_diagonal[k]  = inverse;
+          for (unsigned int i = k + 1; i < n; ++i)
+            {
+              const Number factor = matrix[i * n + k] * inverse;
+              matrix[i * n + k]   = factor;
+              for (unsigned int j = k + 1; j < n; ++j)
+                matrix[i * n + j] -= factor * matrix[k * n + j];
+            }
+        }
+    }
+
+
+
+    template <int n_rows_static, typename Number>
+    inline void
+    lu_solve(const unsigned int  n_rows_runtime,
+             const Number       *matrix,
+             const Number       *inverse_diagonal,
+             const unsigned int *pivots,
+             Number             *rhs)
+    {
+      using Trait = VectorizedArrayTrait<Number>;
+
+      const unsigned int n = n_rows_static > 0 ? n_rows_static : n_rows_runtime;
+
+      // apply the row exchanges of each lane in the order of the
+      // factorization
+      for (unsigned int k = 0; k < n; ++k)
+        for (unsigned int v = 0; v < Trait::width(); ++v)
+          {
+            const unsigned int pivot = pivots[k * Trait::width() + v];
+            if (pivot != k)
+              std::swap(Trait::get(rhs[k], v), Trait::get(rhs[pivot], v));
+          }
+
+      // forward substitution with the unit lower triangular factor
+      for (unsigned int i = 1; i < n; ++i)
+        {
+          Number sum = rhs[i];
+          for (unsigned int j = 0; j < i; ++j)
+            sum -= matrix[i * n + j] * rhs[j];
+          rhs[i] = sum;
+        }
+
+      // backward substitution with the upper triangular factor
+      for (int i = n - 1; i >= 0; --i)
+        {
+          Number sum = rhs[i];
+          for (unsigned int j = i + 1; j < n; ++j)
+            sum -= matrix[i * n + j] * rhs[j];
+          rhs[i] = sum * inverse_diagonal[i];
+        }
+    }
+
+
+
+    template <int n_rows_static, typename Number>
+    inline void
+    cholesky_factorize(const unsigned int n_rows_runtime,
+                       Number            *matrix,
+                       Number            *inverse_diagonal)
+    {
+      const unsigned int n = n_rows_static > 0 ? n_rows_static : n_rows_runtime;
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          Number diagonal = matrix[j * n + j];
+          for (unsigned int k = 0; k < j; ++k)
+            diagonal -= matrix[j * n + k] * matrix[j * n + k];
+          const Number l_jj    = std::sqrt(diagonal);
+          const Number inverse = Number(1.) / l_jj;
+          matrix[j * n + j]    = l_jj;
+          inverse_diagonal[j]  = inverse;
+          for (unsigned int i = j + 1; i < n; ++i)
+            {
+              Number sum = matrix[i * n + j];
+              for (unsigned int k = 0; k < j; ++k)
+                sum -= matrix[i * n + k] * matrix[j * n + k];
+              matrix[i * n + j] = sum * inverse;
+            }
+        }
+    }
+
+
+
+    template <int n_rows_static, typename Number>
+    inline void
+    cholesky_solve(const unsigned int n_rows_runtime,
+                   const Number      *matrix,
+                   const Number      *inverse_diagonal,
+                   Number            *rhs)
+    {
+      const unsigned int n = n_rows_static > 0 ? n_rows_static : n_rows_runtime;
+
+      // forward substitution with L
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          Number sum = rhs[i];
+          for (unsigned int j = 0; j < i; ++j)
+            sum -= matrix[i * n + j] * rhs[j];
+          rhs[i] = sum * inverse_diagonal[i];
+        }
+
+      // backward substitution with L^T
+      for (int i = n - 1; i >= 0; --i)
+        {
+          Number sum = rhs[i];
+          for (unsigned int j = i + 1; j < n; ++j)
+            sum -= matrix[j * n + i] * rhs[j];
+          rhs[i] = sum * inverse_diagonal[i];
+        }
+    }
+  } // namespace BatchedFullMatrixImplementation
+} // namespace internal
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline BatchedFullMatrix<Number, n_rows_static, n_columns_static>::
+  BatchedFullMatrix()
+  : n_rows(0)
+  , n_columns(0)
+  , n_stored_matrices(0)
+  , state(LAPACKSupport::matrix)
+{}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline BatchedFullMatrix<Number, n_rows_static, n_columns_static>::
+  BatchedFullMatrix(const unsigned int n_matrices,
+                    const unsigned int n_rows,
+                    const unsigned int n_columns)
+  : BatchedFullMatrix()
+{
+  reinit(n_matrices, n_rows, n_columns);
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::reinit(
+  const unsigned int n_matrices,
+  const unsigned int n_rows,
+  const unsigned int n_columns)
+{
+  Assert(n_rows_static < 0 ||
+           n_rows == static_cast<unsigned int>(n_rows_static),
+         ExcDimensionMismatch(n_rows, n_rows_static));
+  Assert(n_columns_static < 0 ||
+           n_columns == static_cast<unsigned int>(n_columns_static),
+         ExcDimensionMismatch(n_columns, n_columns_static));
+  Assert(n_rows != numbers::invalid_unsigned_int &&
+           n_columns != numbers::invalid_unsigned_int,
+         ExcMessage("The size of the matrices must be given at run time "
+                    "if it is not given as template argument."));
+
+  this->n_rows            = n_rows;
+  this->n_columns         = n_columns;
+  this->n_stored_matrices = n_matrices;
+  state                   = LAPACKSupport::matrix;
+
+  data.resize_fast(n_batches() * n_rows * n_columns);
+  data.fill(Number());
+  inverse_diagonal.clear();
+  pivots.clear();
+
+  // set the unused lanes of the last batch to the identity matrix
+  if (n_matrices % n_lanes != 0)
+    {
+      const unsigned int batch = n_batches() - 1;
+      for (unsigned int i = 0; i < std::min(n_rows, n_columns); ++i)
+        for (unsigned int v = n_matrices % n_lanes; v < n_lanes; ++v)
+          internal::VectorizedArrayTrait<Number>::get(
+            (*this)(batch, i, i), v) = 1.;
+    }
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline unsigned int
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::m() const
+{
+  return n_rows_static > 0 ? n_rows_static : n_rows;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline unsigned int
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::n() const
+{
+  return n_columns_static > 0 ? n_columns_static : n_columns;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline unsigned int
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::n_matrices() const
+{
+  return n_stored_matrices;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline unsigned int
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::n_batches() const
+{
+  return (n_stored_matrices + n_lanes - 1) / n_lanes;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline LAPACKSupport::State
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::get_state() const
+{
+  return state;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline Number &
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::operator()(
+  const unsigned int batch,
+  const unsigned int i,
+  const unsigned int j)
+{
+  AssertIndexRange(batch, n_batches());
+  AssertIndexRange(i, m());
+  AssertIndexRange(j, n());
+  return data[(batch * m() + i) * n() + j];
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline const Number &
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::operator()(
+  const unsigned int batch,
+  const unsigned int i,
+  const unsigned int j) const
+{
+  AssertIndexRange(batch, n_batches());
+  AssertIndexRange(i, m());
+  AssertIndexRange(j, n());
+  return data[(batch * m() + i) * n() + j];
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+template <typename OtherNumber>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::set_matrix(
+  const unsigned int             matrix_index,
+  const FullMatrix<OtherNumber> &matrix)
+{
+  AssertIndexRange(matrix_index, n_matrices());
+  AssertDimension(matrix.m(), m());
+  AssertDimension(matrix.n(), n());
+
+  const unsigned int batch = matrix_index / n_lanes;
+  const unsigned int lane  = matrix_index % n_lanes;
+  for (unsigned int i = 0; i < m(); ++i)
+    for (unsigned int j = 0; j < n(); ++j)
+      internal::VectorizedArrayTrait<Number>::get((*this)(batch, i, j), lane) =
+        matrix(i, j);
+  state = LAPACKSupport::matrix;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+template <typename OtherNumber>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::get_matrix(
+  const unsigned int       matrix_index,
+  FullMatrix<OtherNumber> &matrix) const
+{
+  AssertIndexRange(matrix_index, n_matrices());
+
+  matrix.reinit(m(), n());
+  const unsigned int batch = matrix_index / n_lanes;
+  const unsigned int lane  = matrix_index % n_lanes;
+  for (unsigned int i = 0; i < m(); ++i)
+    for (unsigned int j = 0; j < n(); ++j)
+      matrix(i, j) =
+        internal::VectorizedArrayTrait<Number>::get((*this)(batch, i, j), lane);
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::vmult(
+  const ArrayView<Number>       &dst,
+  const ArrayView<const Number> &src,
+  const bool                     adding) const
+{
+  Assert(state == LAPACKSupport::matrix ||
+           state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(state));
+  AssertDimension(dst.size(), n_batches() * m());
+  AssertDimension(src.size(), n_batches() * n());
+
+  for (unsigned int b = 0; b < n_batches(); ++b)
+    internal::BatchedFullMatrixImplementation::vmult<n_rows_static,
+                                                     n_columns_static>(
+      m(),
+      n(),
+      data.data() + b * m() * n(),
+      src.data() + b * n(),
+      dst.data() + b * m(),
+      adding);
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+template <int n_columns_static_b>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::mmult(
+  BatchedFullMatrix<Number, n_rows_static, n_columns_static_b>         &C,
+  const BatchedFullMatrix<Number, n_columns_static, n_columns_static_b> &B,
+  const bool adding) const
+{
+  Assert(state == LAPACKSupport::matrix ||
+           state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(state));
+  Assert(B.get_state() == LAPACKSupport::matrix ||
+           B.get_state() == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(B.get_state()));
+  AssertDimension(B.m(), n());
+  AssertDimension(B.n_matrices(), n_matrices());
+  Assert(static_cast<const void *>(&C) != static_cast<const void *>(this) &&
+           static_cast<const void *>(&C) != static_cast<const void *>(&B),
+         ExcMessage("The result matrix must not be one of the factors."));
+
+  if (C.n_matrices() != n_matrices() || C.m() != m() || C.n() != B.n())
+    {
+      Assert(adding == false, ExcDimensionMismatch(C.n(), B.n()));
+      C.reinit(n_matrices(), m(), B.n());
+    }
+
+  const unsigned int n_inner  = n_columns_static > 0 ? n_columns_static : n();
+  const unsigned int n_result = n_columns_static_b > 0 ? n_columns_static_b :
+                                                         B.n();
+  const unsigned int n_rows_a = m();
+  for (unsigned int b = 0; b < n_batches(); ++b)
+    for (unsigned int i = 0; i < n_rows_a; ++i)
+      for (unsigned int j = 0; j < n_result; ++j)
+        {
+          Number sum = adding ? C(b, i, j) : Number();
+          for (unsigned int k = 0; k < n_inner; ++k)
+            sum += (*this)(b, i, k) * B(b, k, j);
+          C(b, i, j) = sum;
+        }
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::
+  compute_lu_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  AssertDimension(m(), n());
+
+  inverse_diagonal.resize_fast(n_batches() * n());
+  pivots.resize(n_batches() * n() * n_lanes);
+  for (unsigned int b = 0; b < n_batches(); ++b)
+    internal::BatchedFullMatrixImplementation::lu_factorize<n_rows_static>(
+      n(),
+      data.data() + b * n() * n(),
+      inverse_diagonal.data() + b * n(),
+      pivots.data() + b * n() * n_lanes);
+  state = LAPACKSupport::lu;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::
+  compute_cholesky_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  AssertDimension(m(), n());
+
+  inverse_diagonal.resize_fast(n_batches() * n());
+  for (unsigned int b = 0; b < n_batches(); ++b)
+    internal::BatchedFullMatrixImplementation::cholesky_factorize<
+      n_rows_static>(n(),
+                     data.data() + b * n() * n(),
+                     inverse_diagonal.data() + b * n());
+  state = LAPACKSupport::cholesky;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::solve(
+  const ArrayView<Number> &rhs_and_solution) const
+{
+  AssertDimension(rhs_and_solution.size(), n_batches() * n());
+
+  if (state == LAPACKSupport::lu)
+    for (unsigned int b = 0; b < n_batches(); ++b)
+      internal::BatchedFullMatrixImplementation::lu_solve<n_rows_static>(
+        n(),
+        data.data() + b * n() * n(),
+        inverse_diagonal.data() + b * n(),
+        pivots.data() + b * n() * n_lanes,
+        rhs_and_solution.data() + b * n());
+  else if (state == LAPACKSupport::cholesky)
+    for (unsigned int b = 0; b < n_batches(); ++b)
+      internal::BatchedFullMatrixImplementation::cholesky_solve<n_rows_static>(
+        n(),
+        data.data() + b * n() * n(),
+        inverse_diagonal.data() + b * n(),
+        rhs_and_solution.data() + b * n());
+  else
+    Assert(false, LAPACKSupport::ExcState(state));
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline void
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::invert()
+{
+  if (state == LAPACKSupport::matrix)
+    compute_lu_factorization();
+  Assert(state == LAPACKSupport::lu || state == LAPACKSupport::cholesky,
+         LAPACKSupport::ExcState(state));
+
+  // solve for the unit vectors of each batch and write the result into a
+  // new array, transposing the columns of the inverse into rows
+  AlignedVector<Number> inverse(data.size());
+  AlignedVector<Number> column(n());
+  for (unsigned int b = 0; b < n_batches(); ++b)
+    for (unsigned int j = 0; j < n(); ++j)
+      {
+        for (unsigned int i = 0; i < n(); ++i)
+          column[i] = Number(i == j ? 1. : 0.);
+        if (state == LAPACKSupport::lu)
+          internal::BatchedFullMatrixImplementation::lu_solve<n_rows_static>(
+            n(),
+            data.data() + b * n() * n(),
+            inverse_diagonal.data() + b * n(),
+            pivots.data() + b * n() * n_lanes,
+            column.data());
+        else
+          internal::BatchedFullMatrixImplementation::cholesky_solve<
+            n_rows_static>(n(),
+                           data.data() + b * n() * n(),
+                           inverse_diagonal.data() + b * n(),
+                           column.data());
+        for (unsigned int i = 0; i < n(); ++i)
+          inverse[(b * n() + i) * n() + j] = column[i];
+      }
+
+  data.swap(inverse);
+  inverse_diagonal.clear();
+  pivots.clear();
+  state = LAPACKSupport::inverse_matrix;
+}
+
+
+
+template <typename Number, int n_rows_static, int n_columns_static>
+inline std::size_t
+BatchedFullMatrix<Number, n_rows_static, n_columns_static>::memory_consumption()
+  const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(data) +
+         MemoryConsumption::memory_consumption(inverse_diagonal) +
+         MemoryConsumption::memory_consumption(pivots);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,526 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_node_block_sparse_matrix_h
+#define dealii_node_block_sparse_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/node_block_sparsity_pattern.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix in the block compressed sparse row (BSR) format, based on
+ * the NodeBlockSparsityPattern class. For each block in the sparsity pattern,
+ * the matrix stores a dense block of size @p block_size times
+ * @p block_size, with the entries of each block stored column by column.
+ *
+ * Compared to SparseMatrix, this class stores only one column index per
+ * block, i.e., the memory for the indices is reduced by a factor of
+ * <tt>block_size*block_size</tt>, and the matrix-vector product works on
+ * small dense blocks whose size is known at compile time. This allows the
+ * compiler to unroll the loops within a block and to use SIMD instructions
+ * for the update of the @p block_size rows of a block row, whereas the
+ * matrix-vector product of SparseMatrix needs to load a column index for
+ * every entry. The format is most efficient for vector-valued problems with
+ * an FESystem of @p block_size copies of the same scalar element, see the
+ * discussion in NodeBlockSparsityPattern. A typical use, e.g., for linear
+ * elasticity in 3d, looks as follows:
+ * @code
+ * NodeBlockSparsityPattern sparsity(dof_handler.n_dofs(),
+ *                                   dof_handler.n_dofs(),
+ *                                   dim);
+ * DoFTools::make_sparsity_pattern(dof_handler, sparsity, constraints, false);
+ * sparsity.compress();
+ *
+ * NodeBlockSparseMatrix<double, dim> system_matrix(sparsity);
+ * // ... assemble the cell matrices and call
+ * constraints.distribute_local_to_global(cell_matrix,
+ *                                        local_dof_indices,
+ *                                        system_matrix);
+ * @endcode
+ *
+ * Besides the functions needed for assembly, the class provides vmult(),
+ * Tvmult(), and the other functions needed to be used in iterative solvers
+ * such as SolverCG and with the PreconditionJacobi and
+ * PreconditionChebyshev preconditioners. The vector types for these
+ * functions need to store their entries contiguously in memory and provide
+ * access to them via the <tt>begin()</tt> function, as is the case for
+ * Vector and for LinearAlgebra::distributed::Vector on a single process.
+ *
+ * @note Instantiations for this template are provided for <tt>@<float@> and
+ * @<double@></tt> and block sizes one, two, and three. Other block sizes can
+ * be used by including the file node_block_sparse_matrix.templates.h.
+ */
+template <typename Number, unsigned int block_size>
+class NodeBlockSparseMatrix : public EnableObserverPointer
+{
+public:
+  /**
+   * Type of matrix entries.
+   */
+  using value_type = Number;
+
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Constructor. Initialize an empty matrix.
+   */
+  NodeBlockSparseMatrix();
+
+  /**
+   * Constructor. Initialize the matrix with the given sparsity pattern,
+   * setting all entries to zero, see reinit().
+   */
+  explicit NodeBlockSparseMatrix(const NodeBlockSparsityPattern &sparsity);
+
+  /**
+   * Destructor.
+   */
+  virtual ~NodeBlockSparseMatrix() override = default;
+
+  /**
+   * Set all entries of the matrix to zero, which is the only value allowed
+   * for @p d. This operation keeps the sparsity pattern.
+   */
+  NodeBlockSparseMatrix &
+  operator=(const double d);
+
+  /**
+   * Reinitialize the matrix with the given sparsity pattern and set all
+   * entries to zero. The sparsity pattern must be compressed and have the
+   * block size of this class. A reference to the pattern is stored, so the
+   * pattern needs to outlive this object.
+   */
+  void
+  reinit(const NodeBlockSparsityPattern &sparsity);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of rows of this matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of this matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of stored entries of this matrix, i.e., the number of
+   * blocks times <tt>block_size*block_size</tt>.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return a reference to the sparsity pattern of this matrix.
+   */
+  const NodeBlockSparsityPattern &
+  get_sparsity_pattern() const;
+
+  /**
+   * Set the entry (i,j) to @p value. The entry must be part of one of the
+   * blocks of the sparsity pattern.
+   */
+  void
+  set(const size_type i, const size_type j, const Number value);
+
+  /**
+   * Add @p value to the entry (i,j). The entry must be part of one of the
+   * blocks of the sparsity pattern.
+   */
+  void
+  add(const size_type i, const size_type j, const Number value);
+
+  /**
+   * Add the provided values to several elements in the given row of the
+   * matrix with column indices as given by @p col_indices. This is the
+   * function used by AffineConstraints::distribute_local_to_global().
+   *
+   * If @p elide_zero_values is true, zero values are skipped. If
+   * @p col_indices_are_sorted is true, the column indices must be sorted in
+   * ascending order, which allows a faster search for the respective
+   * blocks.
+   */
+  void
+  add(const size_type  row,
+      const size_type  n_cols,
+      const size_type *col_indices,
+      const Number    *values,
+      const bool       elide_zero_values      = true,
+      const bool       col_indices_are_sorted = false);
+
+  /**
+   * Return the value of the entry (i,j), or zero if the entry is not part of
+   * the sparsity pattern.
+   */
+  Number
+  el(const size_type i, const size_type j) const;
+
+  /**
+   * Return the main diagonal element in the <i>i</i>th row.
+   */
+  Number
+  diag_element(const size_type i) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix.
+   */
+  template <typename OutVector, typename InVector>
+  void
+  vmult(OutVector &dst, const InVector &src) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M^T*src$ with $M$ being this
+   * matrix.
+   */
+  template <typename OutVector, typename InVector>
+  void
+  Tvmult(OutVector &dst, const InVector &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add $M*src$ to $dst$ with $M$ being
+   * this matrix.
+   */
+  template <typename OutVector, typename InVector>
+  void
+  vmult_add(OutVector &dst, const InVector &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add $M^T*src$ to $dst$ with $M$
+   * being this matrix.
+   */
+  template <typename OutVector, typename InVector>
+  void
+  Tvmult_add(OutVector &dst, const InVector &src) const;
+
+  /**
+   * Apply the Jacobi preconditioner, which multiplies every element of the
+   * @p src vector by the inverse of the respective diagonal element and
+   * multiplies the result with the relaxation factor @p omega.
+   */
+  template <typename VectorType>
+  void
+  precondition_Jacobi(VectorType       &dst,
+                      const VectorType &src,
+                      const Number      omega = 1.) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object, not including the sparsity pattern.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception
+   */
+  DeclException2(ExcInvalidIndex,
+                 size_type,
+                 size_type,
+                 << "You are trying to access the matrix entry with index <"
+                 << arg1 << ',' << arg2
+                 << ">, but this entry is not part of any block of the "
+                    "sparsity pattern of this matrix.");
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+
+private:
+  /**
+   * Return the position of the entry (i,j) in the array of values, or
+   * numbers::invalid_size_type if the entry is not part of the pattern.
+   */
+  std::size_t
+  entry_index(const size_type i, const size_type j) const;
+
+  /**
+   * Perform the matrix-vector product on the block rows in the range
+   * [begin_row, end_row), adding into the destination if @p add is set.
+   */
+  void
+  vmult_on_block_rows(const size_type begin_row,
+                      const size_type end_row,
+                      const Number   *src,
+                      Number         *dst,
+                      const bool      add) const;
+
+  /**
+   * Worker function for vmult() and vmult_add() on the raw vector data.
+   */
+  void
+  do_vmult(const Number *src, Number *dst, const bool add) const;
+
+  /**
+   * Worker function for Tvmult() and Tvmult_add() on the raw vector data.
+   */
+  void
+  do_Tvmult(const Number *src, Number *dst, const bool add) const;
+
+  /**
+   * Pointer to the sparsity pattern used for this matrix.
+   */
+  ObserverPointer<const NodeBlockSparsityPattern, NodeBlockSparseMatrix>
+    sparsity_pattern;
+
+  /**
+   * The entries of the matrix, stored block by block in the order of the
+   * sparsity pattern, and column by column within each block.
+   */
+  AlignedVector<Number> val;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+/*---------------------- Inline functions -----------------------------------*/
+
+
+
+template <typename Number, unsigned int block_size>
+inline typename NodeBlockSparseMatrix<Number, block_size>::size_type
+NodeBlockSparseMatrix<Number, block_size>::m() const
+{
+  return sparsity_pattern == nullptr ? 0 : sparsity_pattern->n_rows();
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline typename NodeBlockSparseMatrix<Number, block_size>::size_type
+NodeBlockSparseMatrix<Number, block_size>::n() const
+{
+  return sparsity_pattern == nullptr ? 0 : sparsity_pattern->n_cols();
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline std::size_t
+NodeBlockSparseMatrix<Number, block_size>::n_nonzero_elements() const
+{
+  return val.size();
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline const NodeBlockSparsityPattern &
+NodeBlockSparseMatrix<Number, block_size>::get_sparsity_pattern() const
+{
+  Assert(sparsity_pattern != nullptr, ExcNotInitialized());
+  return *sparsity_pattern;
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline std::size_t
+NodeBlockSparseMatrix<Number, block_size>::entry_index(const size_type i,
+                                                       const size_type j) const
+{
+  const size_type block =
+    sparsity_pattern->block_index(i / block_size, j / block_size);
+  if (block == numbers::invalid_size_type)
+    return numbers::invalid_size_type;
+  else
+    return (static_cast<std::size_t>(block) * block_size + j % block_size) *
+             block_size +
+           i % block_size;
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline void
+NodeBlockSparseMatrix<Number, block_size>::set(const size_type i,
+                                               const size_type j,
+                                               const Number    value)
+{
+  AssertIsFinite(value);
+  const std::size_t index = entry_index(i, j);
+  Assert(index != numbers::invalid_size_type, ExcInvalidIndex(i, j));
+  val[index] = value;
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline void
+NodeBlockSparseMatrix<Number, block_size>::add(const size_type i,
+                                               const size_type j,
+                                               const Number    value)
+{
+  AssertIsFinite(value);
+  if (value == Number())
+    return;
+  const std::size_t index = entry_index(i, j);
+  Assert(index != numbers::invalid_size_type, ExcInvalidIndex(i, j));
+  val[index] += value;
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline Number
+NodeBlockSparseMatrix<Number, block_size>::el(const size_type i,
+                                              const size_type j) const
+{
+  const std::size_t index = entry_index(i, j);
+  return index == numbers::invalid_size_type ? Number() : val[index];
+}
+
+
+
+template <typename Number, unsigned int block_size>
+inline Number
+NodeBlockSparseMatrix<Number, block_size>::diag_element(
+  const size_type i) const
+{
+  Assert(m() == n(), ExcNotQuadratic());
+  const std::size_t index = entry_index(i, i);
+  Assert(index != numbers::invalid_size_type, ExcInvalidIndex(i, i));
+  return val[index];
+}
+
+
+
+template <typename Number, unsigned int block_size>
+template <typename OutVector, typename InVector>
+inline void
+NodeBlockSparseMatrix<Number, block_size>::vmult(OutVector      &dst,
+                                                 const InVector &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  do_vmult(src.begin(), dst.begin(), false);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+template <typename OutVector, typename InVector>
+inline void
+NodeBlockSparseMatrix<Number, block_size>::vmult_add(OutVector      &dst,
+                                                     const InVector &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  do_vmult(src.begin(), dst.begin(), true);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+template <typename OutVector, typename InVector>
+inline void
+NodeBlockSparseMatrix<Number, block_size>::Tvmult(OutVector      &dst,
+                                                  const InVector &src) const
+{
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  do_Tvmult(src.begin(), dst.begin(), false);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+template <typename OutVector, typename InVector>
+inline void
+NodeBlockSparseMatrix<Number, block_size>::Tvmult_add(
+  OutVector      &dst,
+  const InVector &src) const
+{
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  do_Tvmult(src.begin(), dst.begin(), true);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+template <typename VectorType>
+inline void
+NodeBlockSparseMatrix<Number, block_size>::precondition_Jacobi(
+  VectorType       &dst,
+  const VectorType &src,
+  const Number      omega) const
+{
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+
+  const Number *src_ptr = src.begin();
+  Number       *dst_ptr = dst.begin();
+  for (size_type block_row = 0; block_row < sparsity_pattern->n_block_rows();
+       ++block_row)
+    {
+      const size_type block =
+        sparsity_pattern->block_index(block_row, block_row);
+      Assert(block != numbers::invalid_size_type,
+             ExcInvalidIndex(block_row * block_size, block_row * block_size));
+      const Number *diagonal_block =
+        val.data() +
+        static_cast<std::size_t>(block) * block_size * block_size;
+      for (unsigned int l = 0; l < block_size; ++l)
+        dst_ptr[block_row * block_size + l] =
+          omega * src_ptr[block_row * block_size + l] /
+          diagonal_block[l * block_size + l];
+    }
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
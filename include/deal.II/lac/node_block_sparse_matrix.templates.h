@@ -0,0 +1,254 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_node_block_sparse_matrix_templates_h
+#define dealii_node_block_sparse_matrix_templates_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/node_block_sparse_matrix.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <typename Number, unsigned int block_size>
+NodeBlockSparseMatrix<Number, block_size>::NodeBlockSparseMatrix()
+  : sparsity_pattern(nullptr, typeid(*this).name())
+{}
+
+
+
+template <typename Number, unsigned int block_size>
+NodeBlockSparseMatrix<Number, block_size>::NodeBlockSparseMatrix(
+  const NodeBlockSparsityPattern &sparsity)
+  : NodeBlockSparseMatrix()
+{
+  reinit(sparsity);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+NodeBlockSparseMatrix<Number, block_size> &
+NodeBlockSparseMatrix<Number, block_size>::operator=(const double d)
+{
+  (void)d;
+  Assert(d == 0, ExcScalarAssignmentOnlyForZeroValue());
+
+  val.fill(Number());
+
+  return *this;
+}
+
+
+
+template <typename Number, unsigned int block_size>
+void
+NodeBlockSparseMatrix<Number, block_size>::reinit(
+  const NodeBlockSparsityPattern &sparsity)
+{
+  Assert(sparsity.is_compressed(),
+         NodeBlockSparsityPattern::ExcNotCompressed());
+  AssertDimension(sparsity.get_block_size(), block_size);
+
+  sparsity_pattern = &sparsity;
+  val.clear();
+  val.resize(sparsity.n_nonzero_blocks() * block_size * block_size);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+void
+NodeBlockSparseMatrix<Number, block_size>::clear()
+{
+  sparsity_pattern = nullptr;
+  val.clear();
+}
+
+
+
+template <typename Number, unsigned int block_size>
+void
+NodeBlockSparseMatrix<Number, block_size>::add(
+  const size_type  row,
+  const size_type  n_cols,
+  const size_type *col_indices,
+  const Number    *values,
+  const bool       elide_zero_values,
+  const bool       col_indices_are_sorted)
+{
+  Assert(sparsity_pattern != nullptr, ExcNotInitialized());
+  AssertIndexRange(row, m());
+
+  const size_type    block_row     = row / block_size;
+  const unsigned int row_in_block  = row % block_size;
+  const size_type   *block_columns = sparsity_pattern->block_columns.data();
+
+  const std::size_t row_begin = sparsity_pattern->row_starts[block_row];
+  const std::size_t row_end   = sparsity_pattern->row_starts[block_row + 1];
+
+  // for sorted column indices, the blocks are visited in ascending order as
+  // well, so we only need to walk forward through the block row
+  std::size_t block = row_begin;
+  for (size_type k = 0; k < n_cols; ++k)
+    {
+      AssertIsFinite(values[k]);
+      if (elide_zero_values && values[k] == Number())
+        continue;
+
+      AssertIndexRange(col_indices[k], n());
+      const size_type block_col = col_indices[k] / block_size;
+      if (col_indices_are_sorted)
+        while (block < row_end && block_columns[block] < block_col)
+          ++block;
+      else
+        block = std::lower_bound(block_columns + row_begin,
+                                 block_columns + row_end,
+                                 block_col) -
+                block_columns;
+      Assert(block < row_end && block_columns[block] == block_col,
+             ExcInvalidIndex(row, col_indices[k]));
+
+      val[(block * block_size + col_indices[k] % block_size) * block_size +
+          row_in_block] += values[k];
+    }
+}
+
+
+
+template <typename Number, unsigned int block_size>
+std::size_t
+NodeBlockSparseMatrix<Number, block_size>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(val);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+void
+NodeBlockSparseMatrix<Number, block_size>::vmult_on_block_rows(
+  const size_type begin_row,
+  const size_type end_row,
+  const Number   *src,
+  Number         *dst,
+  const bool      add) const
+{
+  const std::size_t *row_starts    = sparsity_pattern->row_starts.data();
+  const size_type   *block_columns = sparsity_pattern->block_columns.data();
+
+  for (size_type block_row = begin_row; block_row < end_row; ++block_row)
+    {
+      // the blocks are stored column by column, so the product with one
+      // block is a sequence of block_size updates of the block_size
+      // partial sums with a scalar entry of the source vector, which the
+      // compiler can unroll and vectorize as the block size is known at
+      // compile time
+      Number sum[block_size] = {};
+      for (std::size_t block = row_starts[block_row];
+           block < row_starts[block_row + 1];
+           ++block)
+        {
+          const Number *matrix_block =
+            val.data() + block * block_size * block_size;
+          const Number *src_block = src + block_columns[block] * block_size;
+          for (unsigned int j = 0; j < block_size; ++j)
+            {
+              const Number src_value = src_block[j];
+              DEAL_II_OPENMP_SIMD_PRAGMA
+              for (unsigned int i = 0; i < block_size; ++i)
+                sum[i] += matrix_block[j * block_size + i] * src_value;
+            }
+        }
+
+      Number *dst_block = dst + block_row * block_size;
+      if (add)
+        for (unsigned int i = 0; i < block_size; ++i)
+          dst_block[i] += sum[i];
+      else
+        for (unsigned int i = 0; i < block_size; ++i)
+          dst_block[i] = sum[i];
+    }
+}
+
+
+
+template <typename Number, unsigned int block_size>
+void
+NodeBlockSparseMatrix<Number, block_size>::do_vmult(const Number *src,
+                                                    Number       *dst,
+                                                    const bool    add) const
+{
+  Assert(sparsity_pattern != nullptr, ExcNotInitialized());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    sparsity_pattern->n_block_rows(),
+    [this, src, dst, add](const size_type begin_row, const size_type end_row) {
+      vmult_on_block_rows(begin_row, end_row, src, dst, add);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        block_size +
+      1);
+}
+
+
+
+template <typename Number, unsigned int block_size>
+void
+NodeBlockSparseMatrix<Number, block_size>::do_Tvmult(const Number *src,
+                                                     Number       *dst,
+                                                     const bool    add) const
+{
+  Assert(sparsity_pattern != nullptr, ExcNotInitialized());
+
+  if (!add)
+    std::fill(dst, dst + n(), Number());
+
+  const std::size_t *row_starts    = sparsity_pattern->row_starts.data();
+  const size_type   *block_columns = sparsity_pattern->block_columns.data();
+
+  for (size_type block_row = 0; block_row < sparsity_pattern->n_block_rows();
+       ++block_row)
+    {
+      const Number *src_block = src + block_row * block_size;
+      for (std::size_t block = row_starts[block_row];
+           block < row_starts[block_row + 1];
+           ++block)
+        {
+          const Number *matrix_block =
+            val.data() + block * block_size * block_size;
+          Number *dst_block = dst + block_columns[block] * block_size;
+          for (unsigned int j = 0; j < block_size; ++j)
+            {
+              Number sum = Number();
+              for (unsigned int i = 0; i < block_size; ++i)
+                sum += matrix_block[j * block_size + i] * src_block[i];
+              dst_block[j] += sum;
+            }
+        }
+    }
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
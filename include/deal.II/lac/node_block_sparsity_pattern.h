@@ -0,0 +1,351 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_node_block_sparsity_pattern_h
+#define dealii_node_block_sparsity_pattern_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern_base.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declaration
+#ifndef DOXYGEN
+template <typename, unsigned int>
+class NodeBlockSparseMatrix;
+#endif
+
+/**
+ * @addtogroup Sparsity
+ * @{
+ */
+
+/**
+ * A sparsity pattern in the block compressed sparse row (BSR) format, in
+ * which the rows and columns are grouped into consecutive blocks of a fixed
+ * size, and a dense block of entries is stored for each pair of row and
+ * column blocks that contains at least one nonzero entry. Only one column
+ * index is stored per block, rather than one per entry as in
+ * SparsityPattern.
+ *
+ * This format is designed for vector-valued problems discretized with an
+ * FESystem that consists of several copies of the same scalar element, such
+ * as <tt>FESystem<dim>(FE_Q<dim>(degree), dim)</tt> for elasticity. The
+ * unknowns of all vector components at the same support point then couple
+ * with the same set of unknowns, and the default numbering of
+ * DoFHandler::distribute_dofs() enumerates the vector components of each
+ * support point consecutively for vertex degrees of freedom and
+ * polynomial degrees up to two. Choosing the number of components as the
+ * block size, the blocks then correspond to the support points (nodes) of
+ * the element, and the blocks are dense. Any other numbering still gives a
+ * valid sparsity pattern, but with a larger number of blocks that contain
+ * zero entries. In particular, DoFRenumbering::component_wise() should not
+ * be used with this class.
+ *
+ * The class is derived from SparsityPatternBase, which means that the
+ * entries can be added directly by DoFTools::make_sparsity_pattern() or
+ * AffineConstraints::add_entries_local_to_global(), without building an
+ * intermediate DynamicSparsityPattern on the level of individual entries.
+ * Entries can only be added before calling compress(); after that, the
+ * pattern can be used to initialize a NodeBlockSparseMatrix.
+ *
+ * The number of rows and columns must be multiples of the block size.
+ */
+class NodeBlockSparsityPattern : public SparsityPatternBase
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Constructor. Initialize an empty object.
+   */
+  NodeBlockSparsityPattern();
+
+  /**
+   * Constructor. Initialize the pattern with @p m rows and @p n columns
+   * grouped into blocks of size @p block_size, see reinit().
+   */
+  NodeBlockSparsityPattern(const size_type    m,
+                           const size_type    n,
+                           const unsigned int block_size);
+
+  /**
+   * Reinitialize the pattern with @p m rows and @p n columns grouped into
+   * blocks of size @p block_size, removing all previous entries. The object
+   * is in the state where entries can be added.
+   */
+  void
+  reinit(const size_type m, const size_type n, const unsigned int block_size);
+
+  /**
+   * Add the block that contains the entry (i,j) to the pattern.
+   */
+  void
+  add(const size_type i, const size_type j);
+
+  /**
+   * Add the blocks that contain the entries in the given row and columns to
+   * the pattern.
+   */
+  virtual void
+  add_row_entries(const size_type                  &row,
+                  const ArrayView<const size_type> &columns,
+                  const bool indices_are_sorted = false) override;
+
+  using SparsityPatternBase::add_entries;
+
+  /**
+   * Convert the blocks added so far into the compressed storage format.
+   * After this call, no more entries can be added.
+   */
+  void
+  compress();
+
+  /**
+   * Return whether compress() has been called.
+   */
+  bool
+  is_compressed() const;
+
+  /**
+   * Return the size of the blocks.
+   */
+  unsigned int
+  get_block_size() const;
+
+  /**
+   * Return the number of block rows, i.e., the number of rows divided by the
+   * block size.
+   */
+  size_type
+  n_block_rows() const;
+
+  /**
+   * Return the number of block columns, i.e., the number of columns divided
+   * by the block size.
+   */
+  size_type
+  n_block_cols() const;
+
+  /**
+   * Return the number of blocks in the pattern.
+   */
+  std::size_t
+  n_nonzero_blocks() const;
+
+  /**
+   * Return the number of entries in the pattern, i.e., the number of blocks
+   * times the square of the block size. This includes entries in the blocks
+   * that would not be part of a SparsityPattern built for the same problem.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of blocks in the given block row.
+   */
+  unsigned int
+  block_row_length(const size_type block_row) const;
+
+  /**
+   * Return the block column index of the @p index-th block in block row
+   * @p block_row. The blocks within a block row are sorted by their column
+   * index.
+   */
+  size_type
+  block_column_number(const size_type    block_row,
+                      const unsigned int index) const;
+
+  /**
+   * Return the position of the block (block_row, block_col) in the array of
+   * all blocks, or numbers::invalid_size_type if the block is not part of
+   * the pattern.
+   */
+  size_type
+  block_index(const size_type block_row, const size_type block_col) const;
+
+  /**
+   * Return whether the entry (i,j) is part of the pattern, i.e., whether it
+   * is contained in one of the blocks.
+   */
+  bool
+  exists(const size_type i, const size_type j) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcNotCompressed,
+                   "The operation you attempted is only allowed after the "
+                   "NodeBlockSparsityPattern has been compressed.");
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcAlreadyCompressed,
+                   "The operation you attempted is only allowed before the "
+                   "NodeBlockSparsityPattern has been compressed.");
+
+  /**
+   * Exception
+   */
+  DeclException2(ExcNotMultipleOfBlockSize,
+                 size_type,
+                 unsigned int,
+                 << "The size " << arg1
+                 << " is not a multiple of the block size " << arg2 << '.');
+
+private:
+  /**
+   * Size of the blocks.
+   */
+  unsigned int block_size;
+
+  /**
+   * Whether compress() has been called.
+   */
+  bool compressed;
+
+  /**
+   * The pattern on the level of blocks while entries are added.
+   */
+  DynamicSparsityPattern block_pattern;
+
+  /**
+   * Offset of the first block of each block row in the array
+   * block_columns, with an additional entry at the end holding the total
+   * number of blocks.
+   */
+  std::vector<std::size_t> row_starts;
+
+  /**
+   * The block column index of each block, sorted within each block row.
+   */
+  std::vector<size_type> block_columns;
+
+  /**
+   * Temporary array for the block column indices in add_row_entries().
+   */
+  std::vector<size_type> column_buffer;
+
+  template <typename, unsigned int>
+  friend class NodeBlockSparseMatrix;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+/*---------------------- Inline functions -----------------------------------*/
+
+
+
+inline bool
+NodeBlockSparsityPattern::is_compressed() const
+{
+  return compressed;
+}
+
+
+
+inline unsigned int
+NodeBlockSparsityPattern::get_block_size() const
+{
+  return block_size;
+}
+
+
+
+inline NodeBlockSparsityPattern::size_type
+NodeBlockSparsityPattern::n_block_rows() const
+{
+  return n_rows() / block_size;
+}
+
+
+
+inline NodeBlockSparsityPattern::size_type
+NodeBlockSparsityPattern::n_block_cols() const
+{
+  return n_cols() / block_size;
+}
+
+
+
+inline std::size_t
+NodeBlockSparsityPattern::n_nonzero_blocks() const
+{
+  Assert(compressed, ExcNotCompressed());
+  return block_columns.size();
+}
+
+
+
+inline std::size_t
+NodeBlockSparsityPattern::n_nonzero_elements() const
+{
+  return n_nonzero_blocks() * block_size * block_size;
+}
+
+
+
+inline unsigned int
+NodeBlockSparsityPattern::block_row_length(const size_type block_row) const
+{
+  Assert(compressed, ExcNotCompressed());
+  AssertIndexRange(block_row, n_block_rows());
+  return row_starts[block_row + 1] - row_starts[block_row];
+}
+
+
+
+inline NodeBlockSparsityPattern::size_type
+NodeBlockSparsityPattern::block_column_number(const size_type    block_row,
+                                              const unsigned int index) const
+{
+  AssertIndexRange(index, block_row_length(block_row));
+  return block_columns[row_starts[block_row] + index];
+}
+
+
+
+inline void
+NodeBlockSparsityPattern::add(const size_type i, const size_type j)
+{
+  Assert(!compressed, ExcAlreadyCompressed());
+  AssertIndexRange(i, n_rows());
+  AssertIndexRange(j, n_cols());
+  block_pattern.add(i / block_size, j / block_size);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -2104,6 +2104,9 @@ public:
  * set `dst` to zero, whereas the operation after the loop performs the
  * iteration leading to $x^{n+1}$ described above, modifying the `dst` and
  * `src` vectors.
+ *
+ * The matrix-free operators derived from MatrixFreeOperators::Base, such as
+ * MatrixFreeOperators::LaplaceOperator, provide this function.
  */
 template <typename MatrixType         = SparseMatrix<double>,
           typename VectorType         = Vector<double>,
@@ -0,0 +1,537 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sliced_ellpack_matrix_h
+#define dealii_sliced_ellpack_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix stored in the sliced ELLPACK format with row sorting,
+ * also known as SELL-C-$\sigma$ format, see M. Kreutzer, G. Hager, G.
+ * Wellein, H. Fehske, A. R. Bishop, "A unified sparse matrix data format for
+ * efficient general sparse matrix-vector multiplication on modern
+ * processors with wide SIMD units", SIAM Journal on Scientific Computing 36
+ * (2014), C401-C423.
+ *
+ * The matrix-vector product of SparseMatrix works on one row of the
+ * compressed row storage (CSR) format at a time, which cannot make use of
+ * the SIMD units of modern processors. In the SELL-C-$\sigma$ format, the
+ * rows of the matrix are grouped into chunks of $C$ consecutive rows, with
+ * $C$ the number of lanes in VectorizedArray<Number>. Within each chunk, the
+ * rows are padded to the length of the longest row in the chunk and stored
+ * column by column, such that the matrix-vector product can process the $C$
+ * rows of a chunk with SIMD instructions, using gather instructions to
+ * access the source vector. In order to reduce the overhead of the padding
+ * for matrices with strongly varying row lengths, as is, e.g., the case for
+ * adaptively refined meshes with hanging nodes or for hp-adaptive
+ * discretizations, the rows are sorted by their length within windows of
+ * $\sigma$ consecutive rows before being grouped into chunks. The sorting is
+ * only internal to this class, i.e., the vectors passed to vmult() and
+ * similar functions use the original numbering of the rows.
+ *
+ * This class does not provide functions to assemble the matrix. Rather, it
+ * is set up from a SparsityPattern by the reinit() function, and the values
+ * are then copied from a SparseMatrix with the same sparsity pattern by the
+ * copy_from() function. The class provides the functions vmult(), Tvmult(),
+ * vmult_add(), Tvmult_add(), el(), diag_element(), and
+ * precondition_Jacobi(), such that it can be used as a drop-in replacement
+ * for SparseMatrix in iterative solvers such as SolverCG and in
+ * preconditioners such as PreconditionJacobi and PreconditionChebyshev.
+ *
+ * The vector types for the matrix-vector products need to store their
+ * entries contiguously in memory and provide access to them via the
+ * <tt>begin()</tt> function, as is the case for Vector and for
+ * LinearAlgebra::distributed::Vector on a single process.
+ *
+ * @note Instantiations for this template are provided for <tt>@<float@> and
+ * @<double@></tt>.
+ */
+template <typename Number>
+class SlicedEllpackMatrix : public EnableObserverPointer
+{
+public:
+  /**
+   * Type of matrix entries.
+   */
+  using value_type = Number;
+
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Number of rows that are stored together in a chunk and processed by
+   * SIMD instructions, i.e., the parameter $C$ of the SELL-C-$\sigma$
+   * format.
+   */
+  static constexpr unsigned int chunk_size = VectorizedArray<Number>::size();
+
+  /**
+   * Constructor. Initialize an empty matrix.
+   */
+  SlicedEllpackMatrix();
+
+  /**
+   * Constructor. Set up the structure of the matrix from the given sparsity
+   * pattern and copy the values from @p matrix, see reinit() and
+   * copy_from().
+   */
+  template <typename Number2>
+  explicit SlicedEllpackMatrix(const SparseMatrix<Number2> &matrix,
+                               const unsigned int           sigma = 32);
+
+  /**
+   * Set up the structure of the matrix from the given sparsity pattern,
+   * setting all values to zero. The rows are sorted by their length within
+   * windows of @p sigma rows, which is rounded up to a multiple of
+   * chunk_size. A value of one disables the sorting.
+   *
+   * The sparsity pattern needs to be compressed. Unlike SparseMatrix, this
+   * class does not keep a reference to the sparsity pattern.
+   */
+  void
+  reinit(const SparsityPattern &sparsity, const unsigned int sigma = 32);
+
+  /**
+   * Set up the structure of the matrix from the sparsity pattern of
+   * @p matrix and copy its values.
+   */
+  template <typename Number2>
+  void
+  reinit(const SparseMatrix<Number2> &matrix, const unsigned int sigma = 32);
+
+  /**
+   * Copy the values of @p matrix into this object. The matrix must have
+   * the same sparsity pattern as the one this object has been initialized
+   * with.
+   */
+  template <typename Number2>
+  SlicedEllpackMatrix<Number> &
+  copy_from(const SparseMatrix<Number2> &matrix);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of rows of this matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of this matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of nonzero entries of this matrix, not counting the
+   * entries added for padding.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of entries stored by this matrix, including the
+   * entries added for padding. The ratio between this number and
+   * n_nonzero_elements() describes the overhead of the format compared to
+   * the CSR format of SparseMatrix.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Return the value of the entry (i,j), or zero if the entry is not part of
+   * the sparsity pattern. This function needs to search through the
+   * respective row and is thus expensive.
+   */
+  Number
+  el(const size_type i, const size_type j) const;
+
+  /**
+   * Return the main diagonal element in the <i>i</i>th row.
+   */
+  Number
+  diag_element(const size_type i) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M^T*src$ with $M$ being this
+   * matrix. This function does not make use of SIMD instructions.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add $M*src$ to $dst$ with $M$ being
+   * this matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add $M^T*src$ to $dst$ with $M$
+   * being this matrix. This function does not make use of SIMD
+   * instructions.
+   */
+  template <typename VectorType>
+  void
+  Tvmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the Jacobi preconditioner, which multiplies every element of the
+   * @p src vector by the inverse of the respective diagonal element and
+   * multiplies the result with the relaxation factor @p omega.
+   */
+  template <typename VectorType>
+  void
+  precondition_Jacobi(VectorType       &dst,
+                      const VectorType &src,
+                      const Number      omega = 1.) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcDifferentSparsityPattern,
+                   "The sparsity pattern of the given matrix does not match "
+                   "the one this object was initialized with.");
+
+private:
+  /**
+   * Perform the matrix-vector product on the chunks in the range
+   * [begin_chunk, end_chunk), adding into the destination if @p add is set.
+   */
+  void
+  vmult_on_chunks(const unsigned int begin_chunk,
+                  const unsigned int end_chunk,
+                  const Number      *src,
+                  Number            *dst,
+                  const bool         add) const;
+
+  /**
+   * Worker function for vmult() and vmult_add() on the raw vector data.
+   */
+  void
+  do_vmult(const Number *src, Number *dst, const bool add) const;
+
+  /**
+   * Worker function for Tvmult() and Tvmult_add() on the raw vector data.
+   */
+  void
+  do_Tvmult(const Number *src, Number *dst, const bool add) const;
+
+  /**
+   * Number of rows.
+   */
+  size_type n_rows;
+
+  /**
+   * Number of columns.
+   */
+  size_type n_cols;
+
+  /**
+   * Number of nonzero entries without padding.
+   */
+  std::size_t n_nonzeros;
+
+  /**
+   * Offset of the first entry of each chunk in the arrays values and
+   * column_indices, with an additional entry at the end for the total
+   * number of stored entries. The width of chunk c is given by
+   * <tt>(chunk_starts[c + 1] - chunk_starts[c]) / chunk_size</tt>.
+   */
+  std::vector<std::size_t> chunk_starts;
+
+  /**
+   * The matrix entries, stored chunk by chunk and within each chunk column
+   * by column, i.e., the entries of the rows of a chunk at the same position
+   * within the row are contiguous in memory.
+   */
+  AlignedVector<Number> values;
+
+  /**
+   * The column indices of the entries, in the same layout as values. Padded
+   * entries refer to a valid column index with a zero value.
+   */
+  std::vector<unsigned int> column_indices;
+
+  /**
+   * For each position in the sorted order of rows, the index of the
+   * original row. The array is padded to a multiple of chunk_size.
+   */
+  std::vector<unsigned int> sorted_rows;
+
+  /**
+   * For each original row, the position in the sorted order.
+   */
+  std::vector<unsigned int> row_positions;
+
+  /**
+   * For each position in the sorted order of rows, the number of entries
+   * without padding.
+   */
+  std::vector<unsigned int> row_lengths;
+
+  /**
+   * The diagonal of the matrix in the original numbering of rows, stored
+   * separately for diag_element() and precondition_Jacobi().
+   */
+  AlignedVector<Number> diagonal;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+/*---------------------- Inline functions -----------------------------------*/
+
+
+
+template <typename Number>
+template <typename Number2>
+inline SlicedEllpackMatrix<Number>::SlicedEllpackMatrix(
+  const SparseMatrix<Number2> &matrix,
+  const unsigned int           sigma)
+  : SlicedEllpackMatrix()
+{
+  reinit(matrix, sigma);
+}
+
+
+
+template <typename Number>
+template <typename Number2>
+inline void
+SlicedEllpackMatrix<Number>::reinit(const SparseMatrix<Number2> &matrix,
+                                    const unsigned int           sigma)
+{
+  reinit(matrix.get_sparsity_pattern(), sigma);
+  copy_from(matrix);
+}
+
+
+
+template <typename Number>
+template <typename Number2>
+inline SlicedEllpackMatrix<Number> &
+SlicedEllpackMatrix<Number>::copy_from(const SparseMatrix<Number2> &matrix)
+{
+  AssertDimension(matrix.m(), n_rows);
+  AssertDimension(matrix.n(), n_cols);
+  AssertDimension(matrix.n_nonzero_elements(), n_nonzeros);
+
+  for (size_type row = 0; row < n_rows; ++row)
+    {
+      const unsigned int position = row_positions[row];
+      const unsigned int chunk    = position / chunk_size;
+      const unsigned int lane     = position % chunk_size;
+      const std::size_t  start    = chunk_starts[chunk] + lane;
+
+      AssertDimension(matrix.get_row_length(row), row_lengths[position]);
+
+      diagonal[row]      = Number();
+      unsigned int index = 0;
+      for (auto entry = matrix.begin(row); entry != matrix.end(row);
+           ++entry, ++index)
+        {
+          Assert(column_indices[start + index * chunk_size] ==
+                   entry->column(),
+                 ExcDifferentSparsityPattern());
+          values[start + index * chunk_size] = entry->value();
+          if (entry->column() == row)
+            diagonal[row] = entry->value();
+        }
+    }
+
+  return *this;
+}
+
+
+
+template <typename Number>
+inline typename SlicedEllpackMatrix<Number>::size_type
+SlicedEllpackMatrix<Number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename Number>
+inline typename SlicedEllpackMatrix<Number>::size_type
+SlicedEllpackMatrix<Number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename Number>
+inline std::size_t
+SlicedEllpackMatrix<Number>::n_nonzero_elements() const
+{
+  return n_nonzeros;
+}
+
+
+
+template <typename Number>
+inline std::size_t
+SlicedEllpackMatrix<Number>::n_stored_elements() const
+{
+  return values.size();
+}
+
+
+
+template <typename Number>
+inline Number
+SlicedEllpackMatrix<Number>::diag_element(const size_type i) const
+{
+  AssertIndexRange(i, n_rows);
+  return diagonal[i];
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+inline void
+SlicedEllpackMatrix<Number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_vmult(src.begin(), dst.begin(), false);
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+inline void
+SlicedEllpackMatrix<Number>::vmult_add(VectorType       &dst,
+                                       const VectorType &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_vmult(src.begin(), dst.begin(), true);
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+inline void
+SlicedEllpackMatrix<Number>::Tvmult(VectorType       &dst,
+                                    const VectorType &src) const
+{
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_Tvmult(src.begin(), dst.begin(), false);
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+inline void
+SlicedEllpackMatrix<Number>::Tvmult_add(VectorType       &dst,
+                                        const VectorType &src) const
+{
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_Tvmult(src.begin(), dst.begin(), true);
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+inline void
+SlicedEllpackMatrix<Number>::precondition_Jacobi(VectorType       &dst,
+                                                 const VectorType &src,
+                                                 const Number      omega) const
+{
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+
+  const Number *src_ptr = src.begin();
+  Number       *dst_ptr = dst.begin();
+  DEAL_II_OPENMP_SIMD_PRAGMA
+  for (size_type i = 0; i < n_rows; ++i)
+    dst_ptr[i] = omega * src_ptr[i] / diagonal[i];
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -141,13 +141,17 @@ namespace internal
     public:
       /**
        * Initialize the data structures in this class with the given
-       * parameters for the solution process.
+       * parameters for the solution process. The argument @p s_step_size
+       * selects the number of vectors that are orthogonalized at once by
+       * orthonormalize_block(), with the default value of one indicating
+       * that orthonormalize_nth_vector() is used.
        */
       void
       initialize(const LinearAlgebra::OrthogonalizationStrategy
                                     orthogonalization_strategy,
                  const unsigned int max_basis_size,
-                 const bool         force_reorthogonalization);
+                 const bool         force_reorthogonalization,
+                 const unsigned int s_step_size = 1);
 
       /**
        * Orthonormalize the vector at the position @p n within the array
@@ -180,6 +184,68 @@ namespace internal
         const boost::signals2::signal<void(int)> &reorthogonalize_signal =
           boost::signals2::signal<void(int)>());
 
+      /**
+       * Orthonormalize the @p s vectors at the positions <tt>n, ..., n + s -
+       * 1</tt> within the array @p orthogonal_vectors against the @p n
+       * orthonormal vectors with indices <tt>0, ..., n - 1</tt> and among
+       * each other, as done in the s-step variant of GMRES. The vectors are
+       * expected to have been generated by the recursion $v_{k+1} = (\mathrm
+       * {op} - \theta_k I) v_k$ with the shifts $\theta_k$ given by @p
+       * shifts, starting from the last orthonormal vector $v_0$ at position
+       * <tt>n - 1</tt>, where $\mathrm{op}$ is the (preconditioned) matrix.
+       *
+       * The orthogonalization is done by block classical Gram-Schmidt, using
+       * a Cholesky factorization of the Gram matrix of the new vectors that
+       * is corrected by the Pythagorean theorem. This way, all inner products
+       * for the @p s vectors are computed with a single global reduction. A
+       * second pass (i.e., block CGS2) is run if loss of orthogonality is
+       * detected or if re-orthogonalization has been requested by the
+       * initialize() function, with the same behavior regarding the signal
+       * @p reorthogonalize_signal as in orthonormalize_nth_vector().
+       *
+       * From the coefficients of the orthogonalization and the shifts, the
+       * function recovers the columns <tt>n - 1, ..., n + s - 2</tt> of the
+       * upper Hessenberg matrix. The QR factorization of these columns is not
+       * done here, but must be requested column by column via
+       * factorize_next_column(), which allows the caller to check for
+       * convergence after each of the @p s steps. The function returns the
+       * number of columns that could be computed, which is less than @p s
+       * only in case of a (lucky) breakdown, where a new vector lies in the
+       * span of the previous ones.
+       */
+      template <typename VectorType>
+      unsigned int
+      orthonormalize_block(
+        const unsigned int                        n,
+        const unsigned int                        s,
+        TmpVectors<VectorType>                   &orthogonal_vectors,
+        const std::vector<double>                &shifts,
+        const unsigned int                        accumulated_iterations = 0,
+        const boost::signals2::signal<void(int)> &reorthogonalize_signal =
+          boost::signals2::signal<void(int)>());
+
+      /**
+       * Compute the QR factorization for the next column of the Hessenberg
+       * matrix computed by orthonormalize_block() that has not been treated
+       * yet, and return the estimate of the residual in the Krylov subspace
+       * that includes this column.
+       */
+      double
+      factorize_next_column();
+
+      /**
+       * Compute the shifts for generating a Newton basis in the s-step
+       * variant of GMRES from the eigenvalues of the leading @p n_shifts times
+       * @p n_shifts block of the Hessenberg matrix, i.e., the Ritz values.
+       * Since the vectors are stored in real arithmetic, only the real parts
+       * of the Ritz values are used. They are returned in Leja ordering to
+       * avoid the growth of the basis vectors. If deal.II was configured
+       * without LAPACK, zero shifts corresponding to the monomial basis are
+       * returned.
+       */
+      std::vector<double>
+      compute_newton_shifts(const unsigned int n_shifts) const;
+
       /**
        * Using the matrix and right hand side computed during the
        * factorization, solve the underlying minimization problem for the
@@ -252,6 +318,12 @@ namespace internal
        */
       LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
 
+      /**
+       * Number of vectors orthogonalized at once in the s-step variant, or 1
+       * if the basis is built one vector at a time.
+       */
+      unsigned int s_step_size;
+
       /**
        * This is a helper function to perform the incremental computation of
        * the QR factorization of the Hessenberg matrix involved in the Arnoldi
@@ -392,6 +464,36 @@ namespace internal
  * class, see the documentation of the Solver base class.
  *
  *
+ * <h3>The s-step variant</h3>
+ *
+ * Each iteration of GMRES involves the orthogonalization of a new vector
+ * against the Arnoldi basis, which requires at least one global reduction
+ * (i.e., an MPI_Allreduce operation) per iteration. For large parallel
+ * computations with cheap matrix-vector products and preconditioners, the
+ * latency of these reductions can dominate the run time. When
+ * AdditionalData::s_step_size is set to a value $s>1$, the solver instead
+ * generates $s$ Krylov vectors at once by applying the matrix and
+ * preconditioner $s$ times in a row, using the polynomial basis selected by
+ * AdditionalData::s_step_basis. The block of new vectors is then
+ * orthonormalized against the existing basis and among itself by a block
+ * classical Gram-Schmidt method with a single global reduction, and the
+ * entries of the Hessenberg matrix are recovered from the coefficients of
+ * the orthogonalization. This reduces the number of global reductions by a
+ * factor of $s$. Loss of orthogonality is monitored by the same criterion as
+ * in the standard variant, and a second orthogonalization pass is done if
+ * necessary or if AdditionalData::force_re_orthogonalization is set; in this
+ * case, the setting in AdditionalData::orthogonalization_strategy is not
+ * used.
+ *
+ * The s-step variant computes the same Krylov subspace as the standard
+ * variant, and the residual is still checked in every iteration, so the
+ * iteration counts are typically the same. However, the generated vectors
+ * become increasingly ill-conditioned for larger values of $s$, which can
+ * lead to a loss of accuracy. Values of $s$ between 2 and 8 are typically
+ * appropriate, with the larger values only being useful with the Newton
+ * basis.
+ *
+ *
  * <h3>Observing the progress of linear solver iterations</h3>
  *
  * The solve() function of this class uses the mechanism described in the
@@ -501,6 +603,45 @@ public:
      * Strategy to orthogonalize vectors.
      */
     LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
+
+    /**
+     * Number of Krylov vectors that are generated at once and then
+     * orthogonalized together with a single global reduction, see the
+     * section on the s-step variant in the general documentation of this
+     * class. The default value of one selects the standard GMRES algorithm.
+     * The value must not exceed the size of the Arnoldi basis.
+     */
+    unsigned int s_step_size;
+
+    /**
+     * Polynomial basis used to generate the Krylov vectors in the s-step
+     * variant of GMRES.
+     */
+    enum class SStepBasis
+    {
+      /**
+       * Generate the vectors by repeated application of the (preconditioned)
+       * matrix, $v_{k+1} = P^{-1}A v_k$. This is the simplest choice, but the
+       * generated vectors quickly become linearly dependent for larger
+       * values of AdditionalData::s_step_size.
+       */
+      monomial,
+
+      /**
+       * Generate the vectors by the shifted recursion $v_{k+1} = (P^{-1}A -
+       * \theta_k I) v_k$, where the shifts $\theta_k$ are the (real parts
+       * of the) Ritz values computed from the Hessenberg matrix of the first
+       * block, which is generated with the monomial basis. This keeps the
+       * vectors better conditioned.
+       */
+      newton
+    };
+
+    /**
+     * Polynomial basis for the s-step variant of GMRES. This setting is
+     * ignored if AdditionalData::s_step_size is one.
+     */
+    SStepBasis s_step_basis;
   };
 
   /**
@@ -977,6 +1118,8 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   , force_re_orthogonalization(force_re_orthogonalization)
   , batched_mode(batched_mode)
   , orthogonalization_strategy(orthogonalization_strategy)
+  , s_step_size(1)
+  , s_step_basis(SStepBasis::newton)
 {
   Assert(max_basis_size >= 1,
          ExcMessage("SolverGMRES needs at least one vector in the "
@@ -1378,15 +1521,90 @@ namespace internal
 
 
 
+    // Compute the inner products of the s vectors with indices n, ..., n + s
+    // - 1 in the array 'vectors' with all vectors of lower or equal index,
+    // starting from index zero. For each vector k, the result contains n + k
+    // + 1 entries that are stored consecutively in 'products'.
+    template <typename VectorType,
+              std::enable_if_t<!is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_inner_products(const unsigned int            n,
+                         const unsigned int            s,
+                         const TmpVectors<VectorType> &vectors,
+                         Vector<double>               &products,
+                         std::vector<const typename VectorType::value_type *> &)
+    {
+      products.reinit(s * n + s * (s + 1) / 2);
+      unsigned int offset = 0;
+      for (unsigned int k = 0; k < s; ++k)
+        {
+          for (unsigned int i = 0; i < n + k + 1; ++i)
+            products(offset + i) = vectors[n + k] * vectors[i];
+          offset += n + k + 1;
+        }
+    }
+
+
+
+    template <typename VectorType,
+              std::enable_if_t<is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_inner_products(
+      const unsigned int                                    n,
+      const unsigned int                                    s,
+      const TmpVectors<VectorType>                         &vectors,
+      Vector<double>                                       &products,
+      std::vector<const typename VectorType::value_type *> &vector_ptrs)
+    {
+      products.reinit(s * n + s * (s + 1) / 2);
+      Vector<double> local_products;
+      unsigned int   offset = 0;
+      for (unsigned int k = 0; k < s; ++k)
+        {
+          const VectorType &vv = vectors[n + k];
+          local_products.reinit(n + k + 1);
+          for (unsigned int b = 0; b < n_blocks(vv); ++b)
+            {
+              vector_ptrs.resize(n + k + 1);
+              for (unsigned int i = 0; i < n + k + 1; ++i)
+                vector_ptrs[i] = block(vectors[i], b).begin();
+
+              do_Tvmult_add<false>(n + k + 1,
+                                   block(vv, b).end() - block(vv, b).begin(),
+                                   block(vv, b).begin(),
+                                   vector_ptrs,
+                                   local_products);
+            }
+          for (unsigned int i = 0; i < n + k + 1; ++i)
+            products(offset + i) = local_products(i);
+          offset += n + k + 1;
+        }
+
+      // a single global reduction for all inner products of the block
+      Utilities::MPI::sum(products,
+                          block(vectors[n], 0).get_mpi_communicator(),
+                          products);
+    }
+
+
+
     template <typename Number>
     inline void
     ArnoldiProcess<Number>::initialize(
       const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy,
       const unsigned int                             basis_size,
-      const bool                                     force_reorthogonalization)
+      const bool                                     force_reorthogonalization,
+      const unsigned int                             s_step_size)
     {
+      Assert(s_step_size >= 1 && s_step_size <= basis_size,
+             ExcMessage("The s-step size must be between one and the size "
+                        "of the Arnoldi basis."));
+
       this->orthogonalization_strategy = orthogonalization_strategy;
       this->do_reorthogonalization     = force_reorthogonalization;
+      this->s_step_size                = s_step_size;
 
       hessenberg_matrix.reinit(basis_size + 1, basis_size);
       triangular_matrix.reinit(basis_size + 1, basis_size, true);
@@ -1592,6 +1810,272 @@ namespace internal
 
 
 
+    template <typename Number>
+    template <typename VectorType>
+    inline unsigned int
+    ArnoldiProcess<Number>::orthonormalize_block(
+      const unsigned int                        n,
+      const unsigned int                        s,
+      TmpVectors<VectorType>                   &orthogonal_vectors,
+      const std::vector<double>                &shifts,
+      const unsigned int                        accumulated_iterations,
+      const boost::signals2::signal<void(int)> &reorthogonalize_signal)
+    {
+      Assert(n > 0, ExcInternalError());
+      Assert(s > 0, ExcInternalError());
+      AssertIndexRange(n + s - 2, hessenberg_matrix.n());
+      AssertIndexRange(n + s - 1, orthogonal_vectors.size() + 1);
+      AssertDimension(shifts.size(), s);
+      AssertDimension(givens_rotations.size(), n - 1);
+
+      // The new vectors V are written as V = Q * R12 + Q_new * R22 with the
+      // existing orthonormal vectors Q, the orthonormalized new vectors
+      // Q_new, and an upper triangular matrix R22. Both factors are computed
+      // from the inner products Q^T V and V^T V that are obtained with a
+      // single global reduction, using the Pythagorean theorem to form the
+      // Gram matrix of V - Q R12 and a Cholesky factorization of it.
+      FullMatrix<double> r12(n, s), r22(s, s), gram(s, s);
+      FullMatrix<double> r12_pass(n, s), r22_pass(s, s);
+      Vector<double>     products, coefficients;
+
+      const double eps =
+        std::numeric_limits<typename VectorType::value_type>::epsilon();
+
+      // number of Hessenberg columns that can be recovered, which is reduced
+      // in case of a breakdown
+      unsigned int n_valid_columns = s;
+
+      // run up to two passes with index 0: orthogonalize, 1: reorthogonalize
+      for (unsigned int pass = 0; pass < 2; ++pass)
+        {
+          block_inner_products(n, s, orthogonal_vectors, products, vector_ptrs);
+
+          unsigned int offset = 0;
+          for (unsigned int k = 0; k < s; ++k)
+            {
+              for (unsigned int i = 0; i < n; ++i)
+                r12_pass(i, k) = products(offset + i);
+              for (unsigned int j = 0; j <= k; ++j)
+                gram(j, k) = products(offset + n + j);
+              offset += n + k + 1;
+            }
+
+          // Cholesky factorization of V^T V - R12^T R12. If the diagonal
+          // entry is small compared to the norm of the vector before the
+          // orthogonalization, we have lost the information about the new
+          // direction in roundoff, using the criterion of
+          // orthonormalize_nth_vector() for the squared norms. In the first
+          // pass, this indicates loss of orthogonality, and we proceed with
+          // a safe value to be corrected by the second pass. In the second
+          // pass, the vector lies in the span of the previous vectors, which
+          // is a (lucky) breakdown.
+          bool loss_of_orthogonality = false;
+          r22_pass                   = 0.;
+          for (unsigned int k = 0; k < n_valid_columns; ++k)
+            {
+              for (unsigned int j = 0; j <= k; ++j)
+                {
+                  double sum = gram(j, k);
+                  for (unsigned int i = 0; i < n; ++i)
+                    sum -= r12_pass(i, j) * r12_pass(i, k);
+                  for (unsigned int l = 0; l < j; ++l)
+                    sum -= r22_pass(l, j) * r22_pass(l, k);
+
+                  const double threshold = 100. * eps * gram(k, k);
+                  if (j < k)
+                    r22_pass(j, k) = sum / r22_pass(j, j);
+                  else if (sum > threshold)
+                    r22_pass(k, k) = std::sqrt(sum);
+                  else if (pass == 0)
+                    {
+                      loss_of_orthogonality = true;
+                      r22_pass(k, k)        = std::sqrt(threshold);
+                    }
+                  else
+                    n_valid_columns = k + 1;
+                }
+              if (r22_pass(k, k) == 0.)
+                break;
+            }
+
+          // subtract the contributions of the previous vectors and scale by
+          // the inverse of R22, working on one vector after the other
+          for (unsigned int k = 0; k < n_valid_columns; ++k)
+            {
+              coefficients.reinit(n + k);
+              for (unsigned int i = 0; i < n; ++i)
+                coefficients(i) = -r12_pass(i, k);
+              for (unsigned int j = 0; j < k; ++j)
+                coefficients(n + j) = -r22_pass(j, k);
+              add(orthogonal_vectors[n + k],
+                  n + k,
+                  coefficients,
+                  orthogonal_vectors,
+                  false,
+                  vector_ptrs);
+
+              // r22_pass(k, k) is zero for a lucky breakdown, the solver will
+              // reach convergence, but we must not divide by zero here.
+              if (r22_pass(k, k) != 0.)
+                orthogonal_vectors[n + k] /= r22_pass(k, k);
+            }
+
+          // accumulate the factors of the two passes: with V = Q R12 + W R22
+          // from the first pass and W = Q R12' + Q_new R22' from the second
+          // pass, we get V = Q (R12 + R12' R22) + Q_new R22' R22
+          if (pass == 0)
+            {
+              r12 = r12_pass;
+              r22 = r22_pass;
+            }
+          else
+            {
+              for (unsigned int k = 0; k < s; ++k)
+                {
+                  for (unsigned int i = 0; i < n; ++i)
+                    {
+                      double sum = 0;
+                      for (unsigned int l = 0; l <= k; ++l)
+                        sum += r12_pass(i, l) * r22(l, k);
+                      r12(i, k) += sum;
+                    }
+                  for (unsigned int j = 0; j <= k; ++j)
+                    {
+                      double sum = 0;
+                      for (unsigned int l = j; l <= k; ++l)
+                        sum += r22_pass(j, l) * r22(l, k);
+                      r22(j, k) = sum;
+                    }
+                }
+            }
+
+          if (pass == 1)
+            break; // reorthogonalization already performed -> finished
+
+          if (loss_of_orthogonality && do_reorthogonalization == false)
+            {
+              do_reorthogonalization = true;
+              if (!reorthogonalize_signal.empty())
+                reorthogonalize_signal(accumulated_iterations);
+            }
+
+          if (do_reorthogonalization == false && !loss_of_orthogonality)
+            break; // no reorthogonalization needed -> finished
+        }
+
+      // Recover the columns n - 1, ..., n + s - 2 of the Hessenberg matrix.
+      // Collect the coefficients of the vectors v_0, ..., v_s in terms of the
+      // orthonormal basis into the columns of a matrix C, where v_0 is the
+      // last vector of the previous basis. The recursion v_{k+1} = (op -
+      // theta_k I) v_k implies op Q C_in = Q C_out with C_in holding the
+      // columns 0, ..., s - 1 of C and C_out(:, k) = C(:, k + 1) + theta_k
+      // C(:, k), and thus H C_in = C_out. Since the leading columns of H are
+      // known and the trailing rows of C_in form an upper triangular matrix
+      // T, the new columns follow by forward substitution with T.
+      FullMatrix<double> basis_coefficients(n + s, s + 1);
+      basis_coefficients(n - 1, 0) = 1.;
+      for (unsigned int c = 1; c <= s; ++c)
+        {
+          for (unsigned int i = 0; i < n; ++i)
+            basis_coefficients(i, c) = r12(i, c - 1);
+          for (unsigned int j = 0; j < c; ++j)
+            basis_coefficients(n + j, c) = r22(j, c - 1);
+        }
+
+      Vector<double> column(n + s);
+      for (unsigned int c = 0; c < n_valid_columns; ++c)
+        {
+          for (unsigned int i = 0; i < n + c + 1; ++i)
+            column(i) = basis_coefficients(i, c + 1) +
+                        shifts[c] * basis_coefficients(i, c);
+
+          for (unsigned int j = 0; j + 1 < n; ++j)
+            if (basis_coefficients(j, c) != 0.)
+              for (unsigned int i = 0; i < j + 2; ++i)
+                column(i) -= hessenberg_matrix(i, j) * basis_coefficients(j, c);
+
+          for (unsigned int d = 0; d < c; ++d)
+            for (unsigned int i = 0; i < n + d + 1; ++i)
+              column(i) -= hessenberg_matrix(i, n - 1 + d) *
+                           basis_coefficients(n - 1 + d, c);
+
+          const double inverse_diagonal =
+            1. / basis_coefficients(n - 1 + c, c);
+          for (unsigned int i = 0; i < n + c + 1; ++i)
+            hessenberg_matrix(i, n - 1 + c) = column(i) * inverse_diagonal;
+        }
+
+      return n_valid_columns;
+    }
+
+
+
+    template <typename Number>
+    inline double
+    ArnoldiProcess<Number>::factorize_next_column()
+    {
+      AssertIndexRange(givens_rotations.size(), hessenberg_matrix.n());
+      return do_givens_rotation(false,
+                                givens_rotations.size(),
+                                triangular_matrix,
+                                givens_rotations,
+                                projected_rhs);
+    }
+
+
+
+    template <typename Number>
+    inline std::vector<double>
+    ArnoldiProcess<Number>::compute_newton_shifts(
+      const unsigned int n_shifts) const
+    {
+      std::vector<double> shifts(n_shifts, 0.);
+
+#  ifdef DEAL_II_WITH_LAPACK
+      AssertIndexRange(n_shifts, hessenberg_matrix.m());
+
+      LAPACKFullMatrix<double> matrix(n_shifts, n_shifts);
+      for (unsigned int i = 0; i < n_shifts; ++i)
+        for (unsigned int j = 0; j < n_shifts; ++j)
+          matrix(i, j) = hessenberg_matrix(i, j);
+      matrix.compute_eigenvalues();
+
+      std::vector<double> ritz_values(n_shifts);
+      for (unsigned int i = 0; i < n_shifts; ++i)
+        ritz_values[i] = matrix.eigenvalue(i).real();
+
+      // Leja ordering: start with the value of largest magnitude and then
+      // select the value that maximizes the product of distances to the
+      // values selected so far
+      for (unsigned int k = 0; k < n_shifts; ++k)
+        {
+          unsigned int next     = k;
+          double       best_fit = -1.;
+          for (unsigned int i = k; i < n_shifts; ++i)
+            {
+              double fit = std::abs(ritz_values[i]);
+              if (k > 0)
+                {
+                  fit = 1.;
+                  for (unsigned int j = 0; j < k; ++j)
+                    fit *= std::abs(ritz_values[i] - ritz_values[j]);
+                }
+              if (fit > best_fit)
+                {
+                  best_fit = fit;
+                  next     = i;
+                }
+            }
+          std::swap(ritz_values[k], ritz_values[next]);
+          shifts[k] = ritz_values[k];
+        }
+#  endif
+
+      return shifts;
+    }
+
+
+
     template <typename Number>
     inline double
     ArnoldiProcess<Number>::do_givens_rotation(
@@ -1695,10 +2179,12 @@ namespace internal
       // GMRES) and we can safely overwrite the content of the tridiagonal
       // matrix and right hand side, and the case during the inner iterations,
       // where we need to create copies of the matrices in the QR
-      // decomposition as well as the right hand side.
-      if (orthogonalization_strategy ==
-          LinearAlgebra::OrthogonalizationStrategy::
-            delayed_classical_gram_schmidt)
+      // decomposition as well as the right hand side. The s-step variant
+      // does not use the delayed orthogonalization.
+      if (s_step_size == 1 &&
+          orthogonalization_strategy ==
+            LinearAlgebra::OrthogonalizationStrategy::
+              delayed_classical_gram_schmidt)
         {
           n += 1;
           if (!orthogonalization_finished)
@@ -1879,7 +2365,16 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
 
   arnoldi_process.initialize(additional_data.orthogonalization_strategy,
                              basis_size,
-                             additional_data.force_re_orthogonalization);
+                             additional_data.force_re_orthogonalization,
+                             additional_data.s_step_size);
+
+  // shifts for generating the vectors in the s-step variant; they are zero
+  // for the monomial basis and for the first block with the Newton basis,
+  // and are then set from the Ritz values of the first block
+  const unsigned int  s_step_size = additional_data.s_step_size;
+  std::vector<double> s_step_shifts(s_step_size, 0.);
+  bool                compute_shifts =
+    additional_data.s_step_basis == AdditionalData::SStepBasis::newton;
 
   ///////////////////////////////////////////////////////////////////////////
   // outer iteration: loop until we either reach convergence or the maximum
@@ -1959,6 +2454,11 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
             break;
         }
 
+      // size of the current block of the s-step variant and the number of
+      // its columns already used in the inner iteration
+      unsigned int block_size     = 0;
+      unsigned int block_position = 0;
+
       // inner iteration doing at most as many steps as the size of the
       // Arnoldi basis
       unsigned int inner_iteration = 0;
@@ -1967,25 +2467,82 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
            ++inner_iteration)
         {
           ++accumulated_iterations;
-          // yet another alias
-          VectorType &vv = basis_vectors(inner_iteration + 1, x);
 
-          if (left_precondition)
+          if (s_step_size == 1)
             {
-              A.vmult(p, basis_vectors[inner_iteration]);
-              preconditioner.vmult(vv, p);
+              // yet another alias
+              VectorType &vv = basis_vectors(inner_iteration + 1, x);
+
+              if (left_precondition)
+                {
+                  A.vmult(p, basis_vectors[inner_iteration]);
+                  preconditioner.vmult(vv, p);
+                }
+              else
+                {
+                  preconditioner.vmult(p, basis_vectors[inner_iteration]);
+                  A.vmult(vv, p);
+                }
+
+              res = arnoldi_process.orthonormalize_nth_vector(
+                inner_iteration + 1,
+                basis_vectors,
+                accumulated_iterations,
+                re_orthogonalize_signal);
             }
           else
             {
-              preconditioner.vmult(p, basis_vectors[inner_iteration]);
-              A.vmult(vv, p);
-            }
+              // in the s-step variant, generate the next block of vectors
+              // and orthonormalize it once all columns of the Hessenberg
+              // matrix from the previous block have been used
+              if (block_position == block_size)
+                {
+                  block_size =
+                    std::min(s_step_size, basis_size - inner_iteration);
+                  const std::vector<double> block_shifts(
+                    s_step_shifts.begin(), s_step_shifts.begin() + block_size);
 
-          res =
-            arnoldi_process.orthonormalize_nth_vector(inner_iteration + 1,
-                                                      basis_vectors,
-                                                      accumulated_iterations,
-                                                      re_orthogonalize_signal);
+                  for (unsigned int k = 0; k < block_size; ++k)
+                    {
+                      VectorType &vv =
+                        basis_vectors(inner_iteration + k + 1, x);
+                      const VectorType &source =
+                        basis_vectors[inner_iteration + k];
+
+                      if (left_precondition)
+                        {
+                          A.vmult(p, source);
+                          preconditioner.vmult(vv, p);
+                        }
+                      else
+                        {
+                          preconditioner.vmult(p, source);
+                          A.vmult(vv, p);
+                        }
+                      if (block_shifts[k] != 0.)
+                        vv.add(-block_shifts[k], source);
+                    }
+
+                  block_size = arnoldi_process.orthonormalize_block(
+                    inner_iteration + 1,
+                    block_size,
+                    basis_vectors,
+                    block_shifts,
+                    accumulated_iterations,
+                    re_orthogonalize_signal);
+                  block_position = 0;
+
+                  if (compute_shifts && block_size == s_step_size)
+                    {
+                      s_step_shifts =
+                        arnoldi_process.compute_newton_shifts(s_step_size);
+                      compute_shifts = false;
+                    }
+                }
+
+              res = arnoldi_process.factorize_next_column();
+              ++block_position;
+            }
 
           if (use_default_residual)
             {
@@ -0,0 +1,354 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_mixed_precision_h
+#define dealii_solver_mixed_precision_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/logstream.h>
+
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_memory.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * A solver for the linear system $Ax=b$ based on mixed-precision iterative
+ * refinement (also called defect correction). The outer iteration of this
+ * class computes the residual $r_k = b - Ax_k$ in the precision of
+ * @p VectorType, typically double precision, and checks for convergence in
+ * the norm of this residual. The correction is then obtained by an
+ * approximate solution of $A d_k = r_k$ with an inner iterative solver of
+ * type @p InnerSolverType that runs on vectors of a lower precision, typically
+ * single precision, and the approximation is updated by $x_{k+1} = x_k +
+ * d_k$. All conversions between the two vector types are done by this class.
+ * The template argument @p VectorType denotes the vector type of the outer
+ * iteration, whereas the vector type of the inner iteration is given by the
+ * type <tt>InnerSolverType::vector_type</tt>.
+ *
+ * Since most iterative solvers are limited by the memory bandwidth, the
+ * inner solver with single-precision vectors (and possibly a
+ * single-precision matrix and preconditioner, as for example given by
+ * MatrixFree<dim,float>) runs up to twice as fast as the same solver in
+ * double precision. As long as the inner solver reduces the residual by
+ * some factor in each outer iteration, the outer iteration converges to the
+ * accuracy of the outer precision, so that tolerances below the accuracy of
+ * single precision can be reached. The inner solves start from a zero
+ * initial guess and thus act as a restart of the inner method in every
+ * outer iteration.
+ *
+ * The inner solves are controlled by a ReductionControl object that stops
+ * once the residual is reduced by the factor AdditionalData::inner_reduction
+ * or after AdditionalData::inner_max_iterations iterations. If the inner
+ * solver does not converge within this number of iterations, the approximate
+ * correction computed so far is used nonetheless.
+ *
+ * A typical use with a matrix-free operator and multigrid preconditioner set
+ * up in single precision looks as follows:
+ * @code
+ *   using VectorType      = LinearAlgebra::distributed::Vector<double>;
+ *   using VectorTypeFloat = LinearAlgebra::distributed::Vector<float>;
+ *
+ *   SolverControl solver_control(100, 1e-12 * system_rhs.l2_norm());
+ *   SolverMixedPrecision<VectorType, SolverCG<VectorTypeFloat>> solver(
+ *     solver_control);
+ *   solver.solve(system_matrix,       // operator on double vectors
+ *                solution,
+ *                system_rhs,
+ *                system_matrix_float, // operator on float vectors
+ *                preconditioner);     // preconditioner on float vectors
+ * @endcode
+ *
+ * The inner solver needs to be a class with a constructor taking a
+ * SolverControl object, a VectorMemory object for the inner vector type, and
+ * an AdditionalData object, as is the case for all solvers derived from
+ * SolverBase. The vector type of the inner solver must be convertible from
+ * and to @p VectorType by means of its <tt>reinit()</tt> and assignment
+ * operators, which is the case for the different precisions of
+ * LinearAlgebra::distributed::Vector, Vector, and BlockVector.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence of the outer iteration. This
+ * mechanism can also be used to observe the progress of the iteration.
+ */
+template <typename VectorType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverMixedPrecision : public SolverBase<VectorType>
+{
+public:
+  /**
+   * The vector type of the inner solver.
+   */
+  using InnerVectorType = typename InnerSolverType::vector_type;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. By default, the inner solver reduces the residual by a
+     * factor of 100 with at most 100 iterations.
+     */
+    explicit AdditionalData(
+      const double       inner_reduction      = 1e-2,
+      const unsigned int inner_max_iterations = 100,
+      const typename InnerSolverType::AdditionalData &inner_solver_data =
+        typename InnerSolverType::AdditionalData());
+
+    /**
+     * Factor by which the inner solver reduces the residual in each outer
+     * iteration. Values between 1e-1 and 1e-4 are typical choices, as
+     * smaller values cannot be reached reliably in single precision.
+     */
+    double inner_reduction;
+
+    /**
+     * Maximum number of iterations of the inner solver in each outer
+     * iteration.
+     */
+    unsigned int inner_max_iterations;
+
+    /**
+     * Additional data passed to the inner solver.
+     */
+    typename InnerSolverType::AdditionalData inner_solver_data;
+  };
+
+  /**
+   * Constructor.
+   */
+  SolverMixedPrecision(SolverControl            &cn,
+                       VectorMemory<VectorType> &mem,
+                       const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverMixedPrecision(SolverControl        &cn,
+                       const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x. The matrix @p A is applied to
+   * vectors of type @p VectorType to compute the residual in the outer
+   * iteration, whereas @p inner_matrix and @p inner_preconditioner are used
+   * by the inner solver and act on vectors of type InnerVectorType.
+   */
+  template <typename MatrixType,
+            typename InnerMatrixType,
+            typename InnerPreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<InnerMatrixType, InnerVectorType> &&
+     concepts::is_linear_operator_on<InnerPreconditionerType,
+                                     InnerVectorType>))
+  void solve(const MatrixType              &A,
+             VectorType                    &x,
+             const VectorType              &b,
+             const InnerMatrixType         &inner_matrix,
+             const InnerPreconditionerType &inner_preconditioner);
+
+  /**
+   * Solve the linear system $Ax=b$ for x, using the same matrix @p A in the
+   * outer and the inner iteration. This requires the matrix to provide
+   * <tt>vmult()</tt> functions for both @p VectorType and InnerVectorType,
+   * as is the case, e.g., for SparseMatrix.
+   */
+  template <typename MatrixType, typename InnerPreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<MatrixType, InnerVectorType> &&
+     concepts::is_linear_operator_on<InnerPreconditionerType,
+                                     InnerVectorType>))
+  void solve(const MatrixType              &A,
+             VectorType                    &x,
+             const VectorType              &b,
+             const InnerPreconditionerType &inner_preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * Memory pool for the vectors of the inner solver.
+   */
+  GrowingVectorMemory<InnerVectorType> inner_memory;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename VectorType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+inline SolverMixedPrecision<VectorType, InnerSolverType>::AdditionalData::
+  AdditionalData(
+    const double                                    inner_reduction,
+    const unsigned int                              inner_max_iterations,
+    const typename InnerSolverType::AdditionalData &inner_solver_data)
+  : inner_reduction(inner_reduction)
+  , inner_max_iterations(inner_max_iterations)
+  , inner_solver_data(inner_solver_data)
+{
+  Assert(inner_reduction > 0. && inner_reduction < 1.,
+         ExcMessage("The reduction of the inner solver must be between zero "
+                    "and one."));
+}
+
+
+
+template <typename VectorType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverMixedPrecision<VectorType, InnerSolverType>::SolverMixedPrecision(
+  SolverControl            &cn,
+  VectorMemory<VectorType> &mem,
+  const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverMixedPrecision<VectorType, InnerSolverType>::SolverMixedPrecision(
+  SolverControl        &cn,
+  const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType,
+          typename InnerMatrixType,
+          typename InnerPreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<InnerMatrixType, InnerVectorType> &&
+   concepts::is_linear_operator_on<InnerPreconditionerType, InnerVectorType>))
+void SolverMixedPrecision<VectorType, InnerSolverType>::solve(
+  const MatrixType              &A,
+  VectorType                    &x,
+  const VectorType              &b,
+  const InnerMatrixType         &inner_matrix,
+  const InnerPreconditionerType &inner_preconditioner)
+{
+  LogStream::Prefix prefix("MixedPrecision");
+
+  SolverControl::State conv = SolverControl::iterate;
+
+  // Memory allocation
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  VectorType                                &r = *r_pointer;
+  r.reinit(x, true);
+
+  typename VectorMemory<InnerVectorType>::Pointer inner_r_pointer(
+    inner_memory);
+  typename VectorMemory<InnerVectorType>::Pointer inner_d_pointer(
+    inner_memory);
+  InnerVectorType &inner_r = *inner_r_pointer;
+  InnerVectorType &inner_d = *inner_d_pointer;
+  inner_r.reinit(x, true);
+  inner_d.reinit(x, true);
+
+  double       res  = 0;
+  unsigned int iter = 0;
+  for (;; ++iter)
+    {
+      // compute the residual in the outer precision
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+      res = r.l2_norm();
+
+      conv = this->iteration_status(iter, res, x);
+      if (conv != SolverControl::iterate)
+        break;
+
+      // solve for the correction in the inner precision, starting from a
+      // zero initial guess. If the inner solver does not reach the desired
+      // reduction, the correction is typically still good enough to make
+      // progress, so we continue with it.
+      inner_r = r;
+      inner_d = 0;
+
+      ReductionControl inner_control(additional_data.inner_max_iterations,
+                                     0.,
+                                     additional_data.inner_reduction);
+      InnerSolverType  inner_solver(inner_control,
+                                   inner_memory,
+                                   additional_data.inner_solver_data);
+      try
+        {
+          inner_solver.solve(inner_matrix,
+                             inner_d,
+                             inner_r,
+                             inner_preconditioner);
+        }
+      catch (const SolverControl::NoConvergence &)
+        {}
+
+      // update the solution in the outer precision, using r as temporary
+      // storage for the converted correction
+      r = inner_d;
+      x += r;
+    }
+
+  // in case of failure: throw exception
+  AssertThrow(conv == SolverControl::success,
+              SolverControl::NoConvergence(iter, res));
+  // otherwise exit as normal
+}
+
+
+
+template <typename VectorType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename InnerPreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<MatrixType, InnerVectorType> &&
+   concepts::is_linear_operator_on<InnerPreconditionerType, InnerVectorType>))
+void SolverMixedPrecision<VectorType, InnerSolverType>::solve(
+  const MatrixType              &A,
+  VectorType                    &x,
+  const VectorType              &b,
+  const InnerPreconditionerType &inner_preconditioner)
+{
+  solve(A, x, b, A, inner_preconditioner);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
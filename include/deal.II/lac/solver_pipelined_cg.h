@@ -0,0 +1,675 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_pipelined_cg_h
+#define dealii_solver_pipelined_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/template_constraints.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+// forward declaration
+#ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  }
+} // namespace LinearAlgebra
+#endif
+
+
+/** @addtogroup Solvers */
+/** @{ */
+
+/**
+ * This class implements the pipelined preconditioned conjugate gradient
+ * method by Ghysels and Vanroose (P. Ghysels, W. Vanroose: "Hiding global
+ * synchronization latency in the preconditioned Conjugate Gradient
+ * algorithm", Parallel Computing 40(7), pp. 224-238, 2014). It solves the
+ * same class of problems as SolverCG, i.e., linear systems with a symmetric
+ * positive definite matrix and a symmetric positive definite preconditioner,
+ * and is algebraically equivalent to SolverCG in exact arithmetic.
+ *
+ * The classical CG method computes two inner products per iteration, each of
+ * which constitutes a global synchronization point in parallel: The
+ * computation can only proceed once the result of the
+ * <code>MPI_Allreduce</code> operation is available on all processes. For
+ * large process counts and cheap operators (e.g. matrix-free operators with
+ * a moderate number of unknowns per process), the latency of these
+ * reductions can dominate the run time of the solver. The pipelined variant
+ * rearranges the recurrences of the CG method by introducing additional
+ * auxiliary vectors such that
+ * <ul>
+ * <li> all inner products of one iteration, namely $\gamma_i = (r_i, u_i)$,
+ * $\delta_i = (w_i, u_i)$ and the squared residual norm $(r_i, r_i)$ used
+ * for the convergence check, are combined into a single reduction, and </li>
+ * <li> this reduction is independent of the application of the
+ * preconditioner and the matrix-vector product in the same iteration, such
+ * that the global communication can be overlapped with these two
+ * operations. </li>
+ * </ul>
+ * Here, $r_i$ denotes the residual, $u_i = P^{-1} r_i$ the preconditioned
+ * residual and $w_i = A u_i$.
+ *
+ * The price to pay is a higher number of vectors (ten vectors of the size of
+ * the solution vector instead of four in SolverCG) and eight vector updates
+ * per iteration. For LinearAlgebra::distributed::Vector and
+ * dealii::Vector, all of these updates and the local part of the inner
+ * products are merged into a single sweep through the vector entries, and
+ * the reduction is started with a non-blocking <code>MPI_Iallreduce</code>
+ * operation that completes after the matrix-vector product has finished. As
+ * a consequence, the solver is expected to be faster than SolverCG once the
+ * run time of an iteration is dominated by the global reductions rather than
+ * by the memory transfer in the vector updates. For other vector types, the
+ * same algorithm is run with the regular vector interface and blocking inner
+ * products, which is mostly useful for testing purposes.
+ *
+ * @note The residual that is passed to the SolverControl object is the
+ * recursively updated residual as in the default setting of SolverCG.
+ * Because the recurrences of the pipelined method are different, round-off
+ * errors can make the recursively computed residual deviate from the true
+ * residual $b-Ax$ at a somewhat higher level than in SolverCG, which can
+ * become visible for very strict tolerances. Furthermore, the matrix-vector
+ * product and the preconditioner are applied once more in the last iteration
+ * than strictly necessary, as the convergence check is only available once
+ * the overlapped reduction has completed.
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver. There is
+   * no data in here for this class.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverPipelinedCG(SolverControl            &cn,
+                    VectorMemory<VectorType> &mem,
+                    const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverPipelinedCG(SolverControl        &cn,
+                    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~SolverPipelinedCG() override = default;
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Interface for derived class. This function gets the current iteration
+   * vector, the residual and the update vector in each step. It can be used
+   * for graphical output of the convergence history.
+   */
+  virtual void
+  print_vectors(const unsigned int step,
+                const VectorType  &x,
+                const VectorType  &r,
+                const VectorType  &p) const;
+
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverPipelinedCG
+  {
+    // Check whether the vector type gives access to the locally owned range
+    // of entries as a contiguous array, which allows us to merge the vector
+    // updates and the local part of the inner products into a single loop
+    // and to split the global reduction into a start and a finish phase.
+    template <typename VectorType>
+    constexpr bool is_dealii_compatible_vector =
+      std::is_same_v<
+        VectorType,
+        LinearAlgebra::distributed::Vector<typename VectorType::value_type,
+                                           MemorySpace::Host>> ||
+      std::is_same_v<VectorType, Vector<typename VectorType::value_type>>;
+
+
+
+    // Implementation of the vector updates and inner products for general
+    // vector types, using the operations of the generic vector interface.
+    // The inner products are computed in a blocking way.
+    template <typename VectorType, typename = void>
+    class VectorOperations
+    {
+    public:
+      using Number = typename VectorType::value_type;
+
+      void
+      compute_inner_products(const VectorType &r,
+                             const VectorType &u,
+                             const VectorType &w)
+      {
+        results = {{r * u, w * u, r * r}};
+      }
+
+      void
+      start_reduction(const VectorType &)
+      {}
+
+      const std::array<Number, 3> &
+      finish_reduction()
+      {
+        return results;
+      }
+
+      void
+      update_vectors(const bool        first_iteration,
+                     const Number      alpha,
+                     const Number      beta,
+                     const VectorType &m,
+                     const VectorType &n,
+                     VectorType       &z,
+                     VectorType       &q,
+                     VectorType       &s,
+                     VectorType       &p,
+                     VectorType       &x,
+                     VectorType       &r,
+                     VectorType       &u,
+                     VectorType       &w)
+      {
+        if (first_iteration)
+          {
+            z.equ(1., n);
+            q.equ(1., m);
+            s.equ(1., w);
+            p.equ(1., u);
+          }
+        else
+          {
+            z.sadd(beta, 1., n);
+            q.sadd(beta, 1., m);
+            s.sadd(beta, 1., w);
+            p.sadd(beta, 1., u);
+          }
+        x.add(alpha, p);
+        r.add(-alpha, s);
+        u.add(-alpha, q);
+        w.add(-alpha, z);
+
+        compute_inner_products(r, u, w);
+      }
+
+    private:
+      std::array<Number, 3> results;
+    };
+
+
+
+    // Implementation of the vector updates and inner products for deal.II's
+    // own vector types on the host: All updates of an iteration are done in
+    // a single loop that also accumulates the local part of the next inner
+    // products, and the reduction across MPI processes is done by a
+    // non-blocking collective that can run in the background during the
+    // application of the preconditioner and the matrix.
+    template <typename VectorType>
+    class VectorOperations<
+      VectorType,
+      std::enable_if_t<is_dealii_compatible_vector<VectorType>>>
+    {
+    public:
+      using Number = typename VectorType::value_type;
+
+      VectorOperations()
+        : request(MPI_REQUEST_NULL)
+      {}
+
+      ~VectorOperations()
+      {
+        // do not leave a pending request behind in case of an exception;
+        // errors can not be reported from a destructor, so ignore them
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          MPI_Wait(&request, MPI_STATUS_IGNORE);
+#  endif
+      }
+
+      void
+      compute_inner_products(const VectorType &r,
+                             const VectorType &u,
+                             const VectorType &w)
+      {
+        const Number     *r_ptr = r.begin();
+        const Number     *u_ptr = u.begin();
+        const Number     *w_ptr = w.begin();
+        const std::size_t size  = r.end() - r.begin();
+
+        std::array<Number, 3> sums{{Number(), Number(), Number()}};
+
+        std::size_t i = 0;
+        if constexpr (std::is_floating_point_v<Number>)
+          {
+            constexpr unsigned int  n_lanes = VectorizedArray<Number>::size();
+            VectorizedArray<Number> vsums[3];
+            for (unsigned int d = 0; d < 3; ++d)
+              vsums[d] = Number();
+            for (; i + n_lanes <= size; i += n_lanes)
+              {
+                VectorizedArray<Number> rv, uv, wv;
+                rv.load(r_ptr + i);
+                uv.load(u_ptr + i);
+                wv.load(w_ptr + i);
+                vsums[0] += rv * uv;
+                vsums[1] += wv * uv;
+                vsums[2] += rv * rv;
+              }
+            for (unsigned int d = 0; d < 3; ++d)
+              sums[d] = vsums[d].sum();
+          }
+        for (; i < size; ++i)
+          {
+            const Number u_conj = numbers::NumberTraits<Number>::conjugate(
+              u_ptr[i]);
+            sums[0] += r_ptr[i] * u_conj;
+            sums[1] += w_ptr[i] * u_conj;
+            sums[2] += r_ptr[i] * numbers::NumberTraits<Number>::conjugate(
+                                    r_ptr[i]);
+          }
+        results = sums;
+      }
+
+      void
+      start_reduction(const VectorType &vector)
+      {
+#  ifdef DEAL_II_WITH_MPI
+        const MPI_Comm comm = vector.get_mpi_communicator();
+        if (Utilities::MPI::job_supports_mpi() &&
+            Utilities::MPI::n_mpi_processes(comm) > 1)
+          {
+            const int ierr =
+              MPI_Iallreduce(MPI_IN_PLACE,
+                             results.data(),
+                             results.size(),
+                             Utilities::MPI::mpi_type_id_for_type<Number>,
+                             MPI_SUM,
+                             comm,
+                             &request);
+            AssertThrowMPI(ierr);
+          }
+#  else
+        (void)vector;
+#  endif
+      }
+
+      const std::array<Number, 3> &
+      finish_reduction()
+      {
+        wait();
+        return results;
+      }
+
+      void
+      update_vectors(const bool        first_iteration,
+                     const Number      alpha,
+                     const Number      beta_in,
+                     const VectorType &m,
+                     const VectorType &n,
+                     VectorType       &z,
+                     VectorType       &q,
+                     VectorType       &s,
+                     VectorType       &p,
+                     VectorType       &x,
+                     VectorType       &r,
+                     VectorType       &u,
+                     VectorType       &w)
+      {
+        const Number *m_ptr = m.begin();
+        const Number *n_ptr = n.begin();
+        Number       *z_ptr = z.begin();
+        Number       *q_ptr = q.begin();
+        Number       *s_ptr = s.begin();
+        Number       *p_ptr = p.begin();
+        Number       *x_ptr = x.begin();
+        Number       *r_ptr = r.begin();
+        Number       *u_ptr = u.begin();
+        Number       *w_ptr = w.begin();
+
+        const std::size_t size = r.end() - r.begin();
+
+        // In the first iteration, the vectors z, q, s, p are not
+        // initialized yet, so we must not multiply them by beta (which is
+        // zero) because they might contain NaN.
+        if (first_iteration)
+          for (std::size_t i = 0; i < size; ++i)
+            {
+              z_ptr[i] = n_ptr[i];
+              q_ptr[i] = m_ptr[i];
+              s_ptr[i] = w_ptr[i];
+              p_ptr[i] = u_ptr[i];
+            }
+        const Number beta = first_iteration ? Number() : beta_in;
+
+        std::array<Number, 3> sums{{Number(), Number(), Number()}};
+
+        std::size_t i = 0;
+        if constexpr (std::is_floating_point_v<Number>)
+          {
+            constexpr unsigned int  n_lanes = VectorizedArray<Number>::size();
+            VectorizedArray<Number> vsums[3];
+            for (unsigned int d = 0; d < 3; ++d)
+              vsums[d] = Number();
+            for (; i + n_lanes <= size; i += n_lanes)
+              {
+                VectorizedArray<Number> zv, qv, sv, pv, tmp;
+                zv.load(z_ptr + i);
+                tmp.load(n_ptr + i);
+                zv = tmp + beta * zv;
+                zv.store(z_ptr + i);
+                qv.load(q_ptr + i);
+                tmp.load(m_ptr + i);
+                qv = tmp + beta * qv;
+                qv.store(q_ptr + i);
+                sv.load(s_ptr + i);
+                tmp.load(w_ptr + i);
+                sv = tmp + beta * sv;
+                sv.store(s_ptr + i);
+                pv.load(p_ptr + i);
+                tmp.load(u_ptr + i);
+                pv = tmp + beta * pv;
+                pv.store(p_ptr + i);
+
+                VectorizedArray<Number> xv, rv, uv, wv;
+                xv.load(x_ptr + i);
+                xv += alpha * pv;
+                xv.store(x_ptr + i);
+                rv.load(r_ptr + i);
+                rv -= alpha * sv;
+                rv.store(r_ptr + i);
+                uv = tmp - alpha * qv;
+                uv.store(u_ptr + i);
+                wv.load(w_ptr + i);
+                wv -= alpha * zv;
+                wv.store(w_ptr + i);
+
+                vsums[0] += rv * uv;
+                vsums[1] += wv * uv;
+                vsums[2] += rv * rv;
+              }
+            for (unsigned int d = 0; d < 3; ++d)
+              sums[d] = vsums[d].sum();
+          }
+        for (; i < size; ++i)
+          {
+            z_ptr[i] = n_ptr[i] + beta * z_ptr[i];
+            q_ptr[i] = m_ptr[i] + beta * q_ptr[i];
+            s_ptr[i] = w_ptr[i] + beta * s_ptr[i];
+            p_ptr[i] = u_ptr[i] + beta * p_ptr[i];
+            x_ptr[i] += alpha * p_ptr[i];
+            r_ptr[i] -= alpha * s_ptr[i];
+            u_ptr[i] -= alpha * q_ptr[i];
+            w_ptr[i] -= alpha * z_ptr[i];
+
+            const Number u_conj = numbers::NumberTraits<Number>::conjugate(
+              u_ptr[i]);
+            sums[0] += r_ptr[i] * u_conj;
+            sums[1] += w_ptr[i] * u_conj;
+            sums[2] += r_ptr[i] * numbers::NumberTraits<Number>::conjugate(
+                                    r_ptr[i]);
+          }
+        results = sums;
+      }
+
+    private:
+      void
+      wait()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+#  endif
+      }
+
+      std::array<Number, 3> results;
+
+      MPI_Request request;
+    };
+  } // namespace SolverPipelinedCG
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl            &cn,
+                                                 VectorMemory<VectorType> &mem,
+                                                 const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl        &cn,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+void SolverPipelinedCG<VectorType>::print_vectors(const unsigned int,
+                                                  const VectorType &,
+                                                  const VectorType &,
+                                                  const VectorType &) const
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverPipelinedCG<VectorType>::solve(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  using Number = typename VectorType::value_type;
+
+  LogStream::Prefix prefix("pipelined_cg");
+
+  // The naming of the vectors follows Algorithm 4 in the paper by Ghysels
+  // and Vanroose: 'r' is the residual, 'u' the preconditioned residual,
+  // 'w = A u', 'm = P^{-1} w', 'n = A m', and 'z', 'q', 's', 'p' are the
+  // search direction 'p' and its images under the operators.
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer m_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer n_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer s_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &u = *u_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &m = *m_pointer;
+  VectorType &n = *n_pointer;
+  VectorType &z = *z_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &p = *p_pointer;
+
+  // Initialize without setting the vector entries, as those will be
+  // overwritten before they are read
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  m.reinit(x, true);
+  n.reinit(x, true);
+  z.reinit(x, true);
+  q.reinit(x, true);
+  s.reinit(x, true);
+  p.reinit(x, true);
+
+  // compute residual. if vector is zero, then short-circuit the full
+  // computation
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+
+  preconditioner.vmult(u, r);
+  A.vmult(w, u);
+
+  internal::SolverPipelinedCG::VectorOperations<VectorType> operations;
+  operations.compute_inner_products(r, u, w);
+
+  SolverControl::State solver_state  = SolverControl::iterate;
+  double               residual_norm = 0.;
+  Number               alpha         = Number();
+  Number               gamma         = Number();
+  unsigned int         it            = 0;
+
+  while (true)
+    {
+      // Start the reduction of (r,u), (w,u), (r,r) and hide its latency
+      // behind the preconditioner and the matrix-vector product
+      operations.start_reduction(x);
+
+      preconditioner.vmult(m, w);
+      A.vmult(n, m);
+
+      const std::array<Number, 3> &inner_products =
+        operations.finish_reduction();
+
+      residual_norm = std::sqrt(std::abs(inner_products[2]));
+      solver_state  = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      const Number previous_gamma = gamma;
+      const Number delta          = inner_products[1];
+      gamma                       = inner_products[0];
+
+      Number beta = Number();
+      if (it == 0)
+        {
+          Assert(std::abs(delta) != 0., ExcDivideByZero());
+          alpha = gamma / delta;
+        }
+      else
+        {
+          Assert(std::abs(previous_gamma) != 0., ExcDivideByZero());
+          beta                     = gamma / previous_gamma;
+          const Number denominator = delta - beta * gamma / alpha;
+          Assert(std::abs(denominator) != 0., ExcDivideByZero());
+          alpha = gamma / denominator;
+        }
+
+      operations.update_vectors(it == 0,
+                                alpha,
+                                beta,
+                                m,
+                                n,
+                                z,
+                                q,
+                                s,
+                                p,
+                                x,
+                                r,
+                                u,
+                                w);
+
+      ++it;
+
+      print_vectors(it, x, r, p);
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,511 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_amg_h
+#define dealii_sparse_amg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/mg_level_object.h>
+
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+// forward declarations
+#ifndef DOXYGEN
+template <int dim, int spacedim>
+class DoFHandler;
+template <typename VectorType>
+class Multigrid;
+#endif
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * A multigrid transfer between the levels of an algebraic multigrid
+ * hierarchy, given by a sparse prolongation matrix for each level but the
+ * coarsest one. The restriction is the transpose of the prolongation, which
+ * is stored explicitly so that both operations are matrix-vector products
+ * with a SparseMatrix and run in parallel on several threads.
+ *
+ * The objects of this class are typically set up by SparseAMG, which uses
+ * them in its own V-cycle, but they can also be combined with the level
+ * matrices of SparseAMG in a Multigrid and a PreconditionMG object, e.g., to
+ * use smoothers other than the ones provided by SparseAMG. The functions
+ * copy_to_mg(), copy_from_mg(), and copy_from_mg_add() take a DoFHandler
+ * argument only for compatibility with PreconditionMG; it is not used.
+ */
+class MGTransferSparseAMG : public MGTransferBase<Vector<double>>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Set up the transfer from the given prolongation matrices. The matrix on
+   * level $l$ prolongates from level $l-1$ to level $l$, i.e., it has as many
+   * rows as there are unknowns on level $l$ and as many columns as there are
+   * unknowns on level $l-1$. The entry on the minimal level is not used.
+   */
+  void
+  initialize(const MGLevelObject<std::shared_ptr<const SparseMatrix<double>>>
+               &prolongation_matrices);
+
+  /**
+   * Reset the object to the state it had right after its default
+   * constructor.
+   */
+  void
+  clear();
+
+  virtual void
+  prolongate(const unsigned int    to_level,
+             Vector<double>       &dst,
+             const Vector<double> &src) const override;
+
+  virtual void
+  prolongate_and_add(const unsigned int    to_level,
+                     Vector<double>       &dst,
+                     const Vector<double> &src) const override;
+
+  virtual void
+  restrict_and_add(const unsigned int    from_level,
+                   Vector<double>       &dst,
+                   const Vector<double> &src) const override;
+
+  /**
+   * Resize the vectors of @p dst to the sizes of the levels of the hierarchy
+   * and copy @p src into the vector on the finest level.
+   */
+  void
+  copy_to_mg(MGLevelObject<Vector<double>> &dst,
+             const Vector<double>          &src) const;
+
+  /**
+   * Same as above, with an unused DoFHandler argument for compatibility
+   * with PreconditionMG.
+   */
+  template <int dim, int spacedim>
+  void
+  copy_to_mg(const DoFHandler<dim, spacedim> &dof_handler,
+             MGLevelObject<Vector<double>>   &dst,
+             const Vector<double>            &src) const;
+
+  /**
+   * Copy the vector on the finest level of @p src into @p dst. The DoFHandler
+   * argument is not used.
+   */
+  template <int dim, int spacedim>
+  void
+  copy_from_mg(const DoFHandler<dim, spacedim>     &dof_handler,
+               Vector<double>                      &dst,
+               const MGLevelObject<Vector<double>> &src) const;
+
+  /**
+   * Add the vector on the finest level of @p src to @p dst. The DoFHandler
+   * argument is not used.
+   */
+  template <int dim, int spacedim>
+  void
+  copy_from_mg_add(const DoFHandler<dim, spacedim>     &dof_handler,
+                   Vector<double>                      &dst,
+                   const MGLevelObject<Vector<double>> &src) const;
+
+  /**
+   * Memory used by this object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The number of unknowns on each level.
+   */
+  MGLevelObject<size_type> level_sizes;
+
+  /**
+   * The prolongation matrices, see initialize().
+   */
+  MGLevelObject<std::shared_ptr<const SparseMatrix<double>>>
+    prolongation_matrices;
+
+  /**
+   * The transposes of the prolongation matrices.
+   */
+  MGLevelObject<std::shared_ptr<const SparseMatrix<double>>>
+    restriction_matrices;
+};
+
+
+
+/**
+ * A smoothed-aggregation algebraic multigrid (AMG) preconditioner for
+ * symmetric positive definite matrices stored as SparseMatrix<double>. In
+ * contrast to TrilinosWrappers::PreconditionAMG and
+ * PETScWrappers::PreconditionBoomerAMG, this class does not need any external
+ * library and no MPI; it is intended for serial programs that use the
+ * threads of a single machine.
+ *
+ * <h3>Setup</h3>
+ *
+ * The initialize() function builds a hierarchy of successively coarser
+ * matrices from the given matrix $A_L$ on the finest level $L$, following
+ * P. Vaněk, J. Mandel, M. Brezina: "Algebraic multigrid by smoothed
+ * aggregation for second and fourth order elliptic problems", Computing 56
+ * (1996), pp. 179-196. On each level, it performs the following steps:
+ * <ol>
+ * <li> It determines the strong connections of the matrix: unknown $j$ is
+ *   strongly connected to unknown $i$ if $|a_{ij}| > \theta
+ *   \sqrt{|a_{ii}a_{jj}|}$, where $\theta$ is
+ *   AdditionalData::aggregation_threshold.
+ * <li> It groups the unknowns into aggregates of strongly connected
+ *   unknowns. Unknowns without any strong connection, like the ones of rows
+ *   that only contain a diagonal entry, are not assigned to any aggregate,
+ *   and are only treated by the smoother.
+ * <li> It sets up the tentative prolongator that maps each aggregate to a
+ *   constant on its unknowns, and smooths it by one step of damped Jacobi
+ *   iteration, $P = (I - \omega D^{-1}A) P_\text{tent}$ with $\omega =
+ *   \frac{4}{3\lambda_\text{max}}$, where $\lambda_\text{max}$ is an
+ *   estimate of the largest eigenvalue of $D^{-1}A$.
+ * <li> It computes the matrix on the next coarser level by the Galerkin
+ *   product $A_{l-1} = P^T A_l P$.
+ * </ol>
+ * The coarsening stops once a level has no more than
+ * AdditionalData::max_coarse_size unknowns, once AdditionalData::max_levels
+ * levels have been created, or if aggregation does not reduce the number of
+ * unknowns anymore.
+ *
+ * All steps are parallelized with the functions of the parallel namespace.
+ * Aggregation is a greedy algorithm and inherently sequential, so it is run
+ * independently on contiguous chunks of AdditionalData::aggregation_chunk_size
+ * rows, taking into account only the strong connections within the chunk
+ * (so-called decoupled aggregation). The resulting hierarchy does not depend
+ * on the number of threads.
+ *
+ * <h3>Cycle</h3>
+ *
+ * The vmult() function performs one V-cycle (or W-cycle, see
+ * AdditionalData::w_cycle) with the Multigrid class, starting from a zero
+ * initial guess. The smoothers are either PreconditionChebyshev with the
+ * inverse of the diagonal of the level matrix as inner preconditioner, or
+ * PreconditionJacobi, both set up with the eigenvalue estimate computed
+ * during the setup, and applied through MGSmootherPrecondition. On the
+ * coarsest level, the matrix is inverted by a singular value decomposition
+ * (or a QR decomposition if deal.II was configured without LAPACK), unless
+ * the coarsening stopped with more than AdditionalData::max_coarse_size
+ * unknowns; then, the smoother is applied instead. Both the smoothers and the
+ * transfer between the levels, MGTransferSparseAMG, rely on matrix-vector
+ * products with SparseMatrix objects and operations on Vector objects, which
+ * run in parallel on several threads.
+ *
+ * The level matrices and the transfer are accessible through
+ * get_level_matrices() and get_transfer(), so the hierarchy can also be used
+ * with user-defined smoothers in a Multigrid object and PreconditionMG.
+ *
+ * The matrix given to initialize() is not copied and needs to live as long as
+ * this object is used as a preconditioner.
+ */
+class SparseAMG : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * The smoothers available for the levels of the hierarchy.
+   */
+  enum class SmootherType
+  {
+    /**
+     * PreconditionChebyshev with a DiagonalMatrix holding the inverse of the
+     * diagonal of the level matrix. The degree of the polynomial is given by
+     * AdditionalData::smoother_sweeps.
+     */
+    chebyshev,
+    /**
+     * AdditionalData::smoother_sweeps steps of PreconditionJacobi, with a
+     * relaxation parameter of $\frac{4}{3\lambda_\text{max}}$.
+     */
+    jacobi
+  };
+
+  /**
+   * Parameters of the setup and the cycle of the algebraic multigrid.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. The default values are suitable for the Laplacian and
+     * similar scalar elliptic problems.
+     */
+    AdditionalData(
+      const double       aggregation_threshold  = 1e-4,
+      const SmootherType smoother_type          = SmootherType::chebyshev,
+      const unsigned int smoother_sweeps        = 2,
+      const double       smoothing_range        = 20.,
+      const bool         w_cycle                = false,
+      const unsigned int max_coarse_size        = 500,
+      const unsigned int max_levels             = 20,
+      const unsigned int aggregation_chunk_size = 16384);
+
+    /**
+     * The threshold $\theta$ for strong connections, see the documentation of
+     * the class.
+     */
+    double aggregation_threshold;
+
+    /**
+     * The smoother used on each level.
+     */
+    SmootherType smoother_type;
+
+    /**
+     * The degree of the Chebyshev polynomial, or the number of Jacobi steps
+     * per smoothing.
+     */
+    unsigned int smoother_sweeps;
+
+    /**
+     * The ratio between the largest eigenvalue and the smallest eigenvalue
+     * that the Chebyshev smoother targets, see
+     * PreconditionChebyshev::AdditionalData::smoothing_range.
+     */
+    double smoothing_range;
+
+    /**
+     * Whether to use a W-cycle instead of a V-cycle.
+     */
+    bool w_cycle;
+
+    /**
+     * The coarsening stops once a level has no more than this number of
+     * unknowns.
+     */
+    unsigned int max_coarse_size;
+
+    /**
+     * The maximal number of levels, including the finest one.
+     */
+    unsigned int max_levels;
+
+    /**
+     * The number of rows that are aggregated together by one task. This
+     * parameter determines the hierarchy, since no aggregates are formed
+     * across the boundaries of the chunks.
+     */
+    unsigned int aggregation_chunk_size;
+  };
+
+  /**
+   * Constructor. Does nothing.
+   */
+  SparseAMG();
+
+  /**
+   * Destructor.
+   */
+  ~SparseAMG() override;
+
+  /**
+   * Build the multigrid hierarchy for @p matrix, see the documentation of
+   * the class.
+   */
+  void
+  initialize(const SparseMatrix<double> &matrix,
+             const AdditionalData       &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and reset the object to the state it had right after
+   * its default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Apply one multigrid cycle to @p src, starting from a zero initial guess,
+   * and store the result in @p dst.
+   */
+  void
+  vmult(Vector<double> &dst, const Vector<double> &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the preconditioner is
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(Vector<double> &dst, const Vector<double> &src) const;
+
+  /**
+   * Return the number of rows of the matrix on the finest level.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix on the finest level.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of levels of the hierarchy.
+   */
+  unsigned int
+  n_levels() const;
+
+  /**
+   * Return the matrices of the hierarchy. Level zero is the coarsest level,
+   * and the finest level holds the matrix given to initialize().
+   */
+  const MGLevelObject<std::shared_ptr<const SparseMatrix<double>>> &
+  get_level_matrices() const;
+
+  /**
+   * Return the transfer between the levels of the hierarchy.
+   */
+  const MGTransferSparseAMG &
+  get_transfer() const;
+
+  /**
+   * Return the ratio between the number of nonzero entries of all level
+   * matrices and the number of nonzero entries of the matrix on the finest
+   * level.
+   */
+  double
+  operator_complexity() const;
+
+  /**
+   * Memory used by this object, not counting the matrix on the finest level.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The level matrices.
+   */
+  MGLevelObject<std::shared_ptr<const SparseMatrix<double>>> level_matrices;
+
+  /**
+   * The transfer between the levels.
+   */
+  MGTransferSparseAMG transfer;
+
+  /**
+   * The matrices, the smoothers, and the coarse solver in the form needed
+   * by the Multigrid class.
+   */
+  std::unique_ptr<MGMatrixBase<Vector<double>>>     mg_matrix;
+  std::unique_ptr<MGSmootherBase<Vector<double>>>   mg_smoother;
+  std::unique_ptr<MGCoarseGridBase<Vector<double>>> mg_coarse;
+
+  /**
+   * The multigrid object that performs the cycle. Its vectors change during
+   * vmult(), so it is marked as mutable.
+   */
+  mutable std::unique_ptr<Multigrid<Vector<double>>> multigrid;
+};
+
+/** @} */
+
+
+/* ------------------------- inline functions -------------------------- */
+
+#ifndef DOXYGEN
+
+template <int dim, int spacedim>
+inline void
+MGTransferSparseAMG::copy_to_mg(const DoFHandler<dim, spacedim> &,
+                                MGLevelObject<Vector<double>> &dst,
+                                const Vector<double>          &src) const
+{
+  copy_to_mg(dst, src);
+}
+
+
+
+template <int dim, int spacedim>
+inline void
+MGTransferSparseAMG::copy_from_mg(
+  const DoFHandler<dim, spacedim> &,
+  Vector<double>                      &dst,
+  const MGLevelObject<Vector<double>> &src) const
+{
+  dst = src[src.max_level()];
+}
+
+
+
+template <int dim, int spacedim>
+inline void
+MGTransferSparseAMG::copy_from_mg_add(
+  const DoFHandler<dim, spacedim> &,
+  Vector<double>                      &dst,
+  const MGLevelObject<Vector<double>> &src) const
+{
+  dst += src[src.max_level()];
+}
+
+
+
+inline void
+SparseAMG::Tvmult(Vector<double> &dst, const Vector<double> &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+inline unsigned int
+SparseAMG::n_levels() const
+{
+  return (multigrid != nullptr) ? level_matrices.n_levels() : 0;
+}
+
+
+
+inline const MGLevelObject<std::shared_ptr<const SparseMatrix<double>>> &
+SparseAMG::get_level_matrices() const
+{
+  return level_matrices;
+}
+
+
+
+inline const MGTransferSparseAMG &
+SparseAMG::get_transfer() const
+{
+  return transfer;
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -682,6 +682,26 @@ public:
   void
   copy_from(const DynamicSparsityPattern &dsp);
 
+  /**
+   * Copy data from lists of (row, column) pairs. Previous content of this
+   * object is lost, and the sparsity pattern is in compressed mode
+   * afterwards.
+   *
+   * Each list in @p entries must be sorted lexicographically and must not
+   * contain duplicates, and all rows in one list must be larger than the
+   * rows in the previous lists, i.e., the lists describe consecutive row
+   * ranges of the pattern. The lists are copied into the compressed storage
+   * in parallel, one task per list, without going through an intermediate
+   * object that stores the rows separately. This function is used by
+   * DoFTools::make_compressed_sparsity_pattern(), which fills one list per
+   * row range in parallel.
+   */
+  void
+  copy_from(
+    const size_type                                                  n_rows,
+    const size_type                                                  n_cols,
+    const std::vector<std::vector<std::pair<size_type, size_type>>> &entries);
+
   /**
    * Copy data from a SparsityPattern. Previous content of this object is
    * lost, and the sparsity pattern is in compressed mode afterwards.
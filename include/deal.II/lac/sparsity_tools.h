@@ -204,6 +204,12 @@ namespace SparsityTools
    * exception if starting indices are given, taking the latter as an
    * indication that the caller of the function would like to override the
    * part of the algorithm that chooses starting indices.
+   *
+   * The search for the nodes of the next level is split into chunks that
+   * are worked on in parallel if the current level is large. The result
+   * does not depend on the number of threads. The reverse Cuthill-McKee
+   * ordering is obtained by reversing the result with
+   * Utilities::reverse_permutation().
    */
   void
   reorder_Cuthill_McKee(
@@ -238,6 +244,52 @@ namespace SparsityTools
     const DynamicSparsityPattern                   &sparsity,
     std::vector<DynamicSparsityPattern::size_type> &new_indices);
 
+  /**
+   * For a given sparsity pattern, compute a re-enumeration of row/column
+   * indices based on nested dissection.
+   *
+   * The graph represented by the sparsity pattern is split recursively into
+   * two parts that are not connected with each other and a separator, i.e.,
+   * a set of nodes that connects the two parts. The nodes of the two parts
+   * are numbered first, and those of the separator last. The separator is
+   * one level of a breadth-first search from a pseudo-peripheral node,
+   * chosen such that the two parts have roughly the same size. If the graph
+   * is not connected, its connected components are instead distributed to
+   * the two parts, which then need no separator. The two parts are
+   * independent of each other, so the recursion works on them in parallel.
+   *
+   * The recursion stops once a part has at most @p max_block_size nodes.
+   * The nodes of such a block are numbered consecutively in breadth-first
+   * order. Choosing @p max_block_size such that the entries of a matrix
+   * that couple a block with itself fit into the cache results in a
+   * cache-blocked ordering: since the nodes of a block only couple with the
+   * nodes of the same block and of the separators around it, operations
+   * like matrix-vector products or Gauss-Seidel sweeps then mostly work on
+   * vector entries that are already in the cache. Furthermore, the ordering
+   * reduces the fill-in of factorizations.
+   *
+   * The result only depends on the sparsity pattern and @p max_block_size,
+   * not on the number of threads.
+   */
+  void
+  reorder_nested_dissection(
+    const DynamicSparsityPattern                   &sparsity,
+    std::vector<DynamicSparsityPattern::size_type> &new_indices,
+    const unsigned int                              max_block_size = 1024);
+
+  /**
+   * Return the profile (also called the envelope size) of the given sparsity
+   * pattern, i.e., the sum over all rows $i$ of $i-j_i$, where $j_i$ is the
+   * column of the leftmost entry in row $i$, if $j_i<i$. Together with the
+   * bandwidth, see DynamicSparsityPattern::bandwidth(), it measures how well
+   * the entries of a sparsity pattern are clustered around the diagonal,
+   * and can be used to compare different numberings of the rows and
+   * columns, e.g. those computed by reorder_Cuthill_McKee() and
+   * reorder_nested_dissection().
+   */
+  DynamicSparsityPattern::size_type
+  compute_profile(const DynamicSparsityPattern &sparsity);
+
 #ifdef DEAL_II_WITH_MPI
   /**
    * Communicate rows in a dynamic sparsity pattern over MPI.
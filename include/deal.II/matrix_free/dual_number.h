@@ -0,0 +1,628 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_dual_number_h
+#define dealii_matrix_free_dual_number_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/template_constraints.h>
+#include <deal.II/base/vectorization.h>
+
+#include <cmath>
+#include <type_traits>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * A lightweight number type for forward-mode automatic differentiation in
+ * a single direction, storing a value $a$ and its directional derivative
+ * $a'$, i.e., the number $a + \epsilon a'$ with $\epsilon^2 = 0$. The
+ * arithmetic operations and the elementary functions defined for this type
+ * propagate the derivative by the chain rule.
+ *
+ * The main use of this class is with VectorizedArray as the underlying
+ * type @p Number, such that a residual expressed at the quadrature points
+ * of FEEvaluation can be linearized along the direction given by another
+ * finite element function with the same SIMD data layout as the residual
+ * itself. The class can be used as the number type of Tensor and
+ * SymmetricTensor, which makes it possible to write a single quadrature
+ * point kernel in terms of generic number types that is both used for the
+ * residual and for its linearization. This is what
+ * MatrixFreeTools::compute_jacobian_vector_product() does to compute
+ * Jacobian-vector products without an assembled Jacobian or a hand-derived
+ * linearized operator.
+ *
+ * In contrast to the number types supported via the Differentiation::AD
+ * namespace, this class only computes first derivatives in a single
+ * direction, but does not need an external library and has no run time
+ * overhead beyond the arithmetic operations on the derivative.
+ */
+template <typename Number>
+class DualNumber
+{
+public:
+  /**
+   * Default constructor, setting both the value and the derivative to zero.
+   */
+  DualNumber()
+    : value(0.)
+    , derivative(0.)
+  {}
+
+  /**
+   * Constructor from a value, setting the derivative to zero, i.e., the
+   * value is treated as a constant.
+   */
+  DualNumber(const Number &value)
+    : value(value)
+    , derivative(0.)
+  {}
+
+  /**
+   * Constructor from a scalar of an arithmetic type different from
+   * @p Number, e.g., from a <tt>double</tt> for
+   * <tt>Number=VectorizedArray<double></tt>. The derivative is set to zero.
+   */
+  template <typename OtherNumber,
+            typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+  DualNumber(const OtherNumber &value)
+    : value(value)
+    , derivative(0.)
+  {}
+
+  /**
+   * Constructor from a value and a directional derivative.
+   */
+  DualNumber(const Number &value, const Number &derivative)
+    : value(value)
+    , derivative(derivative)
+  {}
+
+  /**
+   * Addition.
+   */
+  DualNumber &
+  operator+=(const DualNumber &other)
+  {
+    value += other.value;
+    derivative += other.derivative;
+    return *this;
+  }
+
+  /**
+   * Subtraction.
+   */
+  DualNumber &
+  operator-=(const DualNumber &other)
+  {
+    value -= other.value;
+    derivative -= other.derivative;
+    return *this;
+  }
+
+  /**
+   * Multiplication, using the product rule for the derivative.
+   */
+  DualNumber &
+  operator*=(const DualNumber &other)
+  {
+    derivative = derivative * other.value + value * other.derivative;
+    value *= other.value;
+    return *this;
+  }
+
+  /**
+   * Division, using the quotient rule for the derivative.
+   */
+  DualNumber &
+  operator/=(const DualNumber &other)
+  {
+    const Number inverse = Number(1.) / other.value;
+    value *= inverse;
+    derivative = (derivative - value * other.derivative) * inverse;
+    return *this;
+  }
+
+  /**
+   * The value of the number.
+   */
+  Number value;
+
+  /**
+   * The directional derivative of the number.
+   */
+  Number derivative;
+};
+
+
+
+#ifndef DOXYGEN
+
+// Enable the EnableIfScalar type trait for DualNumber<Number> such that it
+// can be used as a Number type in Tensor<rank,dim,Number>, etc.
+
+template <typename Number>
+struct EnableIfScalar<DualNumber<Number>>
+{
+  using type = DualNumber<typename EnableIfScalar<Number>::type>;
+};
+
+#endif
+
+
+
+/**
+ * @name Arithmetic operations on DualNumber
+ * @{
+ */
+
+/**
+ * Unary minus.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator-(const DualNumber<Number> &x)
+{
+  return DualNumber<Number>(-x.value, -x.derivative);
+}
+
+
+
+/**
+ * Addition of two dual numbers.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator+(const DualNumber<Number> &a, const DualNumber<Number> &b)
+{
+  return DualNumber<Number>(a.value + b.value, a.derivative + b.derivative);
+}
+
+
+
+/**
+ * Subtraction of two dual numbers.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator-(const DualNumber<Number> &a, const DualNumber<Number> &b)
+{
+  return DualNumber<Number>(a.value - b.value, a.derivative - b.derivative);
+}
+
+
+
+/**
+ * Multiplication of two dual numbers.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator*(const DualNumber<Number> &a, const DualNumber<Number> &b)
+{
+  return DualNumber<Number>(a.value * b.value,
+                            a.derivative * b.value + a.value * b.derivative);
+}
+
+
+
+/**
+ * Division of two dual numbers.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator/(const DualNumber<Number> &a, const DualNumber<Number> &b)
+{
+  const Number inverse = Number(1.) / b.value;
+  const Number value   = a.value * inverse;
+  return DualNumber<Number>(value,
+                            (a.derivative - value * b.derivative) * inverse);
+}
+
+
+
+/**
+ * Addition of a dual number and a constant.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator+(const DualNumber<Number> &a, const Number &b)
+{
+  return DualNumber<Number>(a.value + b, a.derivative);
+}
+
+
+
+/**
+ * Addition of a constant and a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator+(const Number &a, const DualNumber<Number> &b)
+{
+  return DualNumber<Number>(a + b.value, b.derivative);
+}
+
+
+
+/**
+ * Subtraction of a constant from a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator-(const DualNumber<Number> &a, const Number &b)
+{
+  return DualNumber<Number>(a.value - b, a.derivative);
+}
+
+
+
+/**
+ * Subtraction of a dual number from a constant.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator-(const Number &a, const DualNumber<Number> &b)
+{
+  return DualNumber<Number>(a - b.value, -b.derivative);
+}
+
+
+
+/**
+ * Multiplication of a dual number by a constant.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator*(const DualNumber<Number> &a, const Number &b)
+{
+  return DualNumber<Number>(a.value * b, a.derivative * b);
+}
+
+
+
+/**
+ * Multiplication of a constant by a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator*(const Number &a, const DualNumber<Number> &b)
+{
+  return DualNumber<Number>(a * b.value, a * b.derivative);
+}
+
+
+
+/**
+ * Division of a dual number by a constant.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator/(const DualNumber<Number> &a, const Number &b)
+{
+  const Number inverse = Number(1.) / b;
+  return DualNumber<Number>(a.value * inverse, a.derivative * inverse);
+}
+
+
+
+/**
+ * Division of a constant by a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline DualNumber<Number>
+operator/(const Number &a, const DualNumber<Number> &b)
+{
+  const Number inverse = Number(1.) / b.value;
+  const Number value   = a * inverse;
+  return DualNumber<Number>(value, -value * b.derivative * inverse);
+}
+
+
+
+/**
+ * Addition of a dual number and a scalar of arithmetic type, e.g., a
+ * <tt>double</tt> for <tt>Number=VectorizedArray<double></tt>.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator+(const DualNumber<Number> &a, const OtherNumber &b)
+{
+  return a + Number(b);
+}
+
+
+
+/**
+ * Addition of a scalar of arithmetic type and a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator+(const OtherNumber &a, const DualNumber<Number> &b)
+{
+  return Number(a) + b;
+}
+
+
+
+/**
+ * Subtraction of a scalar of arithmetic type from a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator-(const DualNumber<Number> &a, const OtherNumber &b)
+{
+  return a - Number(b);
+}
+
+
+
+/**
+ * Subtraction of a dual number from a scalar of arithmetic type.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator-(const OtherNumber &a, const DualNumber<Number> &b)
+{
+  return Number(a) - b;
+}
+
+
+
+/**
+ * Multiplication of a dual number by a scalar of arithmetic type.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator*(const DualNumber<Number> &a, const OtherNumber &b)
+{
+  return a * Number(b);
+}
+
+
+
+/**
+ * Multiplication of a scalar of arithmetic type by a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator*(const OtherNumber &a, const DualNumber<Number> &b)
+{
+  return Number(a) * b;
+}
+
+
+
+/**
+ * Division of a dual number by a scalar of arithmetic type.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator/(const DualNumber<Number> &a, const OtherNumber &b)
+{
+  return a / Number(b);
+}
+
+
+
+/**
+ * Division of a scalar of arithmetic type by a dual number.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number,
+          typename OtherNumber,
+          typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+inline DualNumber<Number>
+operator/(const OtherNumber &a, const DualNumber<Number> &b)
+{
+  return Number(a) / b;
+}
+
+
+
+/**
+ * Return whether both the values and the derivatives of two dual numbers
+ * are equal.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline bool
+operator==(const DualNumber<Number> &a, const DualNumber<Number> &b)
+{
+  return a.value == b.value && a.derivative == b.derivative;
+}
+
+
+
+/**
+ * Return whether the values or the derivatives of two dual numbers differ.
+ *
+ * @relatesalso DualNumber
+ */
+template <typename Number>
+inline bool
+operator!=(const DualNumber<Number> &a, const DualNumber<Number> &b)
+{
+  return !(a == b);
+}
+
+/** @} */
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+
+/**
+ * Implementation of functions from cmath on DualNumber. These functions do
+ * not reside in the dealii namespace in order to ensure a similar interface
+ * as for the respective functions in cmath and for VectorizedArray. Instead,
+ * call them using std::sin.
+ */
+namespace std
+{
+  /**
+   * Compute the sine of a dual number.
+   *
+   * @relatesalso DualNumber
+   */
+  template <typename Number>
+  inline ::dealii::DualNumber<Number>
+  sin(const ::dealii::DualNumber<Number> &x)
+  {
+    return ::dealii::DualNumber<Number>(std::sin(x.value),
+                                        std::cos(x.value) * x.derivative);
+  }
+
+
+
+  /**
+   * Compute the cosine of a dual number.
+   *
+   * @relatesalso DualNumber
+   */
+  template <typename Number>
+  inline ::dealii::DualNumber<Number>
+  cos(const ::dealii::DualNumber<Number> &x)
+  {
+    return ::dealii::DualNumber<Number>(std::cos(x.value),
+                                        -std::sin(x.value) * x.derivative);
+  }
+
+
+
+  /**
+   * Compute the exponential of a dual number.
+   *
+   * @relatesalso DualNumber
+   */
+  template <typename Number>
+  inline ::dealii::DualNumber<Number>
+  exp(const ::dealii::DualNumber<Number> &x)
+  {
+    const Number value = std::exp(x.value);
+    return ::dealii::DualNumber<Number>(value, value * x.derivative);
+  }
+
+
+
+  /**
+   * Compute the natural logarithm of a dual number.
+   *
+   * @relatesalso DualNumber
+   */
+  template <typename Number>
+  inline ::dealii::DualNumber<Number>
+  log(const ::dealii::DualNumber<Number> &x)
+  {
+    return ::dealii::DualNumber<Number>(std::log(x.value),
+                                        x.derivative / x.value);
+  }
+
+
+
+  /**
+   * Compute the square root of a dual number.
+   *
+   * @relatesalso DualNumber
+   */
+  template <typename Number>
+  inline ::dealii::DualNumber<Number>
+  sqrt(const ::dealii::DualNumber<Number> &x)
+  {
+    const Number value = std::sqrt(x.value);
+    return ::dealii::DualNumber<Number>(value,
+                                        x.derivative / (Number(2.) * value));
+  }
+
+
+
+  /**
+   * Raise a dual number to the power @p p.
+   *
+   * @relatesalso DualNumber
+   */
+  template <typename Number>
+  inline ::dealii::DualNumber<Number>
+  pow(const ::dealii::DualNumber<Number> &x,
+      const typename ::dealii::internal::VectorizedArrayTrait<
+        Number>::value_type p)
+  {
+    const Number value_p_minus_one = std::pow(x.value, p - 1);
+    return ::dealii::DualNumber<Number>(value_p_minus_one * x.value,
+                                        Number(p) * value_p_minus_one *
+                                          x.derivative);
+  }
+} // namespace std
+
+#endif
@@ -2159,6 +2159,52 @@ public:
                     VectorizedArrayType                   *values_array,
                     const bool sum_into_values = false);
 
+  /**
+   * Interpolate the values given at the quadrature points of a cell, as
+   * computed by FEEvaluation::evaluate() and accessed via
+   * FEEvaluation::begin_values(), into the quadrature points of the current
+   * face of that cell. In a cell-centric loop as run by
+   * MatrixFree::loop_cell_centric(), this allows to compute face integrals
+   * on the interior side from the data the cell integral already holds in
+   * cache, with a single one-dimensional interpolation in the direction
+   * normal to the face, instead of reading the degrees of freedom from the
+   * vector and interpolating them to the face again.
+   *
+   * The interpolation is exact if the polynomial degree of the element does
+   * not exceed the number of 1d quadrature points minus one, and the face
+   * quadrature is built from the same 1d formula as the cell quadrature,
+   * which is the case when FEEvaluation and FEFaceEvaluation use the same
+   * quadrature index of MatrixFree.
+   *
+   * @pre This object must be set to the interior side of a face via
+   * reinit(cell_batch_index, face_number). Only EvaluationFlags::values is
+   * supported, which covers the fluxes of first-order DG operators; the
+   * function asserts if @p evaluation_flag also asks for gradients or
+   * Hessians, since the normal interpolation of the cell quadrature data
+   * does not provide the tangential derivatives on the face.
+   */
+  void
+  evaluate_from_cell_quadrature(
+    const VectorizedArrayType             *cell_quadrature_values,
+    const EvaluationFlags::EvaluationFlags evaluation_flag);
+
+  /**
+   * Counterpart of evaluate_from_cell_quadrature(): test the values
+   * submitted on the quadrature points of the current face and add the
+   * result into @p cell_quadrature_values, the values at the quadrature
+   * points of the cell. When these are the values submitted to FEEvaluation,
+   * the face integral is then performed along with the cell integral in a
+   * single call to FEEvaluation::integrate() with EvaluationFlags::values,
+   * which saves the separate interpolation from the face to the degrees of
+   * freedom and the accumulation of the face contributions.
+   *
+   * @pre Same as for evaluate_from_cell_quadrature().
+   */
+  void
+  integrate_into_cell_quadrature(
+    const EvaluationFlags::EvaluationFlags integration_flag,
+    VectorizedArrayType                   *cell_quadrature_values);
+
   /**
    * This function takes the values and/or gradients that are stored on
    * quadrature points, tests them by all the basis functions/gradients on the
@@ -2535,6 +2581,11 @@ inline FEEvaluationBase<dim,
       this->quadrature_points =
         this->mapped_geometry->get_data_storage().quadrature_points.begin();
     }
+  else
+    {
+      // the geometry computed within reinit() is specific to each object
+      this->mapped_geometry.reset();
+    }
 
   this->set_data_pointers(scratch_data_array, n_components_);
 }
@@ -2613,6 +2664,7 @@ operator=(const FEEvaluationBase<dim,
   else
     {
       scratch_data_array = matrix_free->acquire_scratch_data();
+      this->mapped_geometry.reset();
     }
 
   this->set_data_pointers(scratch_data_array, n_components_);
@@ -6513,20 +6565,51 @@ FEEvaluation<dim,
 
   Assert(this->dof_info != nullptr, ExcNotInitialized());
   Assert(this->mapping_data != nullptr, ExcNotInitialized());
-  this->cell = cell_index;
-  this->cell_type =
-    this->matrix_free->get_mapping_info().get_cell_type(cell_index);
-
-  const unsigned int offsets =
-    this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
-  if (!this->mapping_data->jacobian_gradients[0].empty())
+  const auto &mapping_info = this->matrix_free->get_mapping_info();
+  this->cell               = cell_index;
+  this->cell_type          = mapping_info.get_cell_type(cell_index);
+
+  if (mapping_info.cell_data_is_computed_on_the_fly(cell_index))
+    {
+      // compute the geometry from the support points of the mapping, see
+      // MatrixFree::AdditionalData::compute_cell_geometry_on_the_fly
+      if (this->mapped_geometry == nullptr)
+        this->mapped_geometry =
+          std::make_shared<internal::MatrixFreeFunctions::
+                             MappingDataOnTheFly<dim, VectorizedArrayType>>();
+
+      auto &mapping_storage = this->mapped_geometry->get_data_storage();
+      AlignedVector<VectorizedArrayType> *scratch =
+        this->matrix_free->acquire_scratch_data();
+      mapping_info.compute_cell_data_on_the_fly(cell_index,
+                                                this->quadrature_index,
+                                                mapping_storage,
+                                                *scratch);
+      this->matrix_free->release_scratch_data(scratch);
+
+      this->jacobian          = mapping_storage.jacobians[0].data();
+      this->J_value           = mapping_storage.JxW_values.data();
+      this->quadrature_points = mapping_storage.quadrature_points.data();
+    }
+  else
     {
-      this->jacobian_gradients =
-        this->mapping_data->jacobian_gradients[0].data() + offsets;
-      this->jacobian_gradients_non_inverse =
-        this->mapping_data->jacobian_gradients_non_inverse[0].data() + offsets;
+      const unsigned int offsets =
+        this->mapping_data->data_index_offsets[cell_index];
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+      if (!this->mapping_data->jacobian_gradients[0].empty())
+        {
+          this->jacobian_gradients =
+            this->mapping_data->jacobian_gradients[0].data() + offsets;
+          this->jacobian_gradients_non_inverse =
+            this->mapping_data->jacobian_gradients_non_inverse[0].data() +
+            offsets;
+        }
+
+      if (this->mapping_data->quadrature_points.empty() == false)
+        this->quadrature_points =
+          &this->mapping_data->quadrature_points
+             [this->mapping_data->quadrature_point_offsets[this->cell]];
     }
 
   if (this->matrix_free->n_active_entries_per_cell_batch(this->cell) == n_lanes)
@@ -6545,11 +6628,6 @@ FEEvaluation<dim,
         this->cell_ids[i] = numbers::invalid_unsigned_int;
     }
 
-  if (this->mapping_data->quadrature_points.empty() == false)
-    this->quadrature_points =
-      &this->mapping_data->quadrature_points
-         [this->mapping_data->quadrature_point_offsets[this->cell]];
-
   if constexpr (running_in_debug_mode())
     {
       this->is_reinitialized           = true;
@@ -6579,6 +6657,11 @@ FEEvaluation<dim,
 {
   Assert(this->dof_info != nullptr, ExcNotInitialized());
   Assert(this->mapping_data != nullptr, ExcNotInitialized());
+  Assert(this->matrix_free->get_mapping_info().cell_geometry_on_the_fly ==
+           false,
+         ExcNotImplemented("Cell geometry computed on the fly is not "
+                           "supported when reinitializing with a set of "
+                           "cell indices."));
 
   this->cell     = numbers::invalid_unsigned_int;
   this->cell_ids = cell_ids;
@@ -8092,6 +8175,116 @@ FEFaceEvaluation<dim,
 
 
 
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          int n_components_,
+          typename Number,
+          typename VectorizedArrayType>
+inline void
+FEFaceEvaluation<dim,
+                 fe_degree,
+                 n_q_points_1d,
+                 n_components_,
+                 Number,
+                 VectorizedArrayType>::
+  evaluate_from_cell_quadrature(
+    const VectorizedArrayType             *cell_quadrature_values,
+    const EvaluationFlags::EvaluationFlags evaluation_flag)
+{
+  Assert(evaluation_flag == EvaluationFlags::values,
+         ExcMessage("FEFaceEvaluation::evaluate_from_cell_quadrature() only "
+                    "supports EvaluationFlags::values. To compute gradients "
+                    "or Hessians on the face, evaluate them from the degrees "
+                    "of freedom with evaluate() or gather_evaluate() "
+                    "instead."));
+  Assert(this->is_interior_face() &&
+           this->dof_access_index ==
+             internal::MatrixFreeFunctions::DoFInfo::dof_access_cell,
+         ExcMessage("The interpolation from the cell quadrature points is "
+                    "only possible for the interior side of a face set via "
+                    "reinit(cell_batch_index, face_number)."));
+  Assert(this->data->data.front().fe_degree <
+           this->data->data.front().n_q_points_1d,
+         ExcMessage("The interpolation from the cell quadrature points "
+                    "requires more 1d quadrature points than the degree."));
+
+  constexpr int n_q_points_1d_minus_one =
+    fe_degree == -1 ? -1 : n_q_points_1d - 1;
+  internal::FEFaceNormalEvaluationImpl<dim,
+                                       n_q_points_1d_minus_one,
+                                       VectorizedArrayType>::
+    template interpolate_quadrature<true, false>(n_components,
+                                                 evaluation_flag,
+                                                 *this->data,
+                                                 cell_quadrature_values,
+                                                 this->values_quad,
+                                                 this->face_numbers[0]);
+
+  if constexpr (running_in_debug_mode())
+    {
+      this->values_quad_initialized    = true;
+      this->gradients_quad_initialized = false;
+      this->hessians_quad_initialized  = false;
+    }
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          int n_components_,
+          typename Number,
+          typename VectorizedArrayType>
+inline void
+FEFaceEvaluation<dim,
+                 fe_degree,
+                 n_q_points_1d,
+                 n_components_,
+                 Number,
+                 VectorizedArrayType>::
+  integrate_into_cell_quadrature(
+    const EvaluationFlags::EvaluationFlags integration_flag,
+    VectorizedArrayType                   *cell_quadrature_values)
+{
+  Assert(integration_flag == EvaluationFlags::values,
+         ExcMessage("FEFaceEvaluation::integrate_into_cell_quadrature() only "
+                    "supports EvaluationFlags::values. To test with gradients "
+                    "or Hessians on the face, integrate into the degrees of "
+                    "freedom with integrate() or integrate_scatter() "
+                    "instead."));
+  Assert(this->is_interior_face() &&
+           this->dof_access_index ==
+             internal::MatrixFreeFunctions::DoFInfo::dof_access_cell,
+         ExcMessage("The interpolation to the cell quadrature points is "
+                    "only possible for the interior side of a face set via "
+                    "reinit(cell_batch_index, face_number)."));
+  Assert(this->data->data.front().fe_degree <
+           this->data->data.front().n_q_points_1d,
+         ExcMessage("The interpolation to the cell quadrature points "
+                    "requires more 1d quadrature points than the degree."));
+  if constexpr (running_in_debug_mode())
+    {
+      Assert(this->values_quad_submitted == true,
+             internal::ExcAccessToUninitializedField());
+    }
+
+  constexpr int n_q_points_1d_minus_one =
+    fe_degree == -1 ? -1 : n_q_points_1d - 1;
+  internal::FEFaceNormalEvaluationImpl<dim,
+                                       n_q_points_1d_minus_one,
+                                       VectorizedArrayType>::
+    template interpolate_quadrature<false, true>(n_components,
+                                                 integration_flag,
+                                                 *this->data,
+                                                 this->values_quad,
+                                                 cell_quadrature_values,
+                                                 this->face_numbers[0]);
+}
+
+
+
 template <int dim,
           int fe_degree,
           int n_q_points_1d,
@@ -33,6 +33,7 @@
 
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/mapping_info_storage.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 #include <memory>
 
@@ -60,6 +61,14 @@ namespace internal
        * for different kinds of iterators, e.g. standard DoFHandler,
        * multigrid, etc.)  on a fixed Triangulation. In addition, a mapping
        * and several 1d quadrature formulas are given.
+       *
+       * If @p cell_geometry_on_the_fly is set, the Jacobians, JxW values and
+       * quadrature points of cells of general type are not stored but
+       * recomputed by compute_cell_data_on_the_fly(), see the description of
+       * MatrixFree::AdditionalData::compute_cell_geometry_on_the_fly. If in
+       * addition @p cell_geometry_in_single_precision is set, the support
+       * points of the mapping used for that purpose are stored in single
+       * precision.
        */
       void
       initialize(
@@ -73,7 +82,9 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        cell_geometry_on_the_fly          = false,
+        const bool        cell_geometry_in_single_precision = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -95,6 +106,37 @@ namespace internal
       GeometryType
       get_cell_type(const unsigned int cell_chunk_no) const;
 
+      /**
+       * Return whether the Jacobians, JxW values, and quadrature points of
+       * the given cell batch are not stored but need to be computed by
+       * compute_cell_data_on_the_fly().
+       */
+      bool
+      cell_data_is_computed_on_the_fly(const unsigned int cell_chunk_no) const;
+
+      /**
+       * Compute the inverse Jacobians, the JxW values, and, if requested by
+       * the update flags on cells, the quadrature points of the cell batch
+       * @p cell_chunk_no for the quadrature formula @p quad_no from the
+       * support points of the MappingQ object stored in
+       * cell_mapping_support_points or
+       * cell_mapping_support_points_single_precision. The result is written
+       * into the fields <code>jacobians[0]</code>, <code>JxW_values</code>
+       * and <code>quadrature_points</code> of @p data, starting at index
+       * zero.
+       * The array @p scratch_data is used as temporary storage for the
+       * evaluation with sum factorization.
+       *
+       * This function may only be called for cell batches for which
+       * cell_data_is_computed_on_the_fly() returns true.
+       */
+      void
+      compute_cell_data_on_the_fly(
+        const unsigned int                                 cell_chunk_no,
+        const unsigned int                                 quad_no,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &data,
+        AlignedVector<VectorizedArrayType>                &scratch_data) const;
+
       /**
        * Clear all data fields in this class.
        */
@@ -200,6 +242,54 @@ namespace internal
        */
       std::vector<std::vector<ReferenceCell>> reference_cell_types;
 
+      /**
+       * Stores whether the geometry of cells of general type is computed on
+       * the fly from the support points of the mapping rather than stored.
+       * This is only possible in the setup via compute_mapping_q() when no
+       * Jacobian gradients are requested, otherwise this variable is false.
+       */
+      bool cell_geometry_on_the_fly = false;
+
+      /**
+       * The support points of the MappingQ object on the cell batches of
+       * general type if the geometry is computed on the fly, stored
+       * component by component with the lexicographic numbering of the
+       * support points.
+       */
+      AlignedVector<VectorizedArrayType> cell_mapping_support_points;
+
+      /**
+       * Same as cell_mapping_support_points, but stored in single precision
+       * with the entries of the SIMD lanes next to each other. This field is
+       * used instead of cell_mapping_support_points if
+       * cell_geometry_in_single_precision is set.
+       */
+      AlignedVector<float> cell_mapping_support_points_single_precision;
+
+      /**
+       * Stores whether the support points of the cells with geometry
+       * computed on the fly are kept in
+       * cell_mapping_support_points_single_precision, see
+       * MatrixFree::AdditionalData::store_cell_geometry_in_single_precision.
+       */
+      bool cell_geometry_in_single_precision = false;
+
+      /**
+       * The index of the first entry of each cell batch in
+       * cell_mapping_support_points, or numbers::invalid_unsigned_int for
+       * cell batches whose data is stored in cell_data. For
+       * cell_mapping_support_points_single_precision, the index needs to be
+       * multiplied by the number of SIMD lanes.
+       */
+      std::vector<unsigned int> cell_mapping_support_point_offsets;
+
+      /**
+       * The interpolation matrices from the support points of the mapping to
+       * the quadrature points of each quadrature formula, used for computing
+       * the geometry on the fly.
+       */
+      std::vector<ShapeInfo<Number>> cell_mapping_shape_info;
+
       /**
        * Internal function to compute the geometry for the case the mapping is
        * a MappingQ and a single quadrature formula per slot (non-hp-case) is
@@ -308,6 +398,21 @@ namespace internal
       return cell_type[cell_no];
     }
 
+
+
+    template <int dim, typename Number, typename VectorizedArrayType>
+    inline bool
+    MappingInfo<dim, Number, VectorizedArrayType>::
+      cell_data_is_computed_on_the_fly(const unsigned int cell_no) const
+    {
+      if (cell_geometry_on_the_fly == false)
+        return false;
+
+      AssertIndexRange(cell_no, cell_mapping_support_point_offsets.size());
+      return cell_mapping_support_point_offsets[cell_no] !=
+             numbers::invalid_unsigned_int;
+    }
+
   } // end of namespace MatrixFreeFunctions
 } // end of namespace internal
 
@@ -52,8 +52,14 @@ namespace internal
       face_data_by_cells.clear();
       cell_type.clear();
       face_type.clear();
-      mapping_collection = nullptr;
-      mapping            = nullptr;
+      mapping_collection                = nullptr;
+      mapping                           = nullptr;
+      cell_geometry_on_the_fly          = false;
+      cell_geometry_in_single_precision = false;
+      cell_mapping_support_points.clear();
+      cell_mapping_support_points_single_precision.clear();
+      cell_mapping_support_point_offsets.clear();
+      cell_mapping_shape_info.clear();
     }
 
 
@@ -71,7 +77,9 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        cell_geometry_on_the_fly,
+      const bool        cell_geometry_in_single_precision)
     {
       clear();
       this->mapping_collection = mapping;
@@ -184,10 +192,18 @@ namespace internal
 
       // In case we have no hp-adaptivity (active_fe_index is empty), we have
       // cells, and the mapping is MappingQ or a derived class, we can
-      // use the fast method.
+      // use the fast method. This is also the only setting where we can
+      // compute the cell geometry on the fly.
       if (active_fe_index.empty() && !cells.empty() && mapping->size() == 1 &&
           dynamic_cast<const MappingQ<dim> *>(&mapping->operator[](0)))
-        compute_mapping_q(tria, cells, face_info);
+        {
+          this->cell_geometry_on_the_fly =
+            cell_geometry_on_the_fly &&
+            (this->update_flags_cells & update_jacobian_grads) == 0u;
+          this->cell_geometry_in_single_precision =
+            this->cell_geometry_on_the_fly && cell_geometry_in_single_precision;
+          compute_mapping_q(tria, cells, face_info);
+        }
       else
         {
           // Could call these functions in parallel, but not useful because
@@ -228,6 +244,9 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          cell_geometry_on_the_fly          = false;
+          cell_geometry_in_single_precision = false;
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -1171,6 +1190,7 @@ namespace internal
         const UpdateFlags            update_flags_cells,
         const AlignedVector<double> &plain_quadrature_points,
         const ShapeInfo<double>     &shape_info,
+        const bool                   skip_general_cells,
         MappingInfoStorage<dim, dim, VectorizedArrayType> &my_data)
       {
         constexpr unsigned int n_lanes   = VectorizedArrayType::size();
@@ -1189,6 +1209,10 @@ namespace internal
         for (unsigned int cell = begin_cell; cell < end_cell; ++cell)
           for (unsigned vv = 0; vv < n_lanes; vv += n_lanes_d)
             {
+              // the data of general cells is computed on the fly
+              if (skip_general_cells && cell_type[cell] > affine)
+                continue;
+
               if (cell_type[cell] > affine || process_cell[cell])
                 {
                   unsigned int start_indices[n_lanes_d];
@@ -2804,10 +2828,13 @@ namespace internal
                   my_data.data_index_offsets[cell_data_index_vect[cell]];
               else
                 my_data.data_index_offsets[cell] = max_size;
-              max_size =
-                std::max(max_size,
-                         my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+              if (cell_type[cell] <= affine)
+                max_size =
+                  std::max(max_size, my_data.data_index_offsets[cell] + 2);
+              else if (cell_geometry_on_the_fly == false)
+                max_size = std::max(max_size,
+                                    my_data.data_index_offsets[cell] +
+                                      n_q_points);
             }
 
           my_data.JxW_values.resize_fast(max_size);
@@ -2820,17 +2847,20 @@ namespace internal
 
           if (update_flags_cells & update_quadrature_points)
             {
+              const auto n_stored_points = [&](const unsigned int cell) {
+                if (cell_type[cell] <= affine)
+                  return 1U;
+                else
+                  return cell_geometry_on_the_fly ? 0U : n_q_points;
+              };
               my_data.quadrature_point_offsets.resize(cell_type.size());
               for (unsigned int cell = 1; cell < cell_type.size(); ++cell)
-                if (cell_type[cell - 1] <= affine)
-                  my_data.quadrature_point_offsets[cell] =
-                    my_data.quadrature_point_offsets[cell - 1] + 1;
-                else
-                  my_data.quadrature_point_offsets[cell] =
-                    my_data.quadrature_point_offsets[cell - 1] + n_q_points;
+                my_data.quadrature_point_offsets[cell] =
+                  my_data.quadrature_point_offsets[cell - 1] +
+                  n_stored_points(cell - 1);
               my_data.quadrature_points.resize_fast(
                 my_data.quadrature_point_offsets.back() +
-                (cell_type.back() <= affine ? 1 : n_q_points));
+                n_stored_points(cell_type.size() - 1));
             }
 
           // step 4b: go through the cells and compute the information using
@@ -2852,12 +2882,67 @@ namespace internal
                 update_flags_cells,
                 plain_quadrature_points,
                 shape_infos[my_q],
+                cell_geometry_on_the_fly,
                 my_data);
             },
             std::max(cell_type.size() / MultithreadInfo::n_threads() / 2,
                      std::size_t(2U)));
         }
 
+      // step 4c: in case the geometry of general cells is computed on the
+      // fly, keep the support points of the mapping of those cells and the
+      // interpolation matrices to the quadrature points, in the number
+      // format of the matrix-free evaluation or in single precision
+      cell_mapping_support_points.clear();
+      cell_mapping_support_points_single_precision.clear();
+      cell_mapping_support_point_offsets.clear();
+      cell_mapping_shape_info.clear();
+      if (cell_geometry_on_the_fly)
+        {
+          cell_mapping_support_point_offsets.resize(
+            cell_type.size(), numbers::invalid_unsigned_int);
+          unsigned int n_general_batches = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] > affine && process_cell[cell])
+              cell_mapping_support_point_offsets[cell] =
+                (n_general_batches++) * n_mapping_points * dim;
+            else if (cell_type[cell] > affine)
+              cell_mapping_support_point_offsets[cell] =
+                cell_mapping_support_point_offsets[cell_data_index_vect[cell]];
+
+          if (cell_geometry_in_single_precision)
+            cell_mapping_support_points_single_precision.resize_fast(
+              n_general_batches * n_mapping_points * dim * n_lanes);
+          else
+            cell_mapping_support_points.resize_fast(n_general_batches *
+                                                    n_mapping_points * dim);
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] > affine && process_cell[cell])
+              {
+                const unsigned int offset =
+                  cell_mapping_support_point_offsets[cell];
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  {
+                    const double *points = plain_quadrature_points.data() +
+                                           (cell * n_lanes + v) *
+                                             n_mapping_points * dim;
+                    if (cell_geometry_in_single_precision)
+                      for (unsigned int i = 0; i < n_mapping_points * dim; ++i)
+                        cell_mapping_support_points_single_precision
+                          [(offset + i) * n_lanes + v] = points[i];
+                    else
+                      for (unsigned int i = 0; i < n_mapping_points * dim; ++i)
+                        cell_mapping_support_points[offset + i][v] = points[i];
+                  }
+              }
+
+          FE_DGQ<dim> fe_geometry(mapping_degree);
+          cell_mapping_shape_info.resize(cell_data.size());
+          for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
+            cell_mapping_shape_info[my_q].reinit(
+              cell_data[my_q].descriptor[0].quadrature, fe_geometry);
+        }
+
       const std::vector<FaceToCellTopology<VectorizedArrayType::size()>>
         &faces = face_info.faces;
       if (faces.empty())
@@ -3038,6 +3123,82 @@ namespace internal
 
 
 
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    MappingInfo<dim, Number, VectorizedArrayType>::compute_cell_data_on_the_fly(
+      const unsigned int                                 cell_chunk_no,
+      const unsigned int                                 quad_no,
+      MappingInfoStorage<dim, dim, VectorizedArrayType> &data,
+      AlignedVector<VectorizedArrayType>                &scratch_data) const
+    {
+      Assert(cell_data_is_computed_on_the_fly(cell_chunk_no),
+             ExcInternalError());
+      AssertIndexRange(quad_no, cell_mapping_shape_info.size());
+
+      const ShapeInfo<Number> &shape_info = cell_mapping_shape_info[quad_no];
+      const Quadrature<dim>   &quadrature =
+        cell_data[quad_no].descriptor[0].quadrature;
+      const unsigned int n_q_points = quadrature.size();
+
+      // interpolate the support points of the mapping and their derivatives
+      // to the quadrature points with sum factorization
+      FEEvaluationData<dim, VectorizedArrayType, false> eval(shape_info);
+      eval.set_data_pointers(&scratch_data, dim);
+      const unsigned int offset =
+        cell_mapping_support_point_offsets[cell_chunk_no];
+      const VectorizedArrayType *support_points = nullptr;
+      if (cell_geometry_in_single_precision)
+        {
+          // convert to the number format of the evaluation with vectorized
+          // loads
+          constexpr unsigned int n_lanes = VectorizedArrayType::size();
+          const unsigned int     n_entries =
+            shape_info.dofs_per_component_on_cell * dim;
+          const float *points_float =
+            cell_mapping_support_points_single_precision.data() +
+            offset * n_lanes;
+          for (unsigned int i = 0; i < n_entries; ++i)
+            eval.begin_dof_values()[i].load(points_float + i * n_lanes);
+          support_points = eval.begin_dof_values();
+        }
+      else
+        support_points = cell_mapping_support_points.data() + offset;
+      FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+        dim,
+        EvaluationFlags::values | EvaluationFlags::gradients,
+        support_points,
+        eval);
+
+      if (data.jacobians[0].size() != n_q_points)
+        data.jacobians[0].resize_fast(n_q_points);
+      if (data.JxW_values.size() != n_q_points)
+        data.JxW_values.resize_fast(n_q_points);
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          Tensor<2, dim, VectorizedArrayType> jac;
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              jac[d][e] =
+                eval.begin_gradients()[e + (d * n_q_points + q) * dim];
+          const VectorizedArrayType jac_det = determinant(jac);
+
+          data.jacobians[0][q] = transpose(invert(jac));
+          data.JxW_values[q]   = jac_det * Number(quadrature.weight(q));
+        }
+
+      if (update_flags_cells & update_quadrature_points)
+        {
+          if (data.quadrature_points.size() != n_q_points)
+            data.quadrature_points.resize_fast(n_q_points);
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int q = 0; q < n_q_points; ++q)
+              data.quadrature_points[q][d] =
+                eval.begin_values()[q + d * n_q_points];
+        }
+    }
+
+
+
     template <int dim, typename Number, typename VectorizedArrayType>
     void
     MappingInfo<dim, Number, VectorizedArrayType>::initialize_faces_by_cells(
@@ -3377,6 +3538,13 @@ namespace internal
       memory += face_type.capacity() * sizeof(GeometryType);
       memory += faces_by_cells_type.capacity() *
                 ReferenceCells::max_n_faces<dim>() * sizeof(GeometryType);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_mapping_support_points);
+      memory += MemoryConsumption::memory_consumption(
+        cell_mapping_support_points_single_precision);
+      memory += MemoryConsumption::memory_consumption(
+        cell_mapping_support_point_offsets);
+      memory += MemoryConsumption::memory_consumption(cell_mapping_shape_info);
       memory += sizeof(*this);
       return memory;
     }
@@ -3405,6 +3573,19 @@ namespace internal
                                           ReferenceCells::max_n_faces<dim>() *
                                           sizeof(GeometryType));
 
+      if (cell_geometry_on_the_fly)
+        {
+          out << "    Cell mapping support points:     ";
+          task_info.print_memory_statistics(
+            out,
+            MemoryConsumption::memory_consumption(
+              cell_mapping_support_points) +
+              MemoryConsumption::memory_consumption(
+                cell_mapping_support_points_single_precision) +
+              MemoryConsumption::memory_consumption(
+                cell_mapping_support_point_offsets));
+        }
+
       for (unsigned int j = 0; j < cell_data.size(); ++j)
         {
           out << "    Data component " << j << std::endl;
@@ -251,6 +251,8 @@ public:
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
       , store_ghost_cells(false)
+      , compute_cell_geometry_on_the_fly(false)
+      , store_cell_geometry_in_single_precision(false)
       , communicator_sm(MPI_COMM_SELF)
     {}
 
@@ -278,6 +280,9 @@ public:
           other.cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
       , store_ghost_cells(other.store_ghost_cells)
+      , compute_cell_geometry_on_the_fly(other.compute_cell_geometry_on_the_fly)
+      , store_cell_geometry_in_single_precision(
+          other.store_cell_geometry_in_single_precision)
       , communicator_sm(other.communicator_sm)
     {}
 
@@ -537,6 +542,44 @@ public:
      */
     bool store_ghost_cells;
 
+    /**
+     * Option to control whether the Jacobians, JxW values and quadrature
+     * points on curved cells are cached or computed on the fly. By default,
+     * the geometry is cached at all quadrature points, which for high-order
+     * mappings on curved meshes often consumes more memory than the solution
+     * vectors and makes the memory transfer of the geometry the limiting
+     * factor of operator evaluation. If set to true, only the support points
+     * of the mapping are stored for cell batches of general type, i.e.,
+     * $(p+1)^d$ points per cell for a mapping of degree $p$, and the
+     * geometry is recomputed by sum factorization within
+     * FEEvaluation::reinit(), trading arithmetic operations for memory
+     * transfer. Cartesian and affine cells as well as all face data are not
+     * affected.
+     *
+     * The option is only available for mappings of type MappingQ (or derived
+     * classes) without hp-adaptivity, and when no Jacobian gradients (i.e.,
+     * update_hessians or update_jacobian_grads) are requested on cells. In
+     * all other cases, the flag is ignored and the data is cached as usual.
+     * The option is not supported by FEEvaluation::reinit() for an arbitrary
+     * set of cells given by their indices and by code that accesses the
+     * cached cell data of MappingInfo directly.
+     */
+    bool compute_cell_geometry_on_the_fly;
+
+    /**
+     * Option to store the support points of the mapping used by
+     * compute_cell_geometry_on_the_fly in single precision, while the
+     * geometry is still computed in the number format of the evaluation.
+     * This halves the memory transfer for the geometry of curved cells when
+     * computing in double precision, at the cost of perturbing the geometry
+     * at the level of the single-precision roundoff. This is mostly useful
+     * together with vectors in single precision, e.g., in multigrid
+     * preconditioners or when the vector entries are anyway only accurate to
+     * that level. The option has no effect unless
+     * compute_cell_geometry_on_the_fly is set and active. Default: false.
+     */
+    bool store_cell_geometry_in_single_precision;
+
     /**
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
@@ -1481,6 +1524,19 @@ public:
    * FEFaceEvaluation::reinit(cell, face_no) to access quantities on arbitrary
    * faces of a cell and the respective neighbors.
    *
+   * Since the cell and its face integrals are computed in one go, the
+   * quantities of the interior side of each face do not need to be read from
+   * the vector again: FEFaceEvaluation::evaluate_from_cell_quadrature()
+   * interpolates the values the FEEvaluation object holds at the cell
+   * quadrature points to the face, and
+   * FEFaceEvaluation::integrate_into_cell_quadrature() adds the tested face
+   * terms to the values submitted to FEEvaluation, such that a single call to
+   * FEEvaluation::integrate() and a single write into @p dst complete all
+   * integrals of a cell. Together, the vector @p src is then only accessed
+   * once for each cell and once for each neighbor, and @p dst once for each
+   * cell. This requires that the 1d quadrature formula has more points than
+   * the polynomial degree of the element.
+   *
    * @param cell_operation Pointer to member function of `CLASS` with the
    * signature <tt>cell_operation (const MatrixFree<dim,Number> &, OutVector &,
    * InVector &, std::pair<unsigned int,unsigned int> &)</tt> where the first
@@ -3537,7 +3593,10 @@ namespace internal
     update_ghost_values_start(const unsigned int component_in_block_vector,
                               const VectorType  &vec)
     {
-      static_assert(std::is_same_v<Number, typename VectorType::value_type>,
+      using VectorNumber = typename VectorType::value_type;
+      static_assert(std::is_same_v<Number, VectorNumber> ||
+                      (std::is_same_v<Number, double> &&
+                       std::is_same_v<VectorNumber, float>),
                     "Type mismatch between VectorType and VectorDataExchange");
       (void)component_in_block_vector;
       const bool ghosts_set = vec.has_ghost_elements();
@@ -3565,20 +3624,25 @@ namespace internal
 
           tmp_data[component_in_block_vector] =
             matrix_free.acquire_scratch_data_non_threadsafe();
+          // the scratch data is in the number format of MatrixFree, which
+          // also holds vectors stored in a lower precision
           tmp_data[component_in_block_vector]->resize_fast(
             part.n_import_indices());
           AssertDimension(requests.size(), tmp_data.size());
 
           part.export_to_ghosted_array_start(
             component_in_block_vector * 2 + channel_shift,
-            ArrayView<const Number>(vec.begin(), part.locally_owned_size()),
+            ArrayView<const VectorNumber>(vec.begin(),
+                                          part.locally_owned_size()),
             vec.shared_vector_data(),
-            ArrayView<Number>(const_cast<Number *>(vec.begin()) +
-                                part.locally_owned_size(),
-                              matrix_free.get_dof_info(mf_component)
-                                .vector_partitioner->n_ghost_indices()),
-            ArrayView<Number>(tmp_data[component_in_block_vector]->begin(),
-                              part.n_import_indices()),
+            ArrayView<VectorNumber>(const_cast<VectorNumber *>(vec.begin()) +
+                                      part.locally_owned_size(),
+                                    matrix_free.get_dof_info(mf_component)
+                                      .vector_partitioner->n_ghost_indices()),
+            ArrayView<VectorNumber>(
+              reinterpret_cast<VectorNumber *>(
+                tmp_data[component_in_block_vector]->begin()),
+              part.n_import_indices()),
             this->requests[component_in_block_vector]);
 #  endif
         }
@@ -3637,7 +3701,10 @@ namespace internal
     update_ghost_values_finish(const unsigned int component_in_block_vector,
                                const VectorType  &vec)
     {
-      static_assert(std::is_same_v<Number, typename VectorType::value_type>,
+      using VectorNumber = typename VectorType::value_type;
+      static_assert(std::is_same_v<Number, VectorNumber> ||
+                      (std::is_same_v<Number, double> &&
+                       std::is_same_v<VectorNumber, float>),
                     "Type mismatch between VectorType and VectorDataExchange");
       (void)component_in_block_vector;
 
@@ -3658,12 +3725,14 @@ namespace internal
               part.n_import_sm_procs() != 0)
             {
               part.export_to_ghosted_array_finish(
-                ArrayView<const Number>(vec.begin(), part.locally_owned_size()),
+                ArrayView<const VectorNumber>(vec.begin(),
+                                              part.locally_owned_size()),
                 vec.shared_vector_data(),
-                ArrayView<Number>(const_cast<Number *>(vec.begin()) +
-                                    part.locally_owned_size(),
-                                  matrix_free.get_dof_info(mf_component)
-                                    .vector_partitioner->n_ghost_indices()),
+                ArrayView<VectorNumber>(
+                  const_cast<VectorNumber *>(vec.begin()) +
+                    part.locally_owned_size(),
+                  matrix_free.get_dof_info(mf_component)
+                    .vector_partitioner->n_ghost_indices()),
                 this->requests[component_in_block_vector]);
 
               matrix_free.release_scratch_data_non_threadsafe(
@@ -3745,7 +3814,10 @@ namespace internal
     compress_start(const unsigned int component_in_block_vector,
                    VectorType        &vec)
     {
-      static_assert(std::is_same_v<Number, typename VectorType::value_type>,
+      using VectorNumber = typename VectorType::value_type;
+      static_assert(std::is_same_v<Number, VectorNumber> ||
+                      (std::is_same_v<Number, double> &&
+                       std::is_same_v<VectorNumber, float>),
                     "Type mismatch between VectorType and VectorDataExchange");
       (void)component_in_block_vector;
       Assert(vec.has_ghost_elements() == false, ExcNotImplemented());
@@ -3763,6 +3835,8 @@ namespace internal
 
           tmp_data[component_in_block_vector] =
             matrix_free.acquire_scratch_data_non_threadsafe();
+          // the scratch data is in the number format of MatrixFree, which
+          // also holds vectors stored in a lower precision
           tmp_data[component_in_block_vector]->resize_fast(
             part.n_import_indices());
           AssertDimension(requests.size(), tmp_data.size());
@@ -3770,13 +3844,15 @@ namespace internal
           part.import_from_ghosted_array_start(
             VectorOperation::add,
             component_in_block_vector * 2 + channel_shift,
-            ArrayView<Number>(vec.begin(), part.locally_owned_size()),
+            ArrayView<VectorNumber>(vec.begin(), part.locally_owned_size()),
             vec.shared_vector_data(),
-            ArrayView<Number>(vec.begin() + part.locally_owned_size(),
-                              matrix_free.get_dof_info(mf_component)
-                                .vector_partitioner->n_ghost_indices()),
-            ArrayView<Number>(tmp_data[component_in_block_vector]->begin(),
-                              part.n_import_indices()),
+            ArrayView<VectorNumber>(vec.begin() + part.locally_owned_size(),
+                                    matrix_free.get_dof_info(mf_component)
+                                      .vector_partitioner->n_ghost_indices()),
+            ArrayView<VectorNumber>(
+              reinterpret_cast<VectorNumber *>(
+                tmp_data[component_in_block_vector]->begin()),
+              part.n_import_indices()),
             this->requests[component_in_block_vector]);
 #  endif
         }
@@ -3831,7 +3907,10 @@ namespace internal
     compress_finish(const unsigned int component_in_block_vector,
                     VectorType        &vec)
     {
-      static_assert(std::is_same_v<Number, typename VectorType::value_type>,
+      using VectorNumber = typename VectorType::value_type;
+      static_assert(std::is_same_v<Number, VectorNumber> ||
+                      (std::is_same_v<Number, double> &&
+                       std::is_same_v<VectorNumber, float>),
                     "Type mismatch between VectorType and VectorDataExchange");
       (void)component_in_block_vector;
       if (vec.size() != 0)
@@ -3849,13 +3928,15 @@ namespace internal
             {
               part.import_from_ghosted_array_finish(
                 VectorOperation::add,
-                ArrayView<Number>(vec.begin(), part.locally_owned_size()),
+                ArrayView<VectorNumber>(vec.begin(), part.locally_owned_size()),
                 vec.shared_vector_data(),
-                ArrayView<Number>(vec.begin() + part.locally_owned_size(),
-                                  matrix_free.get_dof_info(mf_component)
-                                    .vector_partitioner->n_ghost_indices()),
-                ArrayView<const Number>(
-                  tmp_data[component_in_block_vector]->begin(),
+                ArrayView<VectorNumber>(
+                  vec.begin() + part.locally_owned_size(),
+                  matrix_free.get_dof_info(mf_component)
+                    .vector_partitioner->n_ghost_indices()),
+                ArrayView<const VectorNumber>(
+                  reinterpret_cast<const VectorNumber *>(
+                    tmp_data[component_in_block_vector]->begin()),
                   part.n_import_indices()),
                 this->requests[component_in_block_vector]);
 
@@ -3918,7 +3999,10 @@ namespace internal
     void
     reset_ghost_values(const VectorType &vec) const
     {
-      static_assert(std::is_same_v<Number, typename VectorType::value_type>,
+      using VectorNumber = typename VectorType::value_type;
+      static_assert(std::is_same_v<Number, VectorNumber> ||
+                      (std::is_same_v<Number, double> &&
+                       std::is_same_v<VectorNumber, float>),
                     "Type mismatch between VectorType and VectorDataExchange");
       if (ghosts_were_set == true)
         return;
@@ -3935,10 +4019,11 @@ namespace internal
           if (part.n_ghost_indices() > 0)
             {
               part.reset_ghost_values(
-                ArrayView<Number>(const_cast<VectorType &>(vec).begin() +
-                                    part.locally_owned_size(),
-                                  matrix_free.get_dof_info(mf_component)
-                                    .vector_partitioner->n_ghost_indices()));
+                ArrayView<VectorNumber>(
+                  const_cast<VectorType &>(vec).begin() +
+                    part.locally_owned_size(),
+                  matrix_free.get_dof_info(mf_component)
+                    .vector_partitioner->n_ghost_indices()));
             }
 
 #  endif
@@ -3960,7 +4045,10 @@ namespace internal
     void
     zero_vector_region(const unsigned int range_index, VectorType &vec) const
     {
-      static_assert(std::is_same_v<Number, typename VectorType::value_type>,
+      using VectorNumber = typename VectorType::value_type;
+      static_assert(std::is_same_v<Number, VectorNumber> ||
+                      (std::is_same_v<Number, double> &&
+                       std::is_same_v<VectorNumber, float>),
                     "Type mismatch between VectorType and VectorDataExchange");
       if (range_index == numbers::invalid_unsigned_int)
         vec = Number();
@@ -3984,7 +4072,7 @@ namespace internal
                         0,
                         (dof_info.vector_zero_range_list[id].second -
                          dof_info.vector_zero_range_list[id].first) *
-                          sizeof(Number));
+                          sizeof(VectorNumber));
         }
     }
 
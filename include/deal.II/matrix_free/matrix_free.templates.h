@@ -856,7 +856,9 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.compute_cell_geometry_on_the_fly,
+        additional_data.store_cell_geometry_in_single_precision);
 
       mapping_is_initialized = true;
     }
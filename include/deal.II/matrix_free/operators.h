@@ -21,6 +21,7 @@
 
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/diagonal_matrix.h>
@@ -32,6 +33,8 @@
 
 #include <deal.II/multigrid/mg_constrained_dofs.h>
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -311,6 +314,32 @@ namespace MatrixFreeOperators
     void
     vmult(VectorType &dst, const VectorType &src) const;
 
+    /**
+     * Matrix-vector multiplication that runs the two given functions on
+     * sub-ranges of the locally owned vector entries close to the time the
+     * loop over cells touches them, see MatrixFree::cell_loop(). The function
+     * @p operation_before_matrix_vector_product must set the entries of
+     * @p dst in the given range to zero, whereas
+     * @p operation_after_matrix_vector_product may access the final result in
+     * the given range of @p dst. This is the signature PreconditionChebyshev
+     * and PreconditionRelaxation look for in order to embed their vector
+     * updates into the operator application, which reduces the number of
+     * passes through the vectors in each iteration.
+     *
+     * Constrained degrees of freedom and indices at the refinement edge of
+     * a multigrid level are treated as in vmult(), i.e., as rows of the unit
+     * matrix.
+     *
+     * @note This function only supports the non-blocked vector variant.
+     */
+    void
+    vmult(VectorType       &dst,
+          const VectorType &src,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_before_matrix_vector_product,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_after_matrix_vector_product) const;
+
     /**
      * Transpose matrix-vector multiplication.
      */
@@ -428,6 +457,28 @@ namespace MatrixFreeOperators
     virtual void
     Tapply_add(VectorType &dst, const VectorType &src) const;
 
+    /**
+     * Apply operator to @p src and write the result into @p dst, running
+     * @p operation_before_loop and @p operation_after_loop on sub-ranges of
+     * the locally owned entries as described for MatrixFree::cell_loop(),
+     * with the unit matrix applied on the constrained degrees of freedom.
+     * This is the case if the derived class calls MatrixFree::cell_loop()
+     * with the two operations.
+     *
+     * The default implementation runs @p operation_before_loop on all
+     * entries, calls apply_add() and sets the constrained entries, and runs
+     * @p operation_after_loop on all entries, i.e., it does not fuse the
+     * operations into the loop.
+     */
+    virtual void
+    apply_with_pre_post_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const;
+
     /**
      * MatrixFree object to be used with this operator.
      */
@@ -824,6 +875,20 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Same as apply_add(), but running the given operations on sub-ranges
+     * of the vector entries within the loop over cells, see
+     * MatrixFree::cell_loop().
+     */
+    virtual void
+    apply_with_pre_post_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const override;
+
     /**
      * For this operator, there is just a cell contribution.
      */
@@ -974,6 +1039,20 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Same as apply_add(), but running the given operations on sub-ranges
+     * of the vector entries within the loop over cells, see
+     * MatrixFree::cell_loop().
+     */
+    virtual void
+    apply_with_pre_post_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const override;
+
     /**
      * Applies the Laplace operator on a cell.
      */
@@ -1472,6 +1551,55 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::vmult(
+    VectorType       &dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_matrix_vector_product,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_matrix_vector_product) const
+  {
+    AssertDimension(dst.size(), src.size());
+    AssertDimension(BlockHelper::n_blocks(dst), 1);
+    AssertDimension(BlockHelper::n_blocks(src), 1);
+
+    // zero the refinement edge entries of src, remembering the values
+    preprocess_constraints(dst, src);
+
+    // reset the values in src and apply the unit matrix on the edge entries
+    // of each range before passing it to the operation after the loop, as
+    // the loop does not touch the range any more. The operation is always
+    // passed on because MatrixFree::cell_loop() only sets the constrained
+    // entries in that case.
+    const std::vector<unsigned int> &edge_indices = edge_constrained_indices[0];
+    const auto operation_after = [&](const unsigned int begin,
+                                     const unsigned int end) {
+      VectorType &src_vector = const_cast<VectorType &>(src);
+      for (auto it = std::lower_bound(edge_indices.begin(),
+                                      edge_indices.end(),
+                                      begin);
+           it != edge_indices.end() && *it < end;
+           ++it)
+        {
+          const value_type value =
+            edge_constrained_values[0][it - edge_indices.begin()].first;
+          BlockHelper::subblock(src_vector, 0).local_element(*it) = value;
+          BlockHelper::subblock(dst, 0).local_element(*it)        = value;
+        }
+      if (operation_after_matrix_vector_product)
+        operation_after_matrix_vector_product(begin, end);
+    };
+
+    apply_with_pre_post_operations(dst,
+                                   src,
+                                   operation_before_matrix_vector_product,
+                                   operation_after);
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::vmult_add(
@@ -1787,6 +1915,41 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::apply_with_pre_post_operations(
+    VectorType       &dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_loop,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_loop) const
+  {
+    const unsigned int locally_owned_size =
+      BlockHelper::subblock(dst, 0).locally_owned_size();
+    if (operation_before_loop)
+      dealii::parallel::apply_to_subranges(
+        0U,
+        locally_owned_size,
+        operation_before_loop,
+        internal::VectorImplementation::minimum_parallel_grain_size);
+
+    apply_add(dst, src);
+    for (const unsigned int constrained_dof :
+         data->get_constrained_dofs(selected_rows[0]))
+      BlockHelper::subblock(dst, 0).local_element(constrained_dof) =
+        BlockHelper::subblock(src, 0).local_element(constrained_dof);
+
+    if (operation_after_loop)
+      dealii::parallel::apply_to_subranges(
+        0U,
+        locally_owned_size,
+        operation_after_loop,
+        internal::VectorImplementation::minimum_parallel_grain_size);
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::precondition_Jacobi(
@@ -2115,6 +2278,39 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  MassOperator<dim,
+               fe_degree,
+               n_q_points_1d,
+               n_components,
+               VectorType,
+               VectorizedArrayType>::
+    apply_with_pre_post_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &MassOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
+
+
   template <int dim,
             int fe_degree,
             int n_q_points_1d,
@@ -2308,6 +2504,39 @@ namespace MatrixFreeOperators
       &LaplaceOperator::local_apply_cell, this, dst, src);
   }
 
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  LaplaceOperator<dim,
+                  fe_degree,
+                  n_q_points_1d,
+                  n_components,
+                  VectorType,
+                  VectorizedArrayType>::
+    apply_with_pre_post_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &LaplaceOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
   namespace Implementation
   {
     template <typename VectorizedArrayType>
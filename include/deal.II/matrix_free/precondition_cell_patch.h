@@ -0,0 +1,566 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_precondition_cell_patch_h
+#define dealii_matrix_free_precondition_cell_patch_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <array>
+#include <functional>
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * An additive Schwarz preconditioner for the symmetric interior penalty
+ * discontinuous Galerkin discretization of the Laplacian in a matrix-free
+ * context, where each subdomain (patch) is a single cell. For discontinuous
+ * elements, the patches do not overlap, so this is a block-Jacobi method
+ * with the cell matrices as blocks.
+ *
+ * The cell matrices are not computed from the actual operator. Instead, the
+ * matrix on each cell is approximated by a separable matrix
+ * @f[
+ *   A_K = \sum_{d=1}^{\text{dim}} M_\text{dim} \otimes \cdots \otimes
+ *   L_d \otimes \cdots \otimes M_1,
+ * @f]
+ * where $M_d$ is the 1d mass matrix and $L_d$ the 1d matrix of the interior
+ * penalty Laplacian on the cell in direction $d$, the latter including the
+ * contributions of the two faces of the cell in that direction. The extent
+ * of the cell in each direction is taken from the Jacobian of the mapping,
+ * so the approximation is exact for Cartesian cells away from the boundary.
+ * All faces are treated like interior faces. The inverse of $A_K$ is applied
+ * with the fast diagonalization method of TensorProductMatrixSymmetricSum,
+ * at a cost comparable to a matrix-free operator evaluation. The 1d matrices
+ * are stored in a TensorProductMatrixSymmetricSumCollection. It vectorizes
+ * over the cells of a cell batch of MatrixFree and stores each distinct set
+ * of 1d matrices only once, so uniform Cartesian meshes need very little
+ * memory.
+ *
+ * The vmult() function applies the inverse of the block diagonal within
+ * MatrixFree::cell_loop(), with one task per range of cell batches. Nothing
+ * is assembled. The overload of vmult() that takes two std::function objects
+ * forwards them to MatrixFree::cell_loop(). PreconditionRelaxation detects
+ * this overload and fuses its vector updates into the loop.
+ *
+ * The class is meant to be used as the preconditioner of a relaxation method
+ * or of a Chebyshev iteration. Together with MGSmootherPrecondition it gives
+ * a multigrid smoother for the levels of a matrix-free DG discretization.
+ * @code
+ * using SmootherType =
+ *   PreconditionChebyshev<LevelMatrixType,
+ *                         VectorType,
+ *                         PreconditionCellPatch<dim, fe_degree, double>>;
+ * MGSmootherPrecondition<LevelMatrixType, SmootherType, VectorType>
+ *   mg_smoother;
+ * MGLevelObject<SmootherType::AdditionalData> smoother_data(min_level,
+ *                                                           max_level);
+ * for (unsigned int level = min_level; level <= max_level; ++level)
+ *   {
+ *     smoother_data[level].preconditioner =
+ *       std::make_shared<PreconditionCellPatch<dim, fe_degree, double>>();
+ *     smoother_data[level].preconditioner->initialize(
+ *       level_matrices[level].get_matrix_free());
+ *     smoother_data[level].degree          = 3;
+ *     smoother_data[level].smoothing_range = 15.;
+ *   }
+ * mg_smoother.initialize(level_matrices, smoother_data);
+ * @endcode
+ * Instead of PreconditionChebyshev, PreconditionRelaxation with
+ * PreconditionCellPatch as its preconditioner gives a damped block-Jacobi
+ * smoother.
+ *
+ * The class supports discontinuous elements with tensor-product shape
+ * functions of degree @p fe_degree, like FE_DGQ, FE_DGQLegendre or
+ * FE_DGQHermite, and FESystem objects with several copies of such an
+ * element, where the same inverse is applied to each component. The
+ * MatrixFree object needs a quadrature formula with @p fe_degree+1 points
+ * in each direction for the given quadrature index.
+ */
+template <int dim,
+          int fe_degree,
+          typename Number              = double,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class PreconditionCellPatch : public EnableObserverPointer
+{
+public:
+  /**
+   * The vector type this preconditioner works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Parameters of the preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(
+      const double       penalty_factor = (fe_degree + 1) * (fe_degree + 1),
+      const unsigned int dof_index      = 0,
+      const unsigned int quad_index     = 0);
+
+    /**
+     * The penalty parameter of the interior penalty method on the unit cell.
+     * On a cell with extent $h_d$ in direction $d$, the penalty on the faces
+     * in that direction is this value divided by $h_d$. It should match the
+     * penalty of the operator that is preconditioned.
+     */
+    double penalty_factor;
+
+    /**
+     * The index of the DoFHandler within the MatrixFree object.
+     */
+    unsigned int dof_index;
+
+    /**
+     * The index of the quadrature formula within the MatrixFree object. The
+     * quadrature formula needs to have @p fe_degree+1 points per direction.
+     */
+    unsigned int quad_index;
+  };
+
+  /**
+   * Set up the 1d matrices and their eigendecompositions for all cell
+   * batches of @p matrix_free.
+   */
+  void
+  initialize(
+    const std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+                         &matrix_free,
+    const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the inverse of the cell matrices to @p src and store the result in
+   * @p dst.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the inverse of the cell matrices to @p src and add the result to
+   * @p dst. The two functions are passed to MatrixFree::cell_loop(). They
+   * are called on ranges of the locally owned entries of the vectors before
+   * the entries are first read and after they are last written within the
+   * loop, respectively.
+   */
+  void
+  vmult(VectorType       &dst,
+        const VectorType &src,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_before_loop,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_after_loop) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the cell matrices are
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the number of rows of the preconditioner, i.e., the size of the
+   * vectors it works on.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the preconditioner.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the memory consumption of this object in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Apply the inverse of the cell matrices on a range of cell batches,
+   * adding the result into @p dst.
+   */
+  void
+  local_apply_inverse(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                         &dst,
+    const VectorType                                   &src,
+    const std::pair<unsigned int, unsigned int>        &cell_range) const;
+
+  /**
+   * The MatrixFree object the preconditioner was set up for.
+   */
+  std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+    matrix_free;
+
+  /**
+   * The index of the DoFHandler within the MatrixFree object.
+   */
+  unsigned int dof_index;
+
+  /**
+   * The index of the quadrature formula within the MatrixFree object.
+   */
+  unsigned int quad_index;
+
+  /**
+   * The number of components of the finite element.
+   */
+  unsigned int n_components;
+
+  /**
+   * The 1d matrices and their eigendecompositions for all cell batches.
+   */
+  std::unique_ptr<
+    TensorProductMatrixSymmetricSumCollection<dim,
+                                              VectorizedArrayType,
+                                              fe_degree + 1>>
+    cell_matrices;
+};
+
+/** @} */
+
+
+/* ------------------------- inline functions -------------------------- */
+
+#ifndef DOXYGEN
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::
+  AdditionalData::AdditionalData(const double       penalty_factor,
+                                 const unsigned int dof_index,
+                                 const unsigned int quad_index)
+  : penalty_factor(penalty_factor)
+  , dof_index(dof_index)
+  , quad_index(quad_index)
+{}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+void
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::initialize(
+  const std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+                       &matrix_free,
+  const AdditionalData &additional_data)
+{
+  this->matrix_free = matrix_free;
+  dof_index         = additional_data.dof_index;
+  quad_index        = additional_data.quad_index;
+
+  const FiniteElement<dim> &fe =
+    matrix_free->get_dof_handler(dof_index).get_fe();
+  AssertThrow(fe.n_dofs_per_vertex() == 0 && fe.n_dofs_per_face() == 0,
+              ExcMessage("PreconditionCellPatch only supports discontinuous "
+                         "elements."));
+  AssertThrow(fe.n_base_elements() == 1,
+              ExcMessage("PreconditionCellPatch only supports elements with "
+                         "a single base element."));
+  n_components = fe.n_components();
+
+  const internal::MatrixFreeFunctions::ShapeInfo<Number> &shape_info =
+    matrix_free->get_shape_info(dof_index, quad_index);
+  AssertThrow(shape_info.element_type <=
+                internal::MatrixFreeFunctions::tensor_general,
+              ExcMessage("PreconditionCellPatch only supports elements with "
+                         "tensor-product shape functions."));
+  AssertThrow(shape_info.data[0].fe_degree == fe_degree &&
+                shape_info.data[0].n_q_points_1d == fe_degree + 1,
+              ExcMessage("The element and the quadrature formula of the "
+                         "MatrixFree object must match the template "
+                         "parameter fe_degree of PreconditionCellPatch."));
+
+  // compute the 1d mass matrices and the 1d Laplace matrices with the face
+  // terms of the interior penalty method on the unit interval
+  constexpr unsigned int N = fe_degree + 1;
+  std::array<Table<2, Number>, dim> mass_unscaled;
+  std::array<Table<2, Number>, dim> laplace_unscaled;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      const auto &data       = shape_info.get_shape_data(d, 0);
+      const auto &quadrature = data.quadrature;
+      const auto &values_0   = data.shape_data_on_face[0];
+      const auto &values_1   = data.shape_data_on_face[1];
+
+      mass_unscaled[d].reinit(N, N);
+      laplace_unscaled[d].reinit(N, N);
+      for (unsigned int i = 0; i < N; ++i)
+        for (unsigned int j = 0; j < N; ++j)
+          {
+            Number sum_mass = 0, sum_laplace = 0;
+            for (unsigned int q = 0; q < quadrature.size(); ++q)
+              {
+                sum_mass += data.shape_values[i * N + q] *
+                            data.shape_values[j * N + q] *
+                            quadrature.weight(q);
+                sum_laplace += data.shape_gradients[i * N + q] *
+                               data.shape_gradients[j * N + q] *
+                               quadrature.weight(q);
+              }
+
+            // face at x=0 with outer normal -1 and face at x=1 with outer
+            // normal +1, each with the average of the derivative and the
+            // penalty term
+            sum_laplace += values_0[i] * values_0[j] *
+                             additional_data.penalty_factor +
+                           0.5 * values_0[N + i] * values_0[j] +
+                           0.5 * values_0[N + j] * values_0[i];
+            sum_laplace += values_1[i] * values_1[j] *
+                             additional_data.penalty_factor -
+                           0.5 * values_1[N + i] * values_1[j] -
+                           0.5 * values_1[N + j] * values_1[i];
+
+            mass_unscaled[d](i, j)    = sum_mass;
+            laplace_unscaled[d](i, j) = sum_laplace;
+          }
+    }
+
+  // scale the matrices by the extent of the cells, computed from the length
+  // of the columns of the Jacobian averaged over the quadrature points
+  const unsigned int n_cell_batches = matrix_free->n_cell_batches();
+
+  cell_matrices = std::make_unique<
+    TensorProductMatrixSymmetricSumCollection<dim,
+                                              VectorizedArrayType,
+                                              fe_degree + 1>>();
+  cell_matrices->reserve(n_cell_batches);
+
+  FEEvaluation<dim, fe_degree, fe_degree + 1, 1, Number, VectorizedArrayType>
+    phi(*matrix_free, dof_index, quad_index);
+  std::array<Table<2, VectorizedArrayType>, dim> mass_matrices;
+  std::array<Table<2, VectorizedArrayType>, dim> laplace_matrices;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      mass_matrices[d].reinit(N, N);
+      laplace_matrices[d].reinit(N, N);
+    }
+
+  for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      phi.reinit(cell);
+
+      std::array<VectorizedArrayType, dim> cell_extent;
+      for (unsigned int d = 0; d < dim; ++d)
+        cell_extent[d] = VectorizedArrayType();
+      for (const unsigned int q : phi.quadrature_point_indices())
+        {
+          const Tensor<2, dim, VectorizedArrayType> jacobian =
+            invert(phi.inverse_jacobian(q));
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              VectorizedArrayType length_square = VectorizedArrayType();
+              for (unsigned int e = 0; e < dim; ++e)
+                length_square += jacobian[e][d] * jacobian[e][d];
+              cell_extent[d] += std::sqrt(length_square);
+            }
+        }
+
+      // fill unused lanes of the last cell batch with the data of the
+      // first lane to keep the eigenvalue problems well-posed
+      const unsigned int n_lanes =
+        matrix_free->n_active_entries_per_cell_batch(cell);
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          cell_extent[d] /= static_cast<Number>(phi.n_q_points);
+          for (unsigned int v = n_lanes; v < VectorizedArrayType::size(); ++v)
+            cell_extent[d][v] = cell_extent[d][0];
+        }
+
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int i = 0; i < N; ++i)
+          for (unsigned int j = 0; j < N; ++j)
+            {
+              mass_matrices[d](i, j) = mass_unscaled[d](i, j) * cell_extent[d];
+              laplace_matrices[d](i, j) =
+                laplace_unscaled[d](i, j) / cell_extent[d];
+            }
+
+      cell_matrices->insert(cell, mass_matrices, laplace_matrices);
+    }
+
+  cell_matrices->finalize();
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+void
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::clear()
+{
+  cell_matrices.reset();
+  matrix_free.reset();
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+void
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  Assert(cell_matrices != nullptr, ExcNotInitialized());
+
+  matrix_free->cell_loop(&PreconditionCellPatch::local_apply_inverse,
+                         this,
+                         dst,
+                         src,
+                         true);
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+void
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::vmult(
+  VectorType       &dst,
+  const VectorType &src,
+  const std::function<void(const unsigned int, const unsigned int)>
+    &operation_before_loop,
+  const std::function<void(const unsigned int, const unsigned int)>
+    &operation_after_loop) const
+{
+  Assert(cell_matrices != nullptr, ExcNotInitialized());
+
+  matrix_free->cell_loop(&PreconditionCellPatch::local_apply_inverse,
+                         this,
+                         dst,
+                         src,
+                         operation_before_loop,
+                         operation_after_loop,
+                         dof_index);
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+void
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::Tvmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+typename PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::
+  size_type
+  PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::m() const
+{
+  Assert(matrix_free != nullptr, ExcNotInitialized());
+  return matrix_free->get_dof_handler(dof_index).n_dofs();
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+typename PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::
+  size_type
+  PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::n() const
+{
+  return m();
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+std::size_t
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::
+  memory_consumption() const
+{
+  return sizeof(*this) +
+         (cell_matrices != nullptr ? cell_matrices->memory_consumption() : 0);
+}
+
+
+
+template <int dim, int fe_degree, typename Number, typename VectorizedArrayType>
+void
+PreconditionCellPatch<dim, fe_degree, Number, VectorizedArrayType>::
+  local_apply_inverse(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                         &dst,
+    const VectorType                                   &src,
+    const std::pair<unsigned int, unsigned int>        &cell_range) const
+{
+  for (unsigned int component = 0; component < n_components; ++component)
+    {
+      FEEvaluation<dim,
+                   fe_degree,
+                   fe_degree + 1,
+                   1,
+                   Number,
+                   VectorizedArrayType>
+        phi(matrix_free, dof_index, quad_index, component);
+
+      for (unsigned int cell = cell_range.first; cell < cell_range.second;
+           ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          cell_matrices->apply_inverse(
+            cell,
+            ArrayView<VectorizedArrayType>(phi.begin_dof_values(),
+                                           phi.dofs_per_cell),
+            ArrayView<const VectorizedArrayType>(phi.begin_dof_values(),
+                                                 phi.dofs_per_cell));
+          phi.distribute_local_to_global(dst);
+        }
+    }
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
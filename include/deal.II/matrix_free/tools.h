@@ -17,8 +17,13 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/timer.h>
+
 #include <deal.II/grid/tria.h>
 
+#include <deal.II/matrix_free/dual_number.h>
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/portable_fe_evaluation.h>
@@ -27,6 +32,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <limits>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -654,6 +661,171 @@ namespace MatrixFreeTools
     unsigned int fe_index_valid;
   };
 
+
+
+  /**
+   * Find the settings of the task parallelism in
+   * MatrixFree::AdditionalData, i.e., the fields
+   * MatrixFree::AdditionalData::tasks_parallel_scheme and
+   * MatrixFree::AdditionalData::tasks_block_size, that give the fastest
+   * application of an operator on the present machine. To this end,
+   * a MatrixFree object is set up with @p mapping, @p dof_handler,
+   * @p constraints, and @p quadrature for each combination of the schemes
+   * with the block sizes given in @p block_sizes, starting from the
+   * remaining settings in @p additional_data. The function
+   * @p setup_operation is called with each of these objects and returns the
+   * operation to be measured, e.g., a lambda holding a matrix-free operator
+   * and two vectors that calls vmult():
+   * @code
+   * const auto tuned_data = MatrixFreeTools::
+   *   tune_additional_data<dim, double, VectorizedArray<double>>(
+   *     mapping, dof_handler, constraints, QGauss<1>(degree + 1), data,
+   *     [](const std::shared_ptr<const MatrixFree<dim, double>> &matrix_free) {
+   *       auto laplace = std::make_shared<
+   *         MatrixFreeOperators::LaplaceOperator<dim, degree>>();
+   *       laplace->initialize(matrix_free);
+   *       auto src = std::make_shared<VectorType>();
+   *       auto dst = std::make_shared<VectorType>();
+   *       laplace->initialize_dof_vector(*src);
+   *       laplace->initialize_dof_vector(*dst);
+   *       return std::function<void()>(
+   *         [=]() { laplace->vmult(*dst, *src); });
+   *     });
+   * @endcode
+   * Each operation is run once without measurement and then
+   * @p n_repetitions times, and the minimal run time of the slowest MPI
+   * process decides, such that all processes return the same settings. If
+   * only a single thread is available according to
+   * MultithreadInfo::n_threads(), no measurements are made and the scheme
+   * MatrixFree::AdditionalData::none is returned.
+   *
+   * The returned settings are meant to be stored and used for all subsequent
+   * calls to MatrixFree::reinit() on the same kind of mesh, e.g., on all
+   * levels of a multigrid hierarchy or after each adaptive refinement. The
+   * width of the vectorization, which is a compile-time choice, can be
+   * selected in a similar way with find_fastest_variant().
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename QuadratureType>
+  typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+  tune_additional_data(
+    const Mapping<dim>              &mapping,
+    const DoFHandler<dim>           &dof_handler,
+    const AffineConstraints<Number> &constraints,
+    const QuadratureType            &quadrature,
+    const typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+      &additional_data,
+    const std::function<std::function<void()>(
+      const std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+        &)>                           &setup_operation,
+    const std::vector<unsigned int> &block_sizes   = {0, 8, 32, 128},
+    const unsigned int               n_repetitions = 5);
+
+
+
+  /**
+   * Return the index of the fastest of the given @p operations, measured as
+   * in tune_additional_data(). This is useful to select among variants of a
+   * matrix-free operator that are instantiated ahead of time for different
+   * template arguments, like the width of VectorizedArray, whose best choice
+   * depends on the hardware a program is run on. All processes in
+   * @p communicator return the same index.
+   */
+  inline unsigned int
+  find_fastest_variant(const std::vector<std::function<void()>> &operations,
+                       const MPI_Comm                            communicator,
+                       const unsigned int n_repetitions = 5);
+
+
+
+  /**
+   * Compute the product of the Jacobian of a nonlinear operator, evaluated
+   * at @p linearization_point, with the vector @p src, i.e., the directional
+   * derivative of the operator at @p linearization_point in direction
+   * @p src, and write the result into @p dst. The nonlinear operator is
+   * given in terms of the function @p residual that is invoked at each
+   * quadrature point of each cell with the arguments
+   * <code>(phi, q, value, gradient)</code>, where @p phi is the FEEvaluation
+   * object that has been evaluated at @p linearization_point, @p q is the
+   * index of the quadrature point, and @p value and @p gradient are the
+   * value and the gradient of the solution at the quadrature point. The
+   * function returns a <code>std::pair</code> of the terms to be tested by
+   * the values and by the gradients of the test functions, in the format of
+   * FEEvaluation::submit_value() and FEEvaluation::submit_gradient(). The
+   * residual of the nonlinear operator corresponds to the cell loop
+   * @code
+   * phi.evaluate(evaluation_flags);
+   * for (const unsigned int q : phi.quadrature_point_indices())
+   *   {
+   *     const auto flux =
+   *       residual(phi, q, phi.get_value(q), phi.get_gradient(q));
+   *     phi.submit_value(flux.first, q);
+   *     phi.submit_gradient(flux.second, q);
+   *   }
+   * phi.integrate(integration_flags);
+   * @endcode
+   *
+   * To compute the Jacobian-vector product, the function @p residual is
+   * called with @p value and @p gradient in terms of DualNumber objects over
+   * VectorizedArrayType (i.e., with DualNumber in place of VectorizedArray
+   * in FEEvaluation::value_type and FEEvaluation::gradient_type), with the
+   * directional derivatives set to the values and gradients of @p src. The
+   * function @p residual is hence typically a generic lambda, written once
+   * for both the residual and its linearization, for example for the
+   * operator $-
+abla \cdot ((1+u^2)
+abla u)$:
+   * @code
+   * const auto residual = [](const auto &, const unsigned int,
+   *                          const auto &value, const auto &gradient) {
+   *   return std::make_pair(value * 0., (1. + value * value) * gradient);
+   * };
+   * MatrixFreeTools::compute_jacobian_vector_product<dim, degree>(
+   *   matrix_free, dst, solution, src,
+   *   EvaluationFlags::values | EvaluationFlags::gradients,
+   *   EvaluationFlags::gradients, residual);
+   * @endcode
+   * The derivatives are propagated through the arithmetic operations by
+   * forward-mode automatic differentiation in the same SIMD layout as the
+   * values, such that no hand-derived linearized operator and no assembled
+   * Jacobian matrix are needed, e.g., for Jacobian-free Newton-Krylov
+   * methods.
+   *
+   * The values of @p linearization_point are read without resolving
+   * constraints as in FEEvaluation::read_dof_values_plain(), so the entries
+   * of constrained degrees of freedom must be set, e.g., by
+   * AffineConstraints::distribute(), and its ghost values must be
+   * up to date. The vector @p src is read and @p dst is written with the
+   * constraints of the DoFHandler given by @p dof_handler_index as in
+   * MatrixFree::cell_loop(), i.e., with homogeneous constraints. The
+   * @p evaluation_flags and @p integration_flags may only contain
+   * EvaluationFlags::values and EvaluationFlags::gradients.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d            = fe_degree + 1,
+            int n_components             = 1,
+            typename Number              = double,
+            typename VectorizedArrayType = VectorizedArray<Number>,
+            typename VectorType,
+            typename QuadratureOperation>
+  void
+  compute_jacobian_vector_product(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                          &dst,
+    const VectorType                                    &linearization_point,
+    const VectorType                                    &src,
+    const EvaluationFlags::EvaluationFlags               evaluation_flags,
+    const EvaluationFlags::EvaluationFlags               integration_flags,
+    const QuadratureOperation                           &residual,
+    const unsigned int dof_handler_index        = 0,
+    const unsigned int quadrature_index         = 0,
+    const unsigned int first_selected_component = 0);
+
+
+
   // implementations
 
 #ifndef DOXYGEN
@@ -2684,6 +2856,295 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  namespace internal
+  {
+    /**
+     * Return the minimal wall time of @p n_repetitions runs of
+     * @p operation after an initial run that is not measured, maximized over
+     * all processes in @p communicator.
+     */
+    inline double
+    measure_run_time(const std::function<void()> &operation,
+                     const unsigned int           n_repetitions,
+                     const MPI_Comm               communicator)
+    {
+      operation();
+
+      double min_time = std::numeric_limits<double>::max();
+      for (unsigned int i = 0; i < n_repetitions; ++i)
+        {
+          Timer timer;
+          operation();
+          min_time = std::min(min_time, timer.wall_time());
+        }
+      return Utilities::MPI::max(min_time, communicator);
+    }
+  } // namespace internal
+
+
+
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename QuadratureType>
+  typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+  tune_additional_data(
+    const Mapping<dim>              &mapping,
+    const DoFHandler<dim>           &dof_handler,
+    const AffineConstraints<Number> &constraints,
+    const QuadratureType            &quadrature,
+    const typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+      &additional_data,
+    const std::function<std::function<void()>(
+      const std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+        &)>                           &setup_operation,
+    const std::vector<unsigned int> &block_sizes,
+    const unsigned int               n_repetitions)
+  {
+    using MatrixFreeType = MatrixFree<dim, Number, VectorizedArrayType>;
+    using AdditionalData = typename MatrixFreeType::AdditionalData;
+
+    AssertThrow(n_repetitions > 0,
+                ExcMessage("At least one repetition must be measured."));
+
+    std::vector<AdditionalData> candidates(1, additional_data);
+    candidates[0].tasks_parallel_scheme = AdditionalData::none;
+
+    // without threads, the other schemes only add overhead
+    if (MultithreadInfo::n_threads() == 1)
+      return candidates[0];
+
+    for (const auto scheme : {AdditionalData::partition_partition,
+                              AdditionalData::partition_color,
+                              AdditionalData::color})
+      for (const unsigned int block_size : block_sizes)
+        {
+          candidates.push_back(additional_data);
+          candidates.back().tasks_parallel_scheme = scheme;
+          candidates.back().tasks_block_size      = block_size;
+        }
+
+    // set up one MatrixFree object at a time to keep the memory consumption
+    // at the level of a single object
+    unsigned int best_candidate = 0;
+    double       best_time      = std::numeric_limits<double>::max();
+    for (unsigned int c = 0; c < candidates.size(); ++c)
+      {
+        const auto matrix_free = std::make_shared<MatrixFreeType>();
+        matrix_free->reinit(
+          mapping, dof_handler, constraints, quadrature, candidates[c]);
+
+        const double time =
+          internal::measure_run_time(setup_operation(matrix_free),
+                                     n_repetitions,
+                                     dof_handler.get_mpi_communicator());
+        if (time < best_time)
+          {
+            best_time      = time;
+            best_candidate = c;
+          }
+      }
+
+    return candidates[best_candidate];
+  }
+
+
+
+  inline unsigned int
+  find_fastest_variant(const std::vector<std::function<void()>> &operations,
+                       const MPI_Comm                            communicator,
+                       const unsigned int                        n_repetitions)
+  {
+    Assert(!operations.empty(), ExcMessage("No operation given."));
+    AssertThrow(n_repetitions > 0,
+                ExcMessage("At least one repetition must be measured."));
+
+    unsigned int best_variant = 0;
+    double       best_time    = std::numeric_limits<double>::max();
+    for (unsigned int v = 0; v < operations.size(); ++v)
+      {
+        const double time = internal::measure_run_time(operations[v],
+                                                       n_repetitions,
+                                                       communicator);
+        if (time < best_time)
+          {
+            best_time    = time;
+            best_variant = v;
+          }
+      }
+    return best_variant;
+  }
+
+
+
+  namespace internal
+  {
+    /**
+     * The type obtained by replacing the VectorizedArray in the value or
+     * gradient type @p T of FEEvaluation by DualNumber.
+     */
+    template <typename T>
+    struct DualNumberType
+    {
+      using type = DualNumber<T>;
+    };
+
+    template <int rank, int dim, typename T>
+    struct DualNumberType<Tensor<rank, dim, T>>
+    {
+      using type = Tensor<rank, dim, typename DualNumberType<T>::type>;
+    };
+
+
+
+    /**
+     * Combine the value and the derivative of a quantity of FEEvaluation
+     * into a dual number.
+     */
+    template <typename Number>
+    inline DualNumber<Number>
+    make_dual(const Number &value, const Number &derivative)
+    {
+      return DualNumber<Number>(value, derivative);
+    }
+
+    template <int rank, int dim, typename T>
+    inline typename DualNumberType<Tensor<rank, dim, T>>::type
+    make_dual(const Tensor<rank, dim, T> &value,
+              const Tensor<rank, dim, T> &derivative)
+    {
+      typename DualNumberType<Tensor<rank, dim, T>>::type result;
+      for (unsigned int i = 0; i < dim; ++i)
+        result[i] = make_dual(value[i], derivative[i]);
+      return result;
+    }
+
+
+
+    /**
+     * Extract the derivative of a dual number into the format of
+     * FEEvaluation.
+     */
+    template <typename Number>
+    inline void
+    extract_derivative(const DualNumber<Number> &dual, Number &derivative)
+    {
+      derivative = dual.derivative;
+    }
+
+    template <int rank, int dim, typename T, typename DualT>
+    inline void
+    extract_derivative(const Tensor<rank, dim, DualT> &dual,
+                       Tensor<rank, dim, T>           &derivative)
+    {
+      for (unsigned int i = 0; i < dim; ++i)
+        extract_derivative(dual[i], derivative[i]);
+    }
+  } // namespace internal
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename QuadratureOperation>
+  void
+  compute_jacobian_vector_product(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                          &dst,
+    const VectorType                                    &linearization_point,
+    const VectorType                                    &src,
+    const EvaluationFlags::EvaluationFlags               evaluation_flags,
+    const EvaluationFlags::EvaluationFlags               integration_flags,
+    const QuadratureOperation                           &residual,
+    const unsigned int                                   dof_handler_index,
+    const unsigned int                                   quadrature_index,
+    const unsigned int first_selected_component)
+  {
+    using FEEvalType = FEEvaluation<dim,
+                                    fe_degree,
+                                    n_q_points_1d,
+                                    n_components,
+                                    Number,
+                                    VectorizedArrayType>;
+    using ValueType    = typename FEEvalType::value_type;
+    using GradientType = typename FEEvalType::gradient_type;
+    using DualValueType = typename internal::DualNumberType<ValueType>::type;
+    using DualGradientType =
+      typename internal::DualNumberType<GradientType>::type;
+
+    Assert((evaluation_flags &
+            ~(EvaluationFlags::values | EvaluationFlags::gradients)) == 0,
+           ExcNotImplemented());
+    Assert((integration_flags &
+            ~(EvaluationFlags::values | EvaluationFlags::gradients)) == 0,
+           ExcNotImplemented());
+
+    matrix_free.template cell_loop<VectorType, VectorType>(
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          VectorType                                         &dst,
+          const VectorType                                   &src,
+          const std::pair<unsigned int, unsigned int>        &range) {
+        FEEvalType phi_linearization(matrix_free,
+                                     dof_handler_index,
+                                     quadrature_index,
+                                     first_selected_component);
+        FEEvalType phi(matrix_free,
+                       dof_handler_index,
+                       quadrature_index,
+                       first_selected_component);
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi_linearization.reinit(cell);
+            phi_linearization.read_dof_values_plain(linearization_point);
+            phi_linearization.evaluate(evaluation_flags);
+
+            phi.reinit(cell);
+            phi.read_dof_values(src);
+            phi.evaluate(evaluation_flags);
+
+            for (const unsigned int q : phi.quadrature_point_indices())
+              {
+                DualValueType    value;
+                DualGradientType gradient;
+                if (evaluation_flags & EvaluationFlags::values)
+                  value = internal::make_dual(phi_linearization.get_value(q),
+                                              phi.get_value(q));
+                if (evaluation_flags & EvaluationFlags::gradients)
+                  gradient =
+                    internal::make_dual(phi_linearization.get_gradient(q),
+                                        phi.get_gradient(q));
+
+                const std::pair<DualValueType, DualGradientType> flux =
+                  residual(phi_linearization, q, value, gradient);
+
+                if (integration_flags & EvaluationFlags::values)
+                  {
+                    ValueType derivative;
+                    internal::extract_derivative(flux.first, derivative);
+                    phi.submit_value(derivative, q);
+                  }
+                if (integration_flags & EvaluationFlags::gradients)
+                  {
+                    GradientType derivative;
+                    internal::extract_derivative(flux.second, derivative);
+                    phi.submit_gradient(derivative, q);
+                  }
+              }
+
+            phi.integrate(integration_flags);
+            phi.distribute_local_to_global(dst);
+          }
+      },
+      dst,
+      src,
+      true);
+  }
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
@@ -226,14 +226,18 @@ namespace internal
   // we can do vectorized load/save.
   // for VectorReader and VectorDistributorLocalToGlobal we assume that
   // if both begin() and local_element()
-  // exist, then begin() + offset == local_element(offset)
+  // exist, then begin() + offset == local_element(offset).
+  // vectors stored in float are also accepted for computations in double,
+  // in which case the entries are converted during the load/save
   template <typename T, typename Number>
   struct is_vectorizable
   {
     static const bool value =
       has_begin<T> &&
       (has_local_element<T> || is_serial_vector_or_array<T>::value) &&
-      std::is_same_v<typename T::value_type, Number>;
+      (std::is_same_v<typename T::value_type, Number> ||
+       (std::is_same_v<typename T::value_type, float> &&
+        std::is_same_v<Number, double>));
   };
 
   // We need to have a separate declaration for static const members
@@ -316,7 +316,7 @@ namespace internal
         }
       else
         {
-          const Number *vec_ptr = vec.begin() + dof_index;
+          const auto *vec_ptr = vec.begin() + dof_index;
           for (unsigned int i = 0; i < dofs_per_cell;
                ++i, vec_ptr += VectorizedArrayType::size())
             dof_values[i].load(vec_ptr);
@@ -431,8 +431,8 @@ namespace internal
 
 
 
-    // variant where VectorType::value_type is the same as Number -> can call
-    // gather
+    // variant where the vector can be accessed directly by its pointer ->
+    // can call gather in case VectorType::value_type is the same as Number
     template <typename VectorType>
     void
     process_dof_gather(const unsigned int              *indices,
@@ -457,10 +457,16 @@ namespace internal
                              res,
                              std::bool_constant<false>());
         }
-      else
+      else if constexpr (std::is_same_v<typename VectorType::value_type,
+                                        Number>)
         {
           res.gather(vec_ptr, indices);
         }
+      else
+        {
+          for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+            res[v] = vec_ptr[indices[v]];
+        }
     }
 
 
@@ -560,7 +566,7 @@ namespace internal
                             VectorizedArrayType *dof_values,
                             std::bool_constant<true>) const
     {
-      Number *vec_ptr = vec.begin() + dof_index;
+      auto *vec_ptr = vec.begin() + dof_index;
       for (unsigned int i = 0; i < dofs_per_cell;
            ++i, vec_ptr += VectorizedArrayType::size())
         {
@@ -683,8 +689,8 @@ namespace internal
 
 
 
-    // variant where VectorType::value_type is the same as Number -> can call
-    // scatter
+    // variant where the vector can be accessed directly by its pointer ->
+    // can call scatter in case VectorType::value_type is the same as Number
     template <typename VectorType>
     void
     process_dof_gather(const unsigned int              *indices,
@@ -702,11 +708,17 @@ namespace internal
       for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
         vector_access(vec, indices[v] + constant_offset) += res[v];
 #else
-      // only use gather in case there is also scatter.
-      VectorizedArrayType tmp;
-      tmp.gather(vec_ptr, indices);
-      tmp += res;
-      tmp.scatter(indices, vec_ptr);
+      if constexpr (std::is_same_v<typename VectorType::value_type, Number>)
+        {
+          // only use gather in case there is also scatter.
+          VectorizedArrayType tmp;
+          tmp.gather(vec_ptr, indices);
+          tmp += res;
+          tmp.scatter(indices, vec_ptr);
+        }
+      else
+        for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+          vector_access(vec, indices[v] + constant_offset) += res[v];
 #endif
     }
 
@@ -803,7 +815,7 @@ namespace internal
                             VectorizedArrayType *dof_values,
                             std::bool_constant<true>) const
     {
-      Number *vec_ptr = vec.begin() + dof_index;
+      auto *vec_ptr = vec.begin() + dof_index;
       for (unsigned int i = 0; i < dofs_per_cell;
            ++i, vec_ptr += VectorizedArrayType::size())
         dof_values[i].store(vec_ptr);
@@ -929,7 +941,11 @@ namespace internal
                        std::bool_constant<true>) const
     {
       Assert(vec_ptr == vec.begin() + constant_offset, ExcInternalError());
-      res.scatter(indices, vec_ptr);
+      if constexpr (std::is_same_v<typename VectorType::value_type, Number>)
+        res.scatter(indices, vec_ptr);
+      else
+        for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+          vec_ptr[indices[v]] = res[v];
     }
 
 
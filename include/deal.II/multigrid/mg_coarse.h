@@ -274,7 +274,7 @@ public:
   void
   operator()(const unsigned int level,
              VectorType        &dst,
-             const VectorType  &src) const;
+             const VectorType  &src) const override;
 
   /**
    * Write the singular values to @p deallog.
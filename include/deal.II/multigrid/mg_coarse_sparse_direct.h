@@ -0,0 +1,287 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_coarse_sparse_direct_h
+#define dealii_mg_coarse_sparse_direct_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_direct.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * Coarse grid solver by a sparse direct factorization for multigrid methods
+ * working on vectors of type LinearAlgebra::distributed::Vector, such as the
+ * matrix-free hierarchies set up with MGTransferGlobalCoarsening.
+ *
+ * Upon initialization, the entries of the coarse matrix stored on the
+ * individual processes are gathered on the first process of the
+ * communicator, assembled into a SparseMatrix, and factorized by
+ * SparseDirectUMFPACK. The factorization is kept for all subsequent calls to
+ * operator(), which then only gather the right hand side on that process,
+ * run the forward and backward substitution, and send the solution back.
+ * Compared to MGCoarseGridIterativeSolver, the coarse solve thus does not
+ * depend on the condition number of the coarse matrix, and compared to
+ * MGCoarseGridHouseholder and MGCoarseGridSVD, the cost in memory and
+ * compute grows with the fill-in of the sparse factorization rather than
+ * with the square of the size of the coarse problem. This is beneficial for
+ * coarse problems with up to some hundred thousand unknowns, which are
+ * typical for hierarchies of p- or h-coarsening that end at the coarse mesh.
+ *
+ * Alternatively, the flag AdditionalData::redundant_solve makes every
+ * process hold a copy of the factorization. Each coarse solve then consists
+ * of a single all-gather operation of the right hand side, followed by the
+ * same substitution on every process. This avoids the round trip to a single
+ * process at the expense of memory and of the factorization on all
+ * processes.
+ *
+ * The coarse matrix is typically computed once with
+ * MatrixFreeTools::compute_matrix() from the matrix-free operator on the
+ * coarse level:
+ * @code
+ * TrilinosWrappers::SparseMatrix coarse_matrix;
+ * // ... set up the sparsity pattern
+ * MatrixFreeTools::compute_matrix(matrix_free,
+ *                                 constraints,
+ *                                 coarse_matrix,
+ *                                 &Operator::do_cell_integral_local,
+ *                                 &coarse_operator);
+ *
+ * MGCoarseGridSparseDirect<double> mg_coarse;
+ * mg_coarse.initialize(coarse_matrix, matrix_free.get_vector_partitioner());
+ * @endcode
+ * The matrix can be deleted after the call to initialize(). Since the
+ * entries are gathered row by row, any matrix class that gives access to
+ * the entries of a row via <tt>begin(row)</tt> and <tt>end(row)</tt> can be
+ * passed, including a SparseMatrix on each process that only contains the
+ * contributions of the locally owned cells, see the second initialize()
+ * function.
+ *
+ * The factorization is computed in double precision irrespective of the
+ * template argument @p Number, such that the class can be used within a
+ * multigrid preconditioner working in single precision.
+ */
+template <typename Number>
+class MGCoarseGridSparseDirect
+  : public MGCoarseGridBase<LinearAlgebra::distributed::Vector<Number>>
+{
+public:
+  /**
+   * The vector type this class works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Standardized data struct to pipe additional flags to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const bool redundant_solve = false);
+
+    /**
+     * If false, the matrix is factorized on the first process of the
+     * communicator only. If true, every process factorizes the complete
+     * matrix and computes the coarse solve redundantly.
+     */
+    bool redundant_solve;
+  };
+
+  /**
+   * Constructor leaving an uninitialized object.
+   */
+  MGCoarseGridSparseDirect() = default;
+
+  /**
+   * Gather the locally owned rows of @p matrix, as given by the locally
+   * owned range of @p partitioner, and factorize the resulting matrix.
+   * The @p partitioner describes the layout of the vectors passed to
+   * operator().
+   */
+  template <typename MatrixType>
+  void
+  initialize(
+    const MatrixType                                         &matrix,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+    const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Same as above, but gather the rows @p stored_rows of @p matrix. Entries
+   * of a row sent by several processes are added. This allows to pass a
+   * matrix of the global size on each process that only contains the
+   * contributions of the locally owned cells, as computed by
+   * MatrixFreeTools::compute_matrix() into a SparseMatrix, together with the
+   * locally active degrees of freedom.
+   */
+  template <typename MatrixType>
+  void
+  initialize(
+    const MatrixType                                         &matrix,
+    const IndexSet                                           &stored_rows,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+    const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release the factorization and the communication pattern.
+   */
+  void
+  clear();
+
+  /**
+   * Solve with the factorized coarse matrix.
+   */
+  virtual void
+  operator()(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src) const override;
+
+  /**
+   * Return the number of rows of the coarse matrix.
+   */
+  types::global_dof_index
+  m() const;
+
+private:
+  /**
+   * Gather the entries given in coordinate format on the process(es) that
+   * compute the solution and factorize the matrix.
+   */
+  void
+  initialize_from_entries(
+    const std::vector<types::global_dof_index>               &rows,
+    const std::vector<types::global_dof_index>               &columns,
+    const std::vector<double>                                &values,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+    const AdditionalData                                     &additional_data);
+
+  /**
+   * The partitioner of the vectors passed to operator().
+   */
+  std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
+
+  /**
+   * Flag whether every process computes the solution.
+   */
+  bool redundant_solve = false;
+
+  /**
+   * Number of locally owned vector entries on each process, set on the
+   * process(es) that compute the solution.
+   */
+  std::vector<int> vector_counts;
+
+  /**
+   * Offsets of the vector entries of each process into the gathered
+   * vector, set on the process(es) that compute the solution.
+   */
+  std::vector<int> vector_displacements;
+
+  /**
+   * Global indices of the entries in the gathered vector, set on the
+   * process(es) that compute the solution.
+   */
+  std::vector<types::global_dof_index> gathered_indices;
+
+  /**
+   * The sparse direct solver holding the factorization, set on the
+   * process(es) that compute the solution.
+   */
+  std::unique_ptr<SparseDirectUMFPACK> solver;
+
+  /**
+   * Buffer for the gathered vector entries.
+   */
+  mutable std::vector<Number> gathered_values;
+
+  /**
+   * Right hand side and solution of the sparse direct solver.
+   */
+  mutable Vector<double> rhs_and_solution;
+};
+
+/** @} */
+
+
+#ifndef DOXYGEN
+
+template <typename Number>
+inline MGCoarseGridSparseDirect<Number>::AdditionalData::AdditionalData(
+  const bool redundant_solve)
+  : redundant_solve(redundant_solve)
+{}
+
+
+
+template <typename Number>
+template <typename MatrixType>
+inline void
+MGCoarseGridSparseDirect<Number>::initialize(
+  const MatrixType                                         &matrix,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+  const AdditionalData                                     &additional_data)
+{
+  initialize(matrix,
+             partitioner->locally_owned_range(),
+             partitioner,
+             additional_data);
+}
+
+
+
+template <typename Number>
+template <typename MatrixType>
+inline void
+MGCoarseGridSparseDirect<Number>::initialize(
+  const MatrixType                                         &matrix,
+  const IndexSet                                           &stored_rows,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+  const AdditionalData                                     &additional_data)
+{
+  std::vector<types::global_dof_index> rows, columns;
+  std::vector<double>                  values;
+  for (const types::global_dof_index row : stored_rows)
+    for (auto entry = matrix.begin(row); entry != matrix.end(row); ++entry)
+      {
+        rows.push_back(row);
+        columns.push_back(entry->column());
+        values.push_back(entry->value());
+      }
+
+  initialize_from_entries(rows, columns, values, partitioner, additional_data);
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
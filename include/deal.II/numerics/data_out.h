@@ -273,6 +273,14 @@ public:
    *   is worth noting, however, that this requires a
    *   sufficiently new version of one of the VTK-based visualization
    *   programs.
+   *
+   * @note Data vectors that are attached without a DataPostprocessor, are
+   *   real-valued, and live on a DoFHandler with a single tensor-product
+   *   element such as FE_Q, FE_DGQ, or an FESystem of several copies of one
+   *   of them, are not evaluated through FEValues but with the
+   *   sum-factorization kernels of the matrix-free framework, vectorized
+   *   over several cells. This makes the output of high polynomial degrees
+   *   with many subdivisions much cheaper.
    */
   virtual void
   build_patches(const unsigned int n_subdivisions = 0);
@@ -441,13 +449,18 @@ private:
    * WorkStream::run(). The function does not take a CopyData object but
    * rather allocates one on its own stack for memory access efficiency
    * reasons.
+   *
+   * The values of the data sets flagged in the last argument are not
+   * computed by this function, but left for build_patches() to fill in with
+   * sum factorization.
    */
   void
   build_one_patch(
     const std::pair<cell_iterator, unsigned int> *cell_and_index,
     internal::DataOutImplementation::ParallelData<dim, spacedim> &scratch_data,
-    const unsigned int     n_subdivisions,
-    const CurvedCellRegion curved_cell_region);
+    const unsigned int       n_subdivisions,
+    const CurvedCellRegion   curved_cell_region,
+    const std::vector<bool> &evaluated_by_sum_factorization);
 };
 
 
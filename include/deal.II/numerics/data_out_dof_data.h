@@ -319,6 +319,21 @@ namespace internal
                             std::vector<std::vector<Tensor<2, spacedim>>>
                               &patch_hessians_system) const = 0;
 
+      /**
+       * Extract the values of the degrees of freedom of the given cell of
+       * dof_handler from the vector we actually store, in the order of the
+       * local degrees of freedom of the cell. The size of @p dof_values
+       * determines the number of values extracted and must equal the number
+       * of degrees of freedom per cell. This function is used by DataOut to
+       * evaluate the data set with sum factorization instead of an FEValues
+       * object.
+       */
+      virtual void
+      get_dof_values(
+        const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+        const ComponentExtractor extract_component,
+        std::vector<double>     &dof_values) const = 0;
+
       /**
        * Return whether the data represented by (a derived class of) this object
        * represents a complex-valued (as opposed to real-valued) information.
@@ -1123,6 +1123,16 @@ namespace internal
                             std::vector<std::vector<Tensor<2, spacedim>>>
                               &patch_hessians_system) const override;
 
+      /**
+       * Extract the values of the degrees of freedom of the given cell from
+       * the vector we actually store.
+       */
+      virtual void
+      get_dof_values(
+        const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+        const ComponentExtractor extract_component,
+        std::vector<double>     &dof_values) const override;
+
       /**
        * Return whether the data represented by (a derived class of) this object
        * represents a complex-valued (as opposed to real-valued) information.
@@ -1440,6 +1450,23 @@ namespace internal
 
 
 
+    template <int dim, int spacedim, typename ScalarType>
+    void
+    DataEntry<dim, spacedim, ScalarType>::get_dof_values(
+      const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+      const ComponentExtractor extract_component,
+      std::vector<double>     &dof_values) const
+    {
+      // go through the same function FEValues uses, so that we also get the
+      // interpolated values on cells that are not active
+      Vector<ScalarType> values(dof_values.size());
+      cell->get_interpolated_dof_values(vector, values);
+      for (unsigned int i = 0; i < dof_values.size(); ++i)
+        dof_values[i] = get_component(values[i], extract_component);
+    }
+
+
+
     template <int dim, int spacedim, typename ScalarType>
     bool
     DataEntry<dim, spacedim, ScalarType>::is_complex_valued() const
@@ -1580,6 +1607,16 @@ namespace internal
         DEAL_II_NOT_IMPLEMENTED();
       }
 
+      /**
+       * Extract the values of the level degrees of freedom of the given cell
+       * from the vector on the level of the cell.
+       */
+      virtual void
+      get_dof_values(
+        const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+        const ComponentExtractor extract_component,
+        std::vector<double>     &dof_values) const override;
+
       /**
        * Return whether the data represented by (a derived class of) this object
        * represents a complex-valued (as opposed to real-valued) information.
@@ -1631,6 +1668,29 @@ namespace internal
 
 
 
+    template <int dim, int spacedim, typename ScalarType>
+    void
+    MGDataEntry<dim, spacedim, ScalarType>::get_dof_values(
+      const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+      const ComponentExtractor extract_component,
+      std::vector<double>     &dof_values) const
+    {
+      const typename DoFHandler<dim, spacedim>::level_cell_iterator dof_cell(
+        &cell->get_triangulation(),
+        cell->level(),
+        cell->index(),
+        this->dof_handler);
+
+      std::vector<types::global_dof_index> dof_indices(dof_values.size());
+      dof_cell->get_mg_dof_indices(dof_indices);
+      extract(vectors[dof_cell->level()],
+              dof_indices,
+              extract_component,
+              dof_values);
+    }
+
+
+
     template <int dim, int spacedim, typename ScalarType>
     double
     MGDataEntry<dim, spacedim, ScalarType>::get_cell_data_value(
@@ -0,0 +1,267 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/data_out_async_writer.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
+#include <fstream>
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace DataOutAsyncWriterImplementation
+  {
+    /**
+     * A copy of the output of a DataOutInterface object, i.e., its patches,
+     * the names and ranges of its data sets, and its output flags, which
+     * the background tasks of DataOutAsyncWriter write.
+     */
+    template <int dim, int spacedim>
+    class Snapshot : public DataOutInterface<dim, spacedim>
+    {
+    public:
+      Snapshot(
+        const DataOutInterface<dim, spacedim>                 &data_out,
+        const std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
+        const std::vector<std::string>                        &dataset_names,
+        const std::vector<
+          std::tuple<unsigned int,
+                     unsigned int,
+                     std::string,
+                     DataComponentInterpretation::DataComponentInterpretation>>
+          &nonscalar_data_ranges)
+        : DataOutInterface<dim, spacedim>(data_out)
+        , patches(patches)
+        , dataset_names(dataset_names)
+        , nonscalar_data_ranges(nonscalar_data_ranges)
+      {}
+
+    protected:
+      virtual const std::vector<DataOutBase::Patch<dim, spacedim>> &
+      get_patches() const override
+      {
+        return patches;
+      }
+
+      virtual std::vector<std::string>
+      get_dataset_names() const override
+      {
+        return dataset_names;
+      }
+
+      virtual std::vector<
+        std::tuple<unsigned int,
+                   unsigned int,
+                   std::string,
+                   DataComponentInterpretation::DataComponentInterpretation>>
+      get_nonscalar_data_ranges() const override
+      {
+        return nonscalar_data_ranges;
+      }
+
+    private:
+      const std::vector<DataOutBase::Patch<dim, spacedim>> patches;
+      const std::vector<std::string>                        dataset_names;
+      const std::vector<
+        std::tuple<unsigned int,
+                   unsigned int,
+                   std::string,
+                   DataComponentInterpretation::DataComponentInterpretation>>
+        nonscalar_data_ranges;
+    };
+  } // namespace DataOutAsyncWriterImplementation
+} // namespace internal
+
+
+
+template <int dim, int spacedim>
+DataOutAsyncWriter<dim, spacedim>::DataOutAsyncWriter(
+  const unsigned int max_outputs_in_flight)
+  : max_outputs_in_flight(max_outputs_in_flight)
+{
+  Assert(max_outputs_in_flight > 0,
+         ExcMessage("At least one output needs to be allowed in flight."));
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOutAsyncWriter<dim, spacedim>::write_vtu(
+  const DataOutInterface<dim, spacedim> &data_out,
+  const std::string                     &filename)
+{
+  const auto snapshot = std::make_shared<
+    const internal::DataOutAsyncWriterImplementation::Snapshot<dim, spacedim>>(
+    data_out,
+    data_out.get_patches(),
+    data_out.get_dataset_names(),
+    data_out.get_nonscalar_data_ranges());
+
+  enqueue([snapshot, filename]() {
+    std::ofstream output(filename);
+    AssertThrow(output, ExcFileNotOpen(filename));
+    snapshot->write_vtu(output);
+  });
+}
+
+
+
+template <int dim, int spacedim>
+std::string
+DataOutAsyncWriter<dim, spacedim>::write_vtu_with_pvtu_record(
+  const DataOutInterface<dim, spacedim> &data_out,
+  const std::string                     &directory,
+  const std::string                     &filename_without_extension,
+  const unsigned int                     counter,
+  const MPI_Comm                         mpi_communicator,
+  const unsigned int                     n_digits_for_counter,
+  const unsigned int                     n_groups)
+{
+  const unsigned int rank = Utilities::MPI::this_mpi_process(mpi_communicator);
+  const unsigned int n_ranks =
+    Utilities::MPI::n_mpi_processes(mpi_communicator);
+  const bool one_file_per_process = (n_groups == 0 || n_groups > n_ranks);
+
+  // Writing with MPI I/O requires communication on the background task,
+  // concurrently with whatever communication the calling thread does
+  // next. If MPI does not support that, write right away.
+  if (!one_file_per_process)
+    {
+#ifdef DEAL_II_WITH_MPI
+      int thread_support;
+      int ierr = MPI_Query_thread(&thread_support);
+      AssertThrowMPI(ierr);
+      if (thread_support != MPI_THREAD_MULTIPLE)
+#endif
+        {
+          wait();
+          return data_out.write_vtu_with_pvtu_record(directory,
+                                                     filename_without_extension,
+                                                     counter,
+                                                     mpi_communicator,
+                                                     n_digits_for_counter,
+                                                     n_groups);
+        }
+    }
+
+  const auto snapshot = std::make_shared<
+    const internal::DataOutAsyncWriterImplementation::Snapshot<dim, spacedim>>(
+    data_out,
+    data_out.get_patches(),
+    data_out.get_dataset_names(),
+    data_out.get_nonscalar_data_ranges());
+
+  const std::string pvtu_filename =
+    filename_without_extension + "_" +
+    Utilities::int_to_string(counter, n_digits_for_counter) + ".pvtu";
+
+  if (one_file_per_process)
+    {
+      // Do everything that involves the communicator here, so that the
+      // background task only writes files. The file names follow the same
+      // scheme as DataOutInterface::write_vtu_with_pvtu_record().
+      const unsigned int n_digits =
+        Utilities::needed_digits(std::max(0, int(n_ranks) - 1));
+      const auto piece_name = [&](const unsigned int i) {
+        return filename_without_extension + "_" +
+               Utilities::int_to_string(counter, n_digits_for_counter) + "." +
+               Utilities::int_to_string(i, n_digits) + ".vtu";
+      };
+
+      const std::string        filename = directory + piece_name(rank);
+      std::vector<std::string> piece_names;
+      if (rank == 0)
+        for (unsigned int i = 0; i < n_ranks; ++i)
+          piece_names.emplace_back(piece_name(i));
+
+      enqueue([snapshot, filename, directory, pvtu_filename, piece_names]() {
+        std::ofstream output(filename);
+        AssertThrow(output, ExcFileNotOpen(filename));
+        snapshot->write_vtu(output);
+
+        // only the first process has the names of the pieces
+        if (!piece_names.empty())
+          {
+            std::ofstream pvtu_output(directory + pvtu_filename);
+            AssertThrow(pvtu_output, ExcFileNotOpen(directory + pvtu_filename));
+            snapshot->write_pvtu_record(pvtu_output, piece_names);
+          }
+      });
+    }
+  else
+    {
+      const MPI_Comm communicator =
+        Utilities::MPI::duplicate_communicator(mpi_communicator);
+      enqueue([snapshot,
+               directory,
+               filename_without_extension,
+               counter,
+               communicator,
+               n_digits_for_counter,
+               n_groups]() {
+        snapshot->write_vtu_with_pvtu_record(directory,
+                                             filename_without_extension,
+                                             counter,
+                                             communicator,
+                                             n_digits_for_counter,
+                                             n_groups);
+        Utilities::MPI::free_communicator(communicator);
+      });
+    }
+
+  return pvtu_filename;
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOutAsyncWriter<dim, spacedim>::wait()
+{
+  while (!outputs_in_flight.empty())
+    {
+      // remove the task from the list before joining it, so that an
+      // exception thrown by the task is only reported once
+      const Threads::Task<> task = outputs_in_flight.front();
+      outputs_in_flight.pop_front();
+      task.join();
+    }
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOutAsyncWriter<dim, spacedim>::enqueue(const std::function<void()> &write)
+{
+  while (outputs_in_flight.size() >= max_outputs_in_flight)
+    {
+      const Threads::Task<> task = outputs_in_flight.front();
+      outputs_in_flight.pop_front();
+      task.join();
+    }
+
+  outputs_in_flight.emplace_back(Threads::new_task(write));
+}
+
+
+// explicit instantiations
+#include "base/data_out_async_writer.inst"
+
+DEAL_II_NAMESPACE_CLOSE
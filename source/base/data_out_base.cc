@@ -36,6 +36,7 @@
 #include <numeric>
 #include <set>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
 #ifdef DEAL_II_WITH_ZLIB
@@ -197,25 +198,136 @@ namespace
 
 
 
+  /**
+   * The size of the blocks, in bytes of uncompressed data, into which the
+   * data arrays are split for compression in the appended raw encoding of
+   * VTU files. Each block is compressed independently, so only one block of
+   * compressed data needs to be held in addition to the uncompressed array
+   * at any time during compression.
+   */
+  constexpr std::uint64_t vtu_appended_block_size = std::uint64_t(1) << 20;
+
+
+
+  /**
+   * Convert an array of data objects into the binary representation of the
+   * array in the appended raw encoding of VTU files, with 64-bit integers in
+   * the headers. If libz was found during configuration and compression is
+   * requested, the data is compressed in blocks of size
+   * vtu_appended_block_size, and the result starts with the usual VTK
+   * compression header that lists the number of blocks, the uncompressed
+   * size of the blocks and of the last block, and the compressed size of each
+   * block. Otherwise, the result consists of the number of bytes followed by
+   * the raw data.
+   *
+   * Since the offsets of the arrays in the appended data section need to be
+   * known when writing the XML part of the file, the returned string is
+   * preceded by a '\0' character and the size of the binary data, which
+   * allows split_vtu_appended_piece() to find the binary data within the
+   * output of write_vtu_main() again.
+   */
+  template <typename T>
+  std::string
+  vtu_appended_array(const std::vector<T>               &data,
+                     const DataOutBase::CompressionLevel compression_level)
+  {
+    const std::uint64_t uncompressed_size = data.size() * sizeof(T);
+    const auto *const   uncompressed_data =
+      reinterpret_cast<const unsigned char *>(data.data());
+
+    std::string result;
+#  ifdef DEAL_II_WITH_ZLIB
+    if (compression_level != DataOutBase::CompressionLevel::plain_text)
+      {
+        const std::uint64_t n_blocks =
+          (uncompressed_size + vtu_appended_block_size - 1) /
+          vtu_appended_block_size;
+        const std::uint64_t last_block_size =
+          uncompressed_size - (n_blocks > 0 ? n_blocks - 1 : 0) *
+                                vtu_appended_block_size;
+
+        // the header with the compressed sizes is only complete once all
+        // blocks have been compressed, so reserve space for it and fill it
+        // at the end
+        std::vector<std::uint64_t> compression_header(3 + n_blocks);
+        compression_header[0] = n_blocks;
+        compression_header[1] = vtu_appended_block_size;
+        compression_header[2] = last_block_size;
+        const std::size_t header_size =
+          compression_header.size() * sizeof(std::uint64_t);
+        result.resize(1 + sizeof(std::uint64_t) + header_size);
+
+        std::vector<unsigned char> compressed_block(
+          compressBound(std::min(uncompressed_size, vtu_appended_block_size)));
+        for (std::uint64_t block = 0; block < n_blocks; ++block)
+          {
+            const std::uint64_t block_size =
+              (block + 1 < n_blocks ? vtu_appended_block_size :
+                                      last_block_size);
+            uLongf    compressed_block_size = compressed_block.size();
+            const int err =
+              compress2(compressed_block.data(),
+                        &compressed_block_size,
+                        uncompressed_data + block * vtu_appended_block_size,
+                        block_size,
+                        get_zlib_compression_level(compression_level));
+            (void)err;
+            Assert(err == Z_OK, ExcInternalError());
+
+            compression_header[3 + block] = compressed_block_size;
+            result.append(reinterpret_cast<const char *>(
+                            compressed_block.data()),
+                          compressed_block_size);
+          }
+
+        std::memcpy(&result[1 + sizeof(std::uint64_t)],
+                    compression_header.data(),
+                    header_size);
+      }
+    else
+#  endif
+      {
+        result.resize(1 + 2 * sizeof(std::uint64_t));
+        std::memcpy(&result[1 + sizeof(std::uint64_t)],
+                    &uncompressed_size,
+                    sizeof(std::uint64_t));
+        result.append(reinterpret_cast<const char *>(uncompressed_data),
+                      uncompressed_size);
+      }
+    (void)compression_level;
+
+    result[0] = '\0';
+    const std::uint64_t binary_size = result.size() - 1 - sizeof(std::uint64_t);
+    std::memcpy(&result[1], &binary_size, sizeof(std::uint64_t));
+    return result;
+  }
+
+
+
   /**
    * Convert an array of data objects into a string that will form part of
    * what we then output as data into VTU objects.
    *
-   * If libz was found during configuration, this function compresses and
-   * encodes the entire data block. Otherwise, it simply writes it element by
-   * element.
+   * If the appended raw encoding is requested by the flags, this function
+   * returns the binary representation created by vtu_appended_array().
+   * Otherwise, if libz was found during configuration, this function
+   * compresses and encodes the entire data block. Otherwise, it simply writes
+   * it element by element.
    */
   template <typename T>
   std::string
-  vtu_stringize_array(const std::vector<T>               &data,
-                      const DataOutBase::CompressionLevel compression_level,
-                      const int                           precision)
+  vtu_stringize_array(const std::vector<T>        &data,
+                      const DataOutBase::VtkFlags &flags,
+                      const int                    precision)
   {
-    if (deal_ii_with_zlib &&
-        (compression_level != DataOutBase::CompressionLevel::plain_text))
+    if (flags.write_appended_raw_data)
+      return vtu_appended_array(data, flags.compression_level);
+    else if (deal_ii_with_zlib &&
+             (flags.compression_level !=
+              DataOutBase::CompressionLevel::plain_text))
       {
         // compress the data we have in memory
-        return compress_array(data, compression_level);
+        return compress_array(data, flags.compression_level);
       }
     else
       {
@@ -228,6 +340,132 @@ namespace
   }
 
 
+  /**
+   * Return whether the data arrays of a VTU file are written as binary data,
+   * i.e., either compressed and base64 encoded within the XML elements, or
+   * in the appended raw encoding, rather than as text.
+   */
+  bool
+  vtu_writes_binary_data(const DataOutBase::VtkFlags &flags)
+  {
+    return flags.write_appended_raw_data ||
+           (deal_ii_with_zlib && (flags.compression_level !=
+                                  DataOutBase::CompressionLevel::plain_text));
+  }
+
+
+
+  /**
+   * The output of write_vtu_main() in the appended raw encoding, split into
+   * the XML text and the binary data arrays marked by vtu_appended_array().
+   * Both refer to the memory of the string the object was created from.
+   */
+  struct VtuAppendedPiece
+  {
+    /**
+     * The pieces of XML text before each of the data arrays, and the text
+     * after the last one.
+     */
+    std::vector<std::string_view> text;
+
+    /**
+     * The binary data arrays in the order in which they appear in the
+     * appended data section of the file.
+     */
+    std::vector<std::string_view> arrays;
+
+    /**
+     * Return the combined size of all data arrays.
+     */
+    std::uint64_t
+    data_size() const
+    {
+      std::uint64_t size = 0;
+      for (const auto &array : arrays)
+        size += array.size();
+      return size;
+    }
+
+    /**
+     * Return the XML text with the offset attribute added to each DataArray
+     * element, where @p first_offset is the offset of the first array of
+     * this piece within the appended data section of the file.
+     */
+    std::string
+    get_xml(const std::uint64_t first_offset) const
+    {
+      std::string   xml;
+      std::uint64_t offset = first_offset;
+      for (unsigned int i = 0; i < text.size(); ++i)
+        if (i < arrays.size())
+          {
+            // the text before an array ends with the opening tag of its
+            // DataArray element, followed by a newline
+            const std::size_t end_of_tag = text[i].rfind('>');
+            Assert(end_of_tag != std::string_view::npos, ExcInternalError());
+            xml += text[i].substr(0, end_of_tag);
+            xml += " offset=\"" + std::to_string(offset) + "\"";
+            xml += text[i].substr(end_of_tag);
+            offset += arrays[i].size();
+          }
+        else
+          xml += text[i];
+      return xml;
+    }
+  };
+
+
+
+  /**
+   * The text that closes the XML part of a VTU file in the appended raw
+   * encoding and opens the appended data section. The underscore marks the
+   * start of the binary data, relative to which the offsets of the data
+   * arrays are counted.
+   */
+  constexpr std::string_view vtu_appended_data_start =
+    " </UnstructuredGrid>\n<AppendedData encoding=\"raw\">\n_";
+
+
+
+  /**
+   * The text that closes the appended data section and the VTU file.
+   */
+  constexpr std::string_view vtu_appended_data_end =
+    "\n</AppendedData>\n</VTKFile>\n";
+
+
+
+  /**
+   * Split the output of write_vtu_main() in the appended raw encoding into
+   * the XML text and the binary data arrays.
+   */
+  VtuAppendedPiece
+  split_vtu_appended_piece(const std::string &piece)
+  {
+    VtuAppendedPiece result;
+    std::size_t      position = 0;
+    while (true)
+      {
+        const std::size_t marker = piece.find('\0', position);
+        result.text.emplace_back(piece.data() + position,
+                                 (marker == std::string::npos ?
+                                    piece.size() :
+                                    marker) -
+                                   position);
+        if (marker == std::string::npos)
+          break;
+
+        std::uint64_t size;
+        std::memcpy(&size, piece.data() + marker + 1, sizeof(std::uint64_t));
+        position = marker + 1 + sizeof(std::uint64_t);
+        result.arrays.emplace_back(piece.data() + position, size);
+        position += size;
+      }
+    return result;
+  }
+
+
+
   /**
    * The header in binary format that the parallel intermediate files
    * start with.
@@ -2432,13 +2670,15 @@ namespace DataOutBase
                      const bool             print_date_and_time,
                      const CompressionLevel compression_level,
                      const bool             write_higher_order_cells,
-                     const std::map<std::string, std::string> &physical_units)
+                     const std::map<std::string, std::string> &physical_units,
+                     const bool write_appended_raw_data)
     : time(time)
     , cycle(cycle)
     , print_date_and_time(print_date_and_time)
     , compression_level(compression_level)
     , write_higher_order_cells(write_higher_order_cells)
     , physical_units(physical_units)
+    , write_appended_raw_data(write_appended_raw_data)
   {}
 
 
@@ -5202,11 +5442,17 @@ namespace DataOutBase
 
     if (flags.write_higher_order_cells)
       out << "<VTKFile type=\"UnstructuredGrid\" version=\"2.2\"";
+    else if (flags.write_appended_raw_data)
+      out << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\"";
     else
       out << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\"";
     if (deal_ii_with_zlib &&
         (flags.compression_level != CompressionLevel::plain_text))
       out << " compressor=\"vtkZLibDataCompressor\"";
+    // the appended raw encoding uses 64-bit integers for the size of the
+    // arrays and the compression headers
+    if (flags.write_appended_raw_data)
+      out << " header_type=\"UInt64\"";
 #ifdef DEAL_II_WORDS_BIGENDIAN
     out << " byte_order=\"BigEndian\"";
 #else
@@ -5245,8 +5491,27 @@ namespace DataOutBase
     std::ostream   &out)
   {
     write_vtu_header(out, flags);
-    write_vtu_main(patches, data_names, nonscalar_data_ranges, flags, out);
-    write_vtu_footer(out);
+    if (flags.write_appended_raw_data)
+      {
+        // the offsets of the data arrays need to be written into the XML
+        // text that precedes the data, so collect the piece first and then
+        // write its XML text and binary data separately
+        std::ostringstream piece_stream;
+        write_vtu_main(
+          patches, data_names, nonscalar_data_ranges, flags, piece_stream);
+        const std::string      piece       = piece_stream.str();
+        const VtuAppendedPiece split_piece = split_vtu_appended_piece(piece);
+
+        out << split_piece.get_xml(0) << vtu_appended_data_start;
+        for (const auto &array : split_piece.arrays)
+          out.write(array.data(), array.size());
+        out << vtu_appended_data_end;
+      }
+    else
+      {
+        write_vtu_main(patches, data_names, nonscalar_data_ranges, flags, out);
+        write_vtu_footer(out);
+      }
 
     out << std::flush;
   }
@@ -5388,10 +5653,9 @@ namespace DataOutBase
       }
 
     const char *ascii_or_binary =
-      (deal_ii_with_zlib &&
-       (flags.compression_level != CompressionLevel::plain_text)) ?
-        "binary" :
-        "ascii";
+      flags.write_appended_raw_data ?
+        "appended" :
+        (vtu_writes_binary_data(flags) ? "binary" : "ascii");
 
 
     // first count the number of cells and cells for later use
@@ -5429,9 +5693,7 @@ namespace DataOutBase
             else
               node_coordinates_3d.emplace_back(0.0f);
         }
-      o << vtu_stringize_array(node_coordinates_3d,
-                               flags.compression_level,
-                               output_precision)
+      o << vtu_stringize_array(node_coordinates_3d, flags, output_precision)
         << '\n';
       o << "    </DataArray>\n";
       o << "  </Points>\n\n";
@@ -5476,9 +5738,7 @@ namespace DataOutBase
                        (dim == 3 && n_points == 10),
                      ExcInternalError());
 
-              if (deal_ii_with_zlib &&
-                  (flags.compression_level !=
-                   DataOutBase::CompressionLevel::plain_text))
+              if (vtu_writes_binary_data(flags))
                 {
                   for (unsigned int i = 0; i < n_points; ++i)
                     cells.push_back(first_vertex_of_patch + i);
@@ -5501,9 +5761,7 @@ namespace DataOutBase
 
               const unsigned int n_points = patch.data.n_cols();
 
-              if (deal_ii_with_zlib &&
-                  (flags.compression_level !=
-                   DataOutBase::CompressionLevel::plain_text))
+              if (vtu_writes_binary_data(flags))
                 {
                   for (unsigned int i = 0; i < n_points; ++i)
                     cells.push_back(
@@ -5535,9 +5793,7 @@ namespace DataOutBase
                                                &cells,
                                                first_vertex_of_patch,
                                                &local_vertex_order]() {
-                if (deal_ii_with_zlib &&
-                    (flags.compression_level !=
-                     DataOutBase::CompressionLevel::plain_text))
+                if (vtu_writes_binary_data(flags))
                   {
                     for (const auto &c : local_vertex_order)
                       cells.push_back(first_vertex_of_patch + c);
@@ -5742,13 +5998,9 @@ namespace DataOutBase
         }
 
       // Flush the 'cells' object we created herein.
-      if (deal_ii_with_zlib && (flags.compression_level !=
-                                DataOutBase::CompressionLevel::plain_text))
+      if (vtu_writes_binary_data(flags))
         {
-          o << vtu_stringize_array(cells,
-                                   flags.compression_level,
-                                   output_precision)
-            << '\n';
+          o << vtu_stringize_array(cells, flags, output_precision) << '\n';
         }
       o << "    </DataArray>\n";
 
@@ -5804,31 +6056,26 @@ namespace DataOutBase
               }
           }
 
-        o << vtu_stringize_array(offsets,
-                                 flags.compression_level,
-                                 output_precision);
+        o << vtu_stringize_array(offsets, flags, output_precision);
         o << '\n';
         o << "    </DataArray>\n";
 
         o << "    <DataArray type=\"UInt8\" Name=\"types\" format=\""
           << ascii_or_binary << "\">\n";
 
-        if (deal_ii_with_zlib &&
-            (flags.compression_level != CompressionLevel::plain_text))
+        if (vtu_writes_binary_data(flags))
           {
             std::vector<std::uint8_t> cell_types_uint8_t(cell_types.size());
             for (unsigned int i = 0; i < cell_types.size(); ++i)
               cell_types_uint8_t[i] = static_cast<std::uint8_t>(cell_types[i]);
 
             o << vtu_stringize_array(cell_types_uint8_t,
-                                     flags.compression_level,
+                                     flags,
                                      output_precision);
           }
         else
           {
-            o << vtu_stringize_array(cell_types,
-                                     flags.compression_level,
-                                     output_precision);
+            o << vtu_stringize_array(cell_types, flags, output_precision);
           }
 
         o << '\n';
@@ -5990,9 +6237,7 @@ namespace DataOutBase
               }
           } // loop over nodes
 
-        o << vtu_stringize_array(data,
-                                 flags.compression_level,
-                                 output_precision);
+        o << vtu_stringize_array(data, flags, output_precision);
         o << '\n';
         o << "    </DataArray>\n";
 
@@ -6019,9 +6264,7 @@ namespace DataOutBase
 
         const std::vector<float> data(data_vectors[data_set].begin(),
                                       data_vectors[data_set].end());
-        o << vtu_stringize_array(data,
-                                 flags.compression_level,
-                                 output_precision);
+        o << vtu_stringize_array(data, flags, output_precision);
         o << '\n';
         o << "    </DataArray>\n";
 
@@ -7793,45 +8036,119 @@ DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
                                   vtk_flags,
                                   ss);
 
-    // Use prefix sum to find specific offset to write at.
-    const std::uint64_t size_on_proc = ss.str().size();
-    std::uint64_t       prefix_sum   = 0;
-    ierr                             = MPI_Exscan(&size_on_proc,
-                      &prefix_sum,
-                      1,
-                      Utilities::MPI::mpi_type_id_for_type<std::uint64_t>,
-                      MPI_SUM,
-                      comm);
-    AssertThrowMPI(ierr);
-
-    // Locate specific offset for each processor.
-    const MPI_Offset offset = static_cast<MPI_Offset>(header_size) + prefix_sum;
+    if (vtk_flags.write_appended_raw_data)
+      {
+        // In the appended raw encoding, the XML text of all processes is
+        // followed by a single appended data section with the binary data
+        // of all processes in the same order. The XML text contains the
+        // offsets of the arrays within that section, so first determine
+        // where the data of this process starts, then where its XML text
+        // goes.
+        const std::string      piece       = ss.str();
+        const VtuAppendedPiece split_piece = split_vtu_appended_piece(piece);
+        const auto [data_prefix_sum, total_data_size] =
+          Utilities::MPI::partial_and_total_sum(split_piece.data_size(),
+                                                comm);
+
+        const std::string xml = split_piece.get_xml(data_prefix_sum);
+        const auto [xml_prefix_sum, total_xml_size] =
+          Utilities::MPI::partial_and_total_sum(std::uint64_t(xml.size()),
+                                                comm);
+
+        ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
+          fh,
+          static_cast<MPI_Offset>(header_size) + xml_prefix_sum,
+          xml.data(),
+          xml.size(),
+          MPI_CHAR,
+          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
 
-    ierr = Utilities::MPI::LargeCount::File_write_at_all_c(fh,
-                                                           offset,
-                                                           ss.str().c_str(),
-                                                           ss.str().size(),
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
-    AssertThrowMPI(ierr);
+        // Then write the arrays one by one to their place in the appended
+        // data section.
+        const MPI_Offset data_start = static_cast<MPI_Offset>(header_size) +
+                                      total_xml_size +
+                                      vtu_appended_data_start.size();
+        MPI_Offset array_offset = data_start + data_prefix_sum;
+        for (const auto &array : split_piece.arrays)
+          {
+            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              fh,
+              array_offset,
+              array.data(),
+              array.size(),
+              MPI_CHAR,
+              MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+            array_offset += array.size();
+          }
 
-    if (myrank == n_ranks - 1)
+        if (myrank == n_ranks - 1)
+          {
+            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              fh,
+              static_cast<MPI_Offset>(header_size) + total_xml_size,
+              vtu_appended_data_start.data(),
+              vtu_appended_data_start.size(),
+              MPI_CHAR,
+              MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+
+            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              fh,
+              data_start + total_data_size,
+              vtu_appended_data_end.data(),
+              vtu_appended_data_end.size(),
+              MPI_CHAR,
+              MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+      }
+    else
       {
-        // Locating Footer with offset on last rank.
-        footer_offset = size_on_proc + offset;
-
-        std::stringstream ss;
-        DataOutBase::write_vtu_footer(ss);
-        const unsigned int footer_size = ss.str().size();
-
-        // Writing footer:
-        ierr = Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                           footer_offset,
-                                                           ss.str().c_str(),
-                                                           footer_size,
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
+        // Use prefix sum to find specific offset to write at.
+        const std::uint64_t size_on_proc = ss.str().size();
+        std::uint64_t       prefix_sum   = 0;
+        ierr                             = MPI_Exscan(&size_on_proc,
+                          &prefix_sum,
+                          1,
+                          Utilities::MPI::mpi_type_id_for_type<std::uint64_t>,
+                          MPI_SUM,
+                          comm);
+        AssertThrowMPI(ierr);
+
+        // Locate specific offset for each processor.
+        const MPI_Offset offset =
+          static_cast<MPI_Offset>(header_size) + prefix_sum;
+
+        ierr =
+          Utilities::MPI::LargeCount::File_write_at_all_c(fh,
+                                                          offset,
+                                                          ss.str().c_str(),
+                                                          ss.str().size(),
+                                                          MPI_CHAR,
+                                                          MPI_STATUS_IGNORE);
         AssertThrowMPI(ierr);
+
+        if (myrank == n_ranks - 1)
+          {
+            // Locating Footer with offset on last rank.
+            footer_offset = size_on_proc + offset;
+
+            std::stringstream ss;
+            DataOutBase::write_vtu_footer(ss);
+            const unsigned int footer_size = ss.str().size();
+
+            // Writing footer:
+            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              fh,
+              footer_offset,
+              ss.str().c_str(),
+              footer_size,
+              MPI_CHAR,
+              MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
       }
   }
 
@@ -15,6 +15,8 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -35,6 +37,8 @@
 #include <deal.II/grid/tria_iterator.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -61,6 +65,14 @@ namespace internal
           numbers::invalid_dof_index - 1;
 
 
+        /**
+         * The minimal number of cells a thread works on when degrees of
+         * freedom are enumerated in parallel. Triangulations with fewer
+         * active cells are enumerated serially.
+         */
+        const unsigned int enumeration_grain_size = 256;
+
+
         using DoFIdentities =
           std::vector<std::pair<unsigned int, unsigned int>>;
 
@@ -1641,11 +1653,224 @@ namespace internal
 
 
 
+        /**
+         * An operation for
+         * DoFAccessorImplementation::Implementation::process_dof_indices()
+         * that works like DoFIndexProcessor, but only processes the degrees
+         * of freedom of those vertices, lines, and quads of a cell for which
+         * @p select_object returns true. The degrees of freedom in the
+         * interior of the cell are always processed. @p select_object is
+         * called with the dimension and the index of the object.
+         */
+        template <int dim, int spacedim, typename SelectObject>
+        struct SelectedObjectsDoFIndexProcessor
+        {
+          SelectedObjectsDoFIndexProcessor(const SelectObject &select_object)
+            : select_object(select_object)
+          {}
+
+          template <typename DoFProcessor>
+          void
+          process_vertex_dofs(DoFHandler<dim, spacedim> &dof_handler,
+                              const unsigned int         vertex_index,
+                              const types::fe_index      fe_index,
+                              types::global_dof_index  *&dof_indices_ptr,
+                              const DoFProcessor        &dof_processor) const
+          {
+            if (select_object(0, vertex_index))
+              DoFAccessorImplementation::Implementation::
+                DoFIndexProcessor<dim, spacedim>()
+                  .process_vertex_dofs(dof_handler,
+                                       vertex_index,
+                                       fe_index,
+                                       dof_indices_ptr,
+                                       dof_processor);
+          }
+
+          template <int structdim, typename DoFMapping, typename DoFProcessor>
+          void
+          process_dofs(const DoFHandler<dim, spacedim> &dof_handler,
+                       const unsigned int               obj_level,
+                       const unsigned int               obj_index,
+                       const types::fe_index            fe_index,
+                       const DoFMapping                &mapping,
+                       const std::integral_constant<int, structdim>,
+                       types::global_dof_index *&dof_indices_ptr,
+                       const DoFProcessor       &dof_processor) const
+          {
+            if (structdim >= dim || select_object(structdim, obj_index))
+              DoFAccessorImplementation::Implementation::
+                DoFIndexProcessor<dim, spacedim>()
+                  .process_dofs(dof_handler,
+                                obj_level,
+                                obj_index,
+                                fe_index,
+                                mapping,
+                                std::integral_constant<int, structdim>(),
+                                dof_indices_ptr,
+                                dof_processor);
+          }
+
+          const SelectObject &select_object;
+        };
+
+
+
+        /**
+         * Distribute degrees of freedom on the given (active and
+         * non-artificial) @p cells using multiple threads. The result is
+         * the same as if the cells were visited one after the other by
+         * distribute_dofs(), i.e., every vertex, line, and quad is numbered
+         * by the first cell in @p cells it belongs to. This is achieved in
+         * three steps that each run in parallel over chunks of cells:
+         * first, every object is assigned the position of the first cell it
+         * belongs to; then, every cell counts the degrees of freedom it
+         * owns in this sense, and a prefix sum over these counts yields the
+         * first index of each cell; finally, every cell numbers the degrees
+         * of freedom it owns, starting at that index.
+         *
+         * This function does not support hp-capabilities. Return the total
+         * number of dofs distributed.
+         */
+        template <int dim, int spacedim>
+        static types::global_dof_index
+        distribute_dofs_in_parallel(
+          const std::vector<
+            typename DoFHandler<dim, spacedim>::active_cell_iterator> &cells,
+          DoFHandler<dim, spacedim> &dof_handler)
+        {
+          Assert(dof_handler.hp_capability_enabled == false,
+                 ExcNotImplemented());
+          Assert(cells.size() < numbers::invalid_unsigned_int,
+                 ExcNotImplemented());
+
+          // the position of the first cell each vertex, line, and quad
+          // belongs to, accessed concurrently by all cells that share the
+          // object
+          std::array<std::vector<std::atomic<unsigned int>>, dim> first_cell;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              first_cell[d] = std::vector<std::atomic<unsigned int>>(
+                dof_handler.object_dof_ptr[0][d].size());
+              for (auto &position : first_cell[d])
+                position.store(numbers::invalid_unsigned_int,
+                               std::memory_order_relaxed);
+            }
+
+          // run the given operation on the degrees of freedom of all objects
+          // of the cell with the given position for which select_object
+          // returns true
+          const auto process_cell = [&](const unsigned int position,
+                                        const auto        &select_object,
+                                        const auto        &dof_processor) {
+            DoFAccessorImplementation::Implementation::process_dof_indices(
+              *cells[position],
+              std::make_tuple(),
+              cells[position]->active_fe_index(),
+              SelectedObjectsDoFIndexProcessor<
+                dim,
+                spacedim,
+                std::decay_t<decltype(select_object)>>(select_object),
+              dof_processor,
+              false);
+          };
+
+          // step 1: find the first cell of each object
+          dealii::parallel::apply_to_subranges(
+            0U,
+            static_cast<unsigned int>(cells.size()),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int position = begin; position < end; ++position)
+                process_cell(
+                  position,
+                  [&](const unsigned int structdim,
+                      const unsigned int obj_index) {
+                    std::atomic<unsigned int> &first =
+                      first_cell[structdim][obj_index];
+                    unsigned int current =
+                      first.load(std::memory_order_relaxed);
+                    while (position < current &&
+                           !first.compare_exchange_weak(
+                             current, position, std::memory_order_relaxed))
+                      ;
+                    return false;
+                  },
+                  [](auto &, auto) {});
+            },
+            enumeration_grain_size);
+
+          // step 2: count the degrees of freedom owned by each cell and
+          // compute the first index of each cell by a prefix sum
+          std::vector<types::global_dof_index> cell_offsets(cells.size() + 1,
+                                                            0);
+          dealii::parallel::apply_to_subranges(
+            0U,
+            static_cast<unsigned int>(cells.size()),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int position = begin; position < end; ++position)
+                process_cell(
+                  position,
+                  [&](const unsigned int structdim,
+                      const unsigned int obj_index) {
+                    return first_cell[structdim][obj_index].load(
+                             std::memory_order_relaxed) == position;
+                  },
+                  [&](auto &, auto) { ++cell_offsets[position + 1]; });
+            },
+            enumeration_grain_size);
+          std::partial_sum(cell_offsets.begin(),
+                           cell_offsets.end(),
+                           cell_offsets.begin());
+          AssertThrow(
+            cell_offsets.back() <
+              std::numeric_limits<types::global_dof_index>::max(),
+            ExcMessage("You have reached the maximal number of degrees of "
+                       "freedom that can be stored in the chosen data "
+                       "type. In practice, this can only happen if you "
+                       "are using 32-bit data types. You will have to "
+                       "re-compile deal.II with the "
+                       "`DEAL_II_WITH_64BIT_INDICES' flag set to `ON'."));
+
+          // step 3: number the degrees of freedom owned by each cell
+          dealii::parallel::apply_to_subranges(
+            0U,
+            static_cast<unsigned int>(cells.size()),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int position = begin; position < end; ++position)
+                {
+                  types::global_dof_index next_free_dof =
+                    cell_offsets[position];
+                  process_cell(
+                    position,
+                    [&](const unsigned int structdim,
+                        const unsigned int obj_index) {
+                      return first_cell[structdim][obj_index].load(
+                               std::memory_order_relaxed) == position;
+                    },
+                    [&next_free_dof](auto &stored_index, auto) {
+                      if (stored_index == numbers::invalid_dof_index)
+                        stored_index = next_free_dof++;
+                    });
+                  Assert(next_free_dof == cell_offsets[position + 1],
+                         ExcInternalError());
+                }
+            },
+            enumeration_grain_size);
+
+          return cell_offsets.back();
+        }
+
+
+
         /**
          * Distribute degrees of freedom on all cells, or on cells with the
          * correct subdomain_id if the corresponding argument is not equal to
          * numbers::invalid_subdomain_id. Return the total number of dofs
          * distributed.
+         *
+         * For large triangulations without hp-capabilities, the work is
+         * done by distribute_dofs_in_parallel() if more than one thread is
+         * available.
          */
         template <int dim, int spacedim>
         static types::global_dof_index
@@ -1655,6 +1880,23 @@ namespace internal
           Assert(dof_handler.get_triangulation().n_levels() > 0,
                  ExcMessage("Empty triangulation"));
 
+          if (dof_handler.hp_capability_enabled == false &&
+              MultithreadInfo::n_threads() > 1 &&
+              dof_handler.get_triangulation().n_active_cells() >
+                enumeration_grain_size)
+            {
+              std::vector<
+                typename DoFHandler<dim, spacedim>::active_cell_iterator>
+                cells;
+              cells.reserve(dof_handler.get_triangulation().n_active_cells());
+              for (const auto &cell : dof_handler.active_cell_iterators())
+                if (!cell->is_artificial() &&
+                    ((subdomain_id == numbers::invalid_subdomain_id) ||
+                     (cell->subdomain_id() == subdomain_id)))
+                  cells.push_back(cell);
+              return distribute_dofs_in_parallel(cells, dof_handler);
+            }
+
           // distribute dofs on all cells excluding artificial ones
           types::global_dof_index next_free_dof = 0;
 
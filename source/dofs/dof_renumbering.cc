@@ -661,6 +661,105 @@ namespace DoFRenumbering
 
 
 
+  template <int dim, int spacedim>
+  void
+  nested_dissection(DoFHandler<dim, spacedim> &dof_handler,
+                    const unsigned int         max_block_size,
+                    const bool                 use_constraints)
+  {
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.locally_owned_dofs().n_elements(),
+      numbers::invalid_dof_index);
+    compute_nested_dissection(renumbering,
+                              dof_handler,
+                              max_block_size,
+                              use_constraints);
+
+    dof_handler.renumber_dofs(renumbering);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  compute_nested_dissection(std::vector<types::global_dof_index> &new_indices,
+                            const DoFHandler<dim, spacedim> &dof_handler,
+                            const unsigned int               max_block_size,
+                            const bool                       use_constraints)
+  {
+    const IndexSet &locally_owned_dofs = dof_handler.locally_owned_dofs();
+
+    // see if there is anything to do at all or whether we can skip the work on
+    // this processor
+    if (locally_owned_dofs.n_elements() == 0)
+      {
+        Assert(new_indices.empty(), ExcInternalError());
+        return;
+      }
+    AssertDimension(new_indices.size(), locally_owned_dofs.n_elements());
+
+    // make the connection graph, see compute_Cuthill_McKee()
+    AffineConstraints<double> constraints;
+    if (use_constraints)
+      {
+        constraints.reinit(locally_owned_dofs,
+                           DoFTools::extract_locally_relevant_dofs(
+                             dof_handler));
+        DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+      }
+    constraints.close();
+
+    if (locally_owned_dofs.n_elements() == locally_owned_dofs.size())
+      {
+        DynamicSparsityPattern dsp(locally_owned_dofs.size(),
+                                   locally_owned_dofs.size());
+        DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints);
+        SparsityTools::reorder_nested_dissection(dsp,
+                                                 new_indices,
+                                                 max_block_size);
+      }
+    else
+      {
+        // in the parallel case, renumber the locally owned part of the
+        // graph in the local index space and convert the result back to
+        // the global index space
+        DynamicSparsityPattern dsp(locally_owned_dofs.size(),
+                                   locally_owned_dofs.size(),
+                                   locally_owned_dofs);
+        DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints);
+
+        DynamicSparsityPattern local_sparsity(locally_owned_dofs.n_elements(),
+                                              locally_owned_dofs.n_elements());
+        std::vector<types::global_dof_index> row_entries;
+        for (unsigned int i = 0; i < locally_owned_dofs.n_elements(); ++i)
+          {
+            const types::global_dof_index row =
+              locally_owned_dofs.nth_index_in_set(i);
+            const unsigned int row_length = dsp.row_length(row);
+            row_entries.clear();
+            for (unsigned int j = 0; j < row_length; ++j)
+              {
+                const types::global_dof_index col = dsp.column_number(row, j);
+                if (col != row && locally_owned_dofs.is_element(col))
+                  row_entries.push_back(
+                    locally_owned_dofs.index_within_set(col));
+              }
+            local_sparsity.add_entries(i,
+                                       row_entries.begin(),
+                                       row_entries.end(),
+                                       true);
+          }
+
+        SparsityTools::reorder_nested_dissection(local_sparsity,
+                                                 new_indices,
+                                                 max_block_size);
+        for (types::global_dof_index &new_index : new_indices)
+          new_index = locally_owned_dofs.nth_index_in_set(new_index);
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   void
   component_wise(DoFHandler<dim, spacedim>       &dof_handler,
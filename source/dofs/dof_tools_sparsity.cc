@@ -12,9 +12,11 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
+#include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/shared_tria.h>
@@ -39,6 +41,7 @@
 #include <deal.II/hp/q_collection.h>
 
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
 #include <deal.II/lac/vector.h>
 
@@ -122,6 +125,224 @@ namespace DoFTools
 
 
 
+  namespace internal
+  {
+    namespace
+    {
+      /**
+       * A sparsity pattern that only keeps the entries in a given range of
+       * rows, stored as a list of (row, column) pairs. Whenever the list has
+       * doubled in size since it was last sorted, the new entries are sorted
+       * and merged into the sorted part and duplicates are removed, which
+       * bounds the memory consumption by about twice the number of distinct
+       * entries.
+       */
+      class RowRangeEntryCollector : public SparsityPatternBase
+      {
+      public:
+        RowRangeEntryCollector(const size_type n,
+                               const size_type first_row,
+                               const size_type end_row)
+          : SparsityPatternBase(n, n)
+          , first_row(first_row)
+          , end_row(end_row)
+          , n_sorted_entries(0)
+        {}
+
+        virtual void
+        add_row_entries(const size_type                  &row,
+                        const ArrayView<const size_type> &columns,
+                        const bool) override
+        {
+          if (row < first_row || row >= end_row)
+            return;
+
+          for (const size_type column : columns)
+            entries.emplace_back(row, column);
+          if (entries.size() > 2 * n_sorted_entries + 1024)
+            compress();
+        }
+
+        virtual void
+        add_entries(const ArrayView<const std::pair<size_type, size_type>>
+                      &new_entries) override
+        {
+          for (const auto &entry : new_entries)
+            if (entry.first >= first_row && entry.first < end_row)
+              entries.push_back(entry);
+          if (entries.size() > 2 * n_sorted_entries + 1024)
+            compress();
+        }
+
+        void
+        compress()
+        {
+          std::sort(entries.begin() + n_sorted_entries, entries.end());
+          std::inplace_merge(entries.begin(),
+                             entries.begin() + n_sorted_entries,
+                             entries.end());
+          entries.erase(std::unique(entries.begin(), entries.end()),
+                        entries.end());
+          n_sorted_entries = entries.size();
+        }
+
+        /**
+         * The entries collected so far. They are sorted and unique after a
+         * call to compress().
+         */
+        std::vector<std::pair<size_type, size_type>> entries;
+
+      private:
+        const size_type first_row;
+        const size_type end_row;
+        std::size_t     n_sorted_entries;
+      };
+    } // namespace
+  }   // namespace internal
+
+
+
+  template <int dim, int spacedim, typename number>
+  void
+  make_compressed_sparsity_pattern(
+    const DoFHandler<dim, spacedim> &dof,
+    SparsityPattern                 &sparsity,
+    const AffineConstraints<number> &constraints,
+    const bool                       keep_constrained_dofs,
+    const types::subdomain_id        subdomain_id)
+  {
+    const types::global_dof_index n_dofs = dof.n_dofs();
+
+    if (const auto *triangulation = dynamic_cast<
+          const parallel::DistributedTriangulationBase<dim, spacedim> *>(
+          &dof.get_triangulation()))
+      {
+        Assert((subdomain_id == numbers::invalid_subdomain_id) ||
+                 (subdomain_id == triangulation->locally_owned_subdomain()),
+               ExcMessage(
+                 "For distributed Triangulation objects and associated "
+                 "DoFHandler objects, asking for any subdomain other than the "
+                 "locally owned one does not make sense."));
+      }
+
+    const auto                 &fe_collection = dof.get_fe_collection();
+    std::vector<Table<2, bool>> fe_dof_mask(fe_collection.size());
+    for (unsigned int f = 0; f < fe_collection.size(); ++f)
+      fe_dof_mask[f] = fe_collection[f].get_local_dof_sparsity_pattern();
+
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cells;
+    for (const auto &cell : dof.active_cell_iterators())
+      if (((subdomain_id == numbers::invalid_subdomain_id) ||
+           (subdomain_id == cell->subdomain_id())) &&
+          cell->is_locally_owned())
+        cells.push_back(cell);
+
+    // split the rows into a few ranges per thread for load balancing, but
+    // avoid very small ranges for which the cells at the range boundaries,
+    // which are processed once per range, would dominate the work
+    const unsigned int n_ranges = std::max<types::global_dof_index>(
+      1,
+      std::min<types::global_dof_index>(4 * MultithreadInfo::n_threads(),
+                                        n_dofs / 1000));
+    const auto range_of_row = [n_dofs,
+                               n_ranges](const types::global_dof_index row) {
+      return static_cast<unsigned int>(static_cast<std::uint64_t>(row) *
+                                       n_ranges / n_dofs);
+    };
+    const auto first_row_of_range = [n_dofs,
+                                     n_ranges](const unsigned int range) {
+      return static_cast<types::global_dof_index>(
+        (static_cast<std::uint64_t>(range) * n_dofs + n_ranges - 1) /
+        n_ranges);
+    };
+
+    // step 1: sort the cells into lists according to the row ranges they
+    // write into, both through their own degrees of freedom and through the
+    // degrees of freedom these are constrained to. the cells are split into
+    // as many chunks as there are row ranges, and the lists are kept per
+    // chunk so that the tasks do not need to synchronize
+    std::vector<std::vector<std::vector<unsigned int>>> cells_in_range(
+      n_ranges, std::vector<std::vector<unsigned int>>(n_ranges));
+    {
+      Threads::TaskGroup<> tasks;
+      for (unsigned int chunk = 0; chunk < n_ranges; ++chunk)
+        tasks += Threads::new_task([&, chunk]() {
+          std::vector<types::global_dof_index> dofs_on_this_cell;
+          std::vector<unsigned int>            ranges;
+          for (std::size_t c = cells.size() * chunk / n_ranges;
+               c < cells.size() * (chunk + 1) / n_ranges;
+               ++c)
+            {
+              dofs_on_this_cell.resize(cells[c]->get_fe().n_dofs_per_cell());
+              cells[c]->get_dof_indices(dofs_on_this_cell);
+
+              ranges.clear();
+              for (const types::global_dof_index i : dofs_on_this_cell)
+                {
+                  ranges.push_back(range_of_row(i));
+                  if (const auto *entries =
+                        constraints.get_constraint_entries(i))
+                    for (const auto &entry : *entries)
+                      ranges.push_back(range_of_row(entry.first));
+                }
+              std::sort(ranges.begin(), ranges.end());
+              ranges.erase(std::unique(ranges.begin(), ranges.end()),
+                           ranges.end());
+
+              for (const unsigned int range : ranges)
+                cells_in_range[chunk][range].push_back(c);
+            }
+        });
+      tasks.join_all();
+    }
+
+    // step 2: for each row range, collect the entries of the cells that
+    // write into it. each task only keeps the entries in its own rows, so
+    // no locking is needed
+    std::vector<std::vector<std::pair<types::global_dof_index,
+                                      types::global_dof_index>>>
+      entries(n_ranges);
+    {
+      Threads::TaskGroup<> tasks;
+      for (unsigned int range = 0; range < n_ranges; ++range)
+        tasks += Threads::new_task([&, range]() {
+          internal::RowRangeEntryCollector collector(
+            n_dofs, first_row_of_range(range), first_row_of_range(range + 1));
+
+          std::vector<types::global_dof_index> dofs_on_this_cell;
+          for (unsigned int chunk = 0; chunk < n_ranges; ++chunk)
+            for (const unsigned int c : cells_in_range[chunk][range])
+              {
+                dofs_on_this_cell.resize(
+                  cells[c]->get_fe().n_dofs_per_cell());
+                cells[c]->get_dof_indices(dofs_on_this_cell);
+
+                const types::fe_index fe_index = cells[c]->active_fe_index();
+                if (fe_dof_mask[fe_index].empty())
+                  constraints.add_entries_local_to_global(
+                    dofs_on_this_cell, collector, keep_constrained_dofs);
+                else
+                  constraints.add_entries_local_to_global(
+                    dofs_on_this_cell,
+                    collector,
+                    keep_constrained_dofs,
+                    fe_dof_mask[fe_index]);
+              }
+
+          collector.compress();
+          entries[range].swap(collector.entries);
+          entries[range].shrink_to_fit();
+        });
+      tasks.join_all();
+    }
+
+    // step 3: merge the lists into the compressed sparsity pattern
+    sparsity.copy_from(n_dofs, n_dofs, entries);
+  }
+
+
+
   template <int dim, int spacedim, typename number>
   void
   make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
@@ -14,6 +14,7 @@
 
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/patterns.h>
 #include <deal.II/base/utilities.h>
 
@@ -39,7 +40,9 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <limits>
@@ -136,6 +139,440 @@ namespace
     if (is_only_hypercube)
       GridTools::consistently_order_cells(cells);
   }
+
+
+
+  /**
+   * The minimal number of nodes or elements of a Gmsh file a thread works on
+   * when converting them in read_msh_binary().
+   */
+  constexpr std::size_t gmsh_grain_size = 4096;
+
+
+
+  /**
+   * Read the data of a Gmsh file of format 4.1 in binary form from @p in,
+   * which is positioned just behind the line with the version of the file
+   * format. The content of the file is read in large chunks into memory and
+   * the data are then taken directly from the raw bytes. The sections are
+   * scanned one after the other, but the conversion of the nodes and
+   * elements of each entity block is split into chunks that are worked on
+   * in parallel.
+   *
+   * The output arguments are the same as the ones set up by the parser of
+   * the ASCII format in GridIn::read_msh().
+   */
+  template <int dim, int spacedim>
+  void
+  read_msh_binary(std::istream                               &in,
+                  std::vector<Point<spacedim>>               &vertices,
+                  std::vector<CellData<dim>>                 &cells,
+                  SubCellData                                &subcelldata,
+                  std::map<unsigned int, types::boundary_id> &boundary_ids_1d,
+                  std::map<unsigned int, unsigned int>       &vertex_counts)
+  {
+    using ExcInvalidGMSHInput =
+      typename GridIn<dim, spacedim>::ExcInvalidGMSHInput;
+    using ExcGmshUnsupportedGeometry =
+      typename GridIn<dim, spacedim>::ExcGmshUnsupportedGeometry;
+    using ExcInvalidVertexIndexGmsh =
+      typename GridIn<dim, spacedim>::ExcInvalidVertexIndexGmsh;
+
+    std::vector<char> buffer;
+    {
+      constexpr std::size_t chunk_size = 1 << 24;
+      while (in)
+        {
+          const std::size_t old_size = buffer.size();
+          buffer.resize(old_size + chunk_size);
+          in.read(buffer.data() + old_size, chunk_size);
+          buffer.resize(old_size + in.gcount());
+        }
+    }
+    const char *position = buffer.data();
+    const char *const buffer_end = buffer.data() + buffer.size();
+
+    // read a value of the given type from the current position
+    const auto read = [&](auto value) {
+      AssertThrow(position + sizeof(value) <= buffer_end, ExcIO());
+      std::memcpy(&value, position, sizeof(value));
+      position += sizeof(value);
+      return value;
+    };
+
+    // read the next non-empty line, as used for section markers
+    const auto read_line = [&]() {
+      std::string line;
+      while (line.empty() && position < buffer_end)
+        {
+          const char *line_end = std::find(position, buffer_end, '\n');
+          line.assign(position, line_end);
+          if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+          position = std::min(line_end + 1, buffer_end);
+        }
+      return line;
+    };
+
+    // the header is followed by the integer one, which allows to detect
+    // files written on machines with a different byte order
+    AssertThrow(read(int()) == 1,
+                ExcMessage("The binary Gmsh file was written on a machine "
+                           "with a different byte order and can not be "
+                           "read."));
+    std::string line = read_line();
+    AssertThrow(line == "$EndMeshFormat", ExcInvalidGMSHInput(line));
+
+    // maps from the 'entities' to the 'physical tags' for points, curves,
+    // surfaces and volumes
+    std::array<std::map<int, int>, 4> tag_maps;
+
+    // the index of each node in the vertices array, indexed by the node tag
+    // minus the smallest node tag
+    std::vector<unsigned int> vertex_indices;
+    std::size_t               min_node_tag     = 0;
+    const auto                get_vertex_index = [&](const std::size_t tag) {
+      return (tag >= min_node_tag &&
+              tag - min_node_tag < vertex_indices.size()) ?
+               vertex_indices[tag - min_node_tag] :
+               numbers::invalid_unsigned_int;
+    };
+
+    while (position < buffer_end)
+      {
+        line = read_line();
+        if (line == "$Entities")
+          {
+            const std::size_t n_entities[4] = {read(std::size_t()),
+                                               read(std::size_t()),
+                                               read(std::size_t()),
+                                               read(std::size_t())};
+            for (unsigned int d = 0; d < 4; ++d)
+              for (std::size_t i = 0; i < n_entities[d]; ++i)
+                {
+                  const int tag = read(int());
+                  // skip the coordinates of a point or the bounding box of
+                  // other entities
+                  position += (d == 0 ? 3 : 6) * sizeof(double);
+                  const std::size_t n_physicals = read(std::size_t());
+                  AssertThrow(n_physicals < 2,
+                              ExcMessage(
+                                "More than one tag is not supported!"));
+                  // if there is no physical tag, use 0 as default
+                  int physical_tag = 0;
+                  for (std::size_t j = 0; j < n_physicals; ++j)
+                    physical_tag = read(int());
+                  tag_maps[d][tag] = physical_tag;
+                  // skip the bounding entities
+                  if (d > 0)
+                    position += read(std::size_t()) * sizeof(int);
+                }
+          }
+        else if (line == "$Nodes")
+          {
+            const std::size_t n_entity_blocks = read(std::size_t());
+            const std::size_t n_nodes         = read(std::size_t());
+            min_node_tag                      = read(std::size_t());
+            const std::size_t max_node_tag    = read(std::size_t());
+            AssertThrow(n_nodes < numbers::invalid_unsigned_int,
+                        ExcNotImplemented());
+
+            vertices.resize(n_nodes);
+            vertex_indices.assign(
+              n_nodes > 0 ? max_node_tag - min_node_tag + 1 : 0,
+              numbers::invalid_unsigned_int);
+            unsigned int first_vertex = 0;
+            for (std::size_t block = 0; block < n_entity_blocks; ++block)
+              {
+                const int         entity_dim = read(int());
+                const int         entity_tag = read(int());
+                const int         parametric = read(int());
+                const std::size_t n_block_nodes = read(std::size_t());
+                (void)entity_tag;
+                AssertThrow(first_vertex + n_block_nodes <= n_nodes,
+                            ExcInvalidGMSHInput(line));
+
+                // the tags of all nodes of the block are followed by their
+                // coordinates, possibly with parametric coordinates
+                const char *const tags = position;
+                const char *const coordinates =
+                  tags + n_block_nodes * sizeof(std::size_t);
+                const unsigned int n_values_per_node =
+                  3 + (parametric != 0 ? entity_dim : 0);
+                position = coordinates +
+                           n_block_nodes * n_values_per_node * sizeof(double);
+                AssertThrow(position <= buffer_end, ExcIO());
+
+                // do not throw from within the tasks, but only mark invalid
+                // tags and throw after the parallel loop
+                std::atomic<bool> has_invalid_tag(false);
+                parallel::apply_to_subranges(
+                  std::size_t(0),
+                  n_block_nodes,
+                  [&](const std::size_t begin, const std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i)
+                      {
+                        std::size_t tag;
+                        std::memcpy(&tag,
+                                    tags + i * sizeof(std::size_t),
+                                    sizeof(std::size_t));
+                        if (tag < min_node_tag || tag > max_node_tag)
+                          {
+                            has_invalid_tag.store(true,
+                                                  std::memory_order_relaxed);
+                            continue;
+                          }
+                        double x[3];
+                        std::memcpy(x,
+                                    coordinates +
+                                      i * n_values_per_node * sizeof(double),
+                                    sizeof(x));
+                        for (unsigned int d = 0; d < spacedim; ++d)
+                          vertices[first_vertex + i][d] = x[d];
+                        vertex_indices[tag - min_node_tag] = first_vertex + i;
+                      }
+                  },
+                  gmsh_grain_size);
+                AssertThrow(!has_invalid_tag, ExcInvalidGMSHInput(line));
+                first_vertex += n_block_nodes;
+              }
+            AssertDimension(first_vertex, n_nodes);
+          }
+        else if (line == "$Elements")
+          {
+            static constexpr std::array<unsigned int, 8>
+              local_vertex_numbering = {{0, 1, 5, 4, 2, 3, 7, 6}};
+
+            const std::size_t n_entity_blocks = read(std::size_t());
+            const std::size_t n_elements      = read(std::size_t());
+            read(std::size_t()); // minimal element tag
+            read(std::size_t()); // maximal element tag
+
+            std::size_t global_cell = 0;
+            for (std::size_t block = 0; block < n_entity_blocks; ++block)
+              {
+                const int         entity_dim      = read(int());
+                const int         entity_tag      = read(int());
+                const int         cell_type       = read(int());
+                const std::size_t n_block_elements = read(std::size_t());
+                AssertThrow(entity_dim >= 0 && entity_dim <= 3,
+                            ExcInvalidGMSHInput(line));
+                const auto tag = tag_maps[entity_dim].find(entity_tag);
+                const unsigned int material_id =
+                  (tag != tag_maps[entity_dim].end() ? tag->second : 0);
+
+                unsigned int n_element_vertices = 0;
+                if (cell_type == 1) // line
+                  n_element_vertices = 2;
+                else if (cell_type == 2) // tri
+                  n_element_vertices = 3;
+                else if (cell_type == 3) // quad
+                  n_element_vertices = 4;
+                else if (cell_type == 4) // tet
+                  n_element_vertices = 4;
+                else if (cell_type == 5) // hex
+                  n_element_vertices = 8;
+                else if (cell_type == 15) // point
+                  n_element_vertices = 1;
+                else
+                  AssertThrow(false, ExcGmshUnsupportedGeometry(cell_type));
+
+                // each element consists of its tag and the tags of its nodes
+                const char *const elements = position;
+                const std::size_t element_size =
+                  (1 + n_element_vertices) * sizeof(std::size_t);
+                position = elements + n_block_elements * element_size;
+                AssertThrow(position <= buffer_end, ExcIO());
+
+                // return the node tag of the given vertex of the given
+                // element
+                const auto get_node_tag = [&](const std::size_t  element,
+                                              const unsigned int vertex) {
+                  std::size_t node_tag;
+                  std::memcpy(&node_tag,
+                              elements + element * element_size +
+                                (1 + vertex) * sizeof(std::size_t),
+                              sizeof(std::size_t));
+                  return node_tag;
+                };
+
+                std::atomic<bool> has_invalid_vertex(false);
+
+                // return the index of the given vertex of the given element.
+                // this function is called from within parallel tasks, so it
+                // does not throw for unknown node tags, but only marks them
+                // to be reported by check_vertices() after the loop
+                const auto get_vertex = [&](const std::size_t  element,
+                                            const unsigned int vertex) {
+                  const unsigned int index =
+                    get_vertex_index(get_node_tag(element, vertex));
+                  if (index == numbers::invalid_unsigned_int)
+                    has_invalid_vertex.store(true, std::memory_order_relaxed);
+                  return index;
+                };
+
+                // throw for the first element of the block that refers to an
+                // unknown node, if there is any
+                const auto check_vertices = [&]() {
+                  if (!has_invalid_vertex)
+                    return;
+                  for (std::size_t e = 0; e < n_block_elements; ++e)
+                    for (unsigned int i = 0; i < n_element_vertices; ++i)
+                      {
+                        const std::size_t node_tag = get_node_tag(e, i);
+                        AssertThrow(get_vertex_index(node_tag) !=
+                                      numbers::invalid_unsigned_int,
+                                    ExcInvalidVertexIndexGmsh(e,
+                                                              global_cell + e,
+                                                              node_tag));
+                      }
+                };
+
+                if (((cell_type == 1) && (dim == 1)) || // a line in 1d
+                    ((cell_type == 2) && (dim == 2)) || // a triangle in 2d
+                    ((cell_type == 3) && (dim == 2)) || // a quad in 2d
+                    ((cell_type == 4) && (dim == 3)) || // a tet in 3d
+                    ((cell_type == 5) && (dim == 3)))   // a hex in 3d
+                  {
+                    // we use only material_ids in the range from 0 to
+                    // numbers::invalid_material_id-1
+                    AssertThrow(material_id < numbers::invalid_material_id,
+                                ExcIndexRange(material_id,
+                                              0,
+                                              numbers::invalid_material_id));
+
+                    const std::size_t first_cell = cells.size();
+                    cells.resize(first_cell + n_block_elements);
+                    parallel::apply_to_subranges(
+                      std::size_t(0),
+                      n_block_elements,
+                      [&](const std::size_t begin, const std::size_t end) {
+                        for (std::size_t e = begin; e < end; ++e)
+                          {
+                            CellData<dim> &cell = cells[first_cell + e];
+                            cell.vertices.resize(n_element_vertices);
+                            for (unsigned int i = 0; i < n_element_vertices;
+                                 ++i)
+                              // hypercube cells need to be reordered
+                              if (n_element_vertices ==
+                                  GeometryInfo<dim>::vertices_per_cell)
+                                cell.vertices[dim == 3 ?
+                                                local_vertex_numbering[i] :
+                                                GeometryInfo<dim>::
+                                                  ucd_to_deal[i]] =
+                                  get_vertex(e, i);
+                              else
+                                cell.vertices[i] = get_vertex(e, i);
+                            cell.material_id = material_id;
+                          }
+                      },
+                      gmsh_grain_size);
+
+                    if (dim == 1)
+                      for (std::size_t e = first_cell; e < cells.size(); ++e)
+                        for (const unsigned int vertex : cells[e].vertices)
+                          vertex_counts[vertex] += 1u;
+                  }
+                else if ((cell_type == 1 && (dim == 2 || dim == 3)) ||
+                         ((cell_type == 2 || cell_type == 3) && dim == 3))
+                  // boundary info: lines in 2d or 3d, triangles or quads in
+                  // 3d
+                  {
+                    // we use only boundary_ids in the range from 0 to
+                    // numbers::internal_face_boundary_id-1
+                    AssertThrow(material_id <
+                                  numbers::internal_face_boundary_id,
+                                ExcIndexRange(
+                                  material_id,
+                                  0,
+                                  numbers::internal_face_boundary_id));
+
+                    std::vector<CellData<1>> &boundary_lines =
+                      subcelldata.boundary_lines;
+                    std::vector<CellData<2>> &boundary_quads =
+                      subcelldata.boundary_quads;
+                    const std::size_t first_object =
+                      (cell_type == 1 ? boundary_lines.size() :
+                                        boundary_quads.size());
+                    if (cell_type == 1)
+                      boundary_lines.resize(first_object + n_block_elements);
+                    else
+                      boundary_quads.resize(first_object + n_block_elements);
+
+                    parallel::apply_to_subranges(
+                      std::size_t(0),
+                      n_block_elements,
+                      [&](const std::size_t begin, const std::size_t end) {
+                        for (std::size_t e = begin; e < end; ++e)
+                          if (cell_type == 1)
+                            {
+                              CellData<1> &object =
+                                boundary_lines[first_object + e];
+                              for (unsigned int i = 0; i < 2; ++i)
+                                object.vertices[i] = get_vertex(e, i);
+                              object.boundary_id =
+                                static_cast<types::boundary_id>(material_id);
+                            }
+                          else
+                            {
+                              CellData<2> &object =
+                                boundary_quads[first_object + e];
+                              object.vertices.resize(n_element_vertices);
+                              for (unsigned int i = 0; i < n_element_vertices;
+                                   ++i)
+                                object.vertices[i] = get_vertex(e, i);
+                              object.boundary_id =
+                                static_cast<types::boundary_id>(material_id);
+                            }
+                      },
+                      gmsh_grain_size);
+                  }
+                else if (cell_type == 15)
+                  {
+                    // we only care about boundary indicators assigned to
+                    // individual vertices in 1d (because otherwise the
+                    // vertices are not faces)
+                    if (dim == 1)
+                      for (std::size_t e = 0; e < n_block_elements; ++e)
+                        boundary_ids_1d[get_vertex(e, 0)] = material_id;
+                  }
+                else
+                  AssertThrow(false, ExcGmshUnsupportedGeometry(cell_type));
+
+                check_vertices();
+                global_cell += n_block_elements;
+              }
+            AssertDimension(global_cell, n_elements);
+
+            // the elements are the last section we are interested in
+            line = read_line();
+            AssertThrow(line == "$EndElements", ExcInvalidGMSHInput(line));
+            return;
+          }
+        else if (!line.empty() && line[0] == '$')
+          {
+            // skip over all other sections, which may contain binary data
+            // that we can not parse line by line
+            const std::string end_marker = "\n$End" + line.substr(1);
+            position = std::search(position,
+                                   buffer_end,
+                                   end_marker.begin(),
+                                   end_marker.end());
+            AssertThrow(position != buffer_end, ExcInvalidGMSHInput(line));
+            position += end_marker.size();
+            continue;
+          }
+        else
+          AssertThrow(false, ExcInvalidGMSHInput(line));
+
+        // all sections we parse end with a marker
+        const std::string end_line = read_line();
+        AssertThrow(end_line == "$End" + line.substr(1),
+                    ExcInvalidGMSHInput(end_line));
+      }
+
+    AssertThrow(false, ExcInvalidGMSHInput("$Elements"));
+  }
 } // namespace
 
 template <int dim, int spacedim>
@@ -2210,6 +2647,73 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
   // contain the content of the file stripped of the comments
   std::string stripped_file;
 
+  // Comments may precede the header, so skip them before looking at the
+  // format of the file
+  std::getline(input_stream, line);
+  while (line == "$Comments")
+    {
+      while (std::getline(input_stream, line))
+        if (line == "$EndComments")
+          break;
+      std::getline(input_stream, line);
+    }
+
+  // Files of format 4.1 may store their data in binary form, which can not be
+  // parsed as text. Check the header for this case and read such files with a
+  // separate function that converts the raw data in parallel.
+  if (line == "$MeshFormat")
+    {
+      std::string format_line;
+      std::getline(input_stream, format_line);
+
+      double             version   = 0;
+      unsigned int       file_type = 0, data_size = 0;
+      std::istringstream format(format_line);
+      format >> version >> file_type >> data_size;
+      if (file_type == 1)
+        {
+          AssertThrow(version == 4.1, ExcNotImplemented());
+          AssertThrow(data_size == sizeof(std::size_t), ExcNotImplemented());
+
+          std::vector<Point<spacedim>>               vertices;
+          std::vector<CellData<dim>>                 cells;
+          SubCellData                                subcelldata;
+          std::map<unsigned int, types::boundary_id> boundary_ids_1d;
+          std::map<unsigned int, unsigned int>       vertex_counts;
+          read_msh_binary(input_stream,
+                          vertices,
+                          cells,
+                          subcelldata,
+                          boundary_ids_1d,
+                          vertex_counts);
+
+          // check that we actually read some cells.
+          AssertThrow(cells.size() > 0,
+                      ExcGmshNoCellInformation(
+                        subcelldata.boundary_lines.size(),
+                        subcelldata.boundary_quads.size()));
+
+          std::vector<std::pair<Point<spacedim>, types::boundary_id>>
+            boundary_id_pairs;
+          if (dim == 1)
+            for (const auto &pair : vertex_counts)
+              if (pair.second == 1u)
+                boundary_id_pairs.emplace_back(vertices[pair.first],
+                                               boundary_ids_1d[pair.first]);
+
+          apply_grid_fixup_functions(vertices, cells, subcelldata);
+          tria->create_triangulation(vertices, cells, subcelldata);
+
+          if (dim == 1)
+            assign_1d_boundary_ids(boundary_id_pairs, *tria);
+          return;
+        }
+
+      stripped_file += line + '\n' + format_line + '\n';
+    }
+  else
+    stripped_file += line + '\n';
+
   // Comments can be included by mesh generating software and must be deleted,
   // a string is filed with the content of the file stripped of the comments
   while (std::getline(input_stream, line))
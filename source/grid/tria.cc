@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -1883,6 +1884,12 @@ namespace internal
     // internal::TriangulationImplementation
     using dealii::Triangulation;
 
+    /**
+     * The minimal number of cells a task works on when a loop over the cells
+     * of a level is split into chunks that are processed in parallel.
+     */
+    constexpr unsigned int cell_loop_grain_size = 512;
+
     /**
      * Exception
      * @ingroup Exceptions
@@ -2715,6 +2722,37 @@ namespace internal
      */
     struct Implementation
     {
+      /**
+       * Call @p function for all used cells of the given Triangulation,
+       * splitting the cells of each level into chunks that are processed in
+       * parallel. The function must only modify data that belongs to the
+       * cell it is called with.
+       */
+      template <int dim, int spacedim, typename Function>
+      static void
+      for_all_cells_in_parallel(
+        const Triangulation<dim, spacedim> &triangulation,
+        const Function                     &function)
+      {
+        for (unsigned int level = 0; level < triangulation.levels.size();
+             ++level)
+          dealii::parallel::apply_to_subranges(
+            0U,
+            triangulation.levels[level]->cells.n_objects(),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int index = begin; index < end; ++index)
+                {
+                  const typename Triangulation<dim, spacedim>::raw_cell_iterator
+                    cell(&triangulation, level, index);
+                  if (cell->used())
+                    function(cell);
+                }
+            },
+            cell_loop_grain_size);
+      }
+
+
+
       /**
        * For a given Triangulation, update that part of the number
        * cache that relates to lines. For 1d, we have to deal with the
@@ -3204,17 +3242,24 @@ namespace internal
         // have to use the opposite of the
         // left_right_offset in this case as we want
         // the offset of the neighbor, not our own.
-        for (const auto &cell : triangulation.cell_iterators())
-          for (auto f : cell->face_indices())
-            {
-              const unsigned int offset =
-                (cell->direction_flag() ?
-                   left_right_offset[dim - 2][f][cell->face_orientation(f)] :
-                   1 -
-                     left_right_offset[dim - 2][f][cell->face_orientation(f)]);
-              cell->set_neighbor(
-                f, adjacent_cells[2 * cell->face(f)->index() + 1 - offset]);
-            }
+        // Each cell only writes its own neighbors
+        // here, so we can work on chunks of cells
+        // in parallel.
+        const auto set_neighbors =
+          [&](const typename Triangulation<dim, spacedim>::raw_cell_iterator
+                &cell) {
+            for (auto f : cell->face_indices())
+              {
+                const unsigned int offset =
+                  (cell->direction_flag() ?
+                     left_right_offset[dim - 2][f][cell->face_orientation(f)] :
+                     1 - left_right_offset[dim - 2][f]
+                                          [cell->face_orientation(f)]);
+                cell->set_neighbor(
+                  f, adjacent_cells[2 * cell->face(f)->index() + 1 - offset]);
+              }
+          };
+        for_all_cells_in_parallel(triangulation, set_neighbors);
       }
 
 
@@ -11952,9 +11997,15 @@ namespace internal
                   set_entry(face->child(c)->index(), cell);
             }
 
-        for (const auto &cell : triangulation.cell_iterators())
-          for (auto f : cell->face_indices())
-            cell->set_neighbor(f, get_entry(cell->face(f)->index(), cell));
+        // each cell only writes its own neighbors, so we can work on chunks
+        // of cells in parallel
+        Implementation::for_all_cells_in_parallel(
+          triangulation,
+          [&](const typename Triangulation<dim, spacedim>::raw_cell_iterator
+                &cell) {
+            for (auto f : cell->face_indices())
+              cell->set_neighbor(f, get_entry(cell->face(f)->index(), cell));
+          });
       }
 
       template <int dim, int spacedim>
@@ -15986,93 +16037,108 @@ void Triangulation<dim, spacedim>::reset_cell_vertex_indices_cache()
       cache.resize(levels[l]->refine_flags.size() *
                      ReferenceCells::max_n_vertices<dim>(),
                    numbers::invalid_unsigned_int);
-      for (const auto &cell : cell_iterators_on_level(l))
-        {
-          const unsigned int my_index =
-            cell->index() * ReferenceCells::max_n_vertices<dim>();
-
-          // to reduce the cost of this function when passing down into quads,
-          // then lines, then vertices, we use a more low-level access method
-          // for hexahedral cells, where we can streamline most of the logic
-          const ReferenceCell ref_cell = cell->reference_cell();
-          if (ref_cell == ReferenceCells::Hexahedron)
-            for (unsigned int face = 4; face < 6; ++face)
-              {
-                const auto face_iter = cell->face(face);
-                const std::array<types::geometric_orientation, 2>
-                  line_orientations{{face_iter->line_orientation(0),
-                                     face_iter->line_orientation(1)}};
-                const std::array<unsigned int, 2> line_vertex_indices{
-                  {line_orientations[0] ==
-                     numbers::default_geometric_orientation,
-                   line_orientations[1] ==
-                     numbers::default_geometric_orientation}};
-                const std::array<unsigned int, 4> raw_vertex_indices{
-                  {face_iter->line(0)->vertex_index(1 - line_vertex_indices[0]),
-                   face_iter->line(1)->vertex_index(1 - line_vertex_indices[1]),
-                   face_iter->line(0)->vertex_index(line_vertex_indices[0]),
-                   face_iter->line(1)->vertex_index(line_vertex_indices[1])}};
-
-                const auto combined_orientation =
-                  levels[l]->face_orientations.get_combined_orientation(
-                    cell->index() * ReferenceCells::max_n_faces<dim>() + face);
-                const std::array<unsigned int, 4> vertex_order{
-                  {ref_cell.standard_to_real_face_vertex(0,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(1,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(2,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(
-                     3, face, combined_orientation)}};
-
-                const unsigned int index = my_index + 4 * (face - 4);
-                for (unsigned int i = 0; i < 4; ++i)
-                  cache[index + i] = raw_vertex_indices[vertex_order[i]];
-              }
-          else if (ref_cell == ReferenceCells::Quadrilateral)
+
+      // the entries of different cells are independent of each other, so
+      // they can be filled in parallel
+      const auto fill_cache = [&](const raw_cell_iterator &cell) {
+        const unsigned int my_index =
+          cell->index() * ReferenceCells::max_n_vertices<dim>();
+
+        // to reduce the cost of this function when passing down into quads,
+        // then lines, then vertices, we use a more low-level access method
+        // for hexahedral cells, where we can streamline most of the logic
+        const ReferenceCell ref_cell = cell->reference_cell();
+        if (ref_cell == ReferenceCells::Hexahedron)
+          for (unsigned int face = 4; face < 6; ++face)
             {
+              const auto face_iter = cell->face(face);
               const std::array<types::geometric_orientation, 2>
-                line_orientations{
-                  {cell->line_orientation(0), cell->line_orientation(1)}};
+                line_orientations{{face_iter->line_orientation(0),
+                                   face_iter->line_orientation(1)}};
               const std::array<unsigned int, 2> line_vertex_indices{
-                {line_orientations[0] == numbers::default_geometric_orientation,
+                {line_orientations[0] ==
+                   numbers::default_geometric_orientation,
                  line_orientations[1] ==
                    numbers::default_geometric_orientation}};
               const std::array<unsigned int, 4> raw_vertex_indices{
-                {cell->line(0)->vertex_index(1 - line_vertex_indices[0]),
-                 cell->line(1)->vertex_index(1 - line_vertex_indices[1]),
-                 cell->line(0)->vertex_index(line_vertex_indices[0]),
-                 cell->line(1)->vertex_index(line_vertex_indices[1])}};
+                {face_iter->line(0)->vertex_index(1 - line_vertex_indices[0]),
+                 face_iter->line(1)->vertex_index(1 - line_vertex_indices[1]),
+                 face_iter->line(0)->vertex_index(line_vertex_indices[0]),
+                 face_iter->line(1)->vertex_index(line_vertex_indices[1])}};
+
+              const auto combined_orientation =
+                levels[l]->face_orientations.get_combined_orientation(
+                  cell->index() * ReferenceCells::max_n_faces<dim>() + face);
+              const std::array<unsigned int, 4> vertex_order{
+                {ref_cell.standard_to_real_face_vertex(0,
+                                                       face,
+                                                       combined_orientation),
+                 ref_cell.standard_to_real_face_vertex(1,
+                                                       face,
+                                                       combined_orientation),
+                 ref_cell.standard_to_real_face_vertex(2,
+                                                       face,
+                                                       combined_orientation),
+                 ref_cell.standard_to_real_face_vertex(
+                   3, face, combined_orientation)}};
+
+              const unsigned int index = my_index + 4 * (face - 4);
               for (unsigned int i = 0; i < 4; ++i)
-                cache[my_index + i] = raw_vertex_indices[i];
+                cache[index + i] = raw_vertex_indices[vertex_order[i]];
             }
-          else if (ref_cell == ReferenceCells::Line)
-            {
-              cache[my_index + 0] = cell->vertex_index(0);
-              cache[my_index + 1] = cell->vertex_index(1);
-            }
-          else
+        else if (ref_cell == ReferenceCells::Quadrilateral)
+          {
+            const std::array<types::geometric_orientation, 2>
+              line_orientations{
+                {cell->line_orientation(0), cell->line_orientation(1)}};
+            const std::array<unsigned int, 2> line_vertex_indices{
+              {line_orientations[0] == numbers::default_geometric_orientation,
+               line_orientations[1] ==
+                 numbers::default_geometric_orientation}};
+            const std::array<unsigned int, 4> raw_vertex_indices{
+              {cell->line(0)->vertex_index(1 - line_vertex_indices[0]),
+               cell->line(1)->vertex_index(1 - line_vertex_indices[1]),
+               cell->line(0)->vertex_index(line_vertex_indices[0]),
+               cell->line(1)->vertex_index(line_vertex_indices[1])}};
+            for (unsigned int i = 0; i < 4; ++i)
+              cache[my_index + i] = raw_vertex_indices[i];
+          }
+        else if (ref_cell == ReferenceCells::Line)
+          {
+            cache[my_index + 0] = cell->vertex_index(0);
+            cache[my_index + 1] = cell->vertex_index(1);
+          }
+        else
+          {
+            Assert(dim == 2 || dim == 3, ExcInternalError());
+            for (const unsigned int i : cell->vertex_indices())
+              {
+                const auto [face_index, vertex_index] =
+                  ref_cell.standard_vertex_to_face_and_vertex_index(i);
+                const auto vertex_within_face_index =
+                  ref_cell.standard_to_real_face_vertex(
+                    vertex_index,
+                    face_index,
+                    cell->combined_face_orientation(face_index));
+                cache[my_index + i] =
+                  cell->face(face_index)
+                    ->vertex_index(vertex_within_face_index);
+              }
+          }
+      };
+
+      parallel::apply_to_subranges(
+        0U,
+        levels[l]->cells.n_objects(),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int index = begin; index < end; ++index)
             {
-              Assert(dim == 2 || dim == 3, ExcInternalError());
-              for (const unsigned int i : cell->vertex_indices())
-                {
-                  const auto [face_index, vertex_index] =
-                    ref_cell.standard_vertex_to_face_and_vertex_index(i);
-                  const auto vertex_within_face_index =
-                    ref_cell.standard_to_real_face_vertex(
-                      vertex_index,
-                      face_index,
-                      cell->combined_face_orientation(face_index));
-                  cache[my_index + i] =
-                    cell->face(face_index)
-                      ->vertex_index(vertex_within_face_index);
-                }
+              const raw_cell_iterator cell(this, l, index);
+              if (cell->used())
+                fill_cache(cell);
             }
-        }
+        },
+        internal::TriangulationImplementation::cell_loop_grain_size);
     }
 }
 
@@ -18040,6 +18106,60 @@ std::size_t Triangulation<dim, spacedim>::memory_consumption() const
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void Triangulation<dim, spacedim>::print_memory_consumption(
+  std::ostream &out) const
+{
+  std::size_t cell_objects = 0, neighbors = 0, flags = 0, cell_indices = 0,
+              subdomain_ids = 0, orientations = 0, vertex_indices = 0;
+  for (const auto &level : levels)
+    {
+      cell_objects += MemoryConsumption::memory_consumption(level->cells);
+      neighbors += MemoryConsumption::memory_consumption(level->neighbors);
+      flags += MemoryConsumption::memory_consumption(level->refine_flags) +
+               MemoryConsumption::memory_consumption(level->refine_choice) +
+               MemoryConsumption::memory_consumption(level->coarsen_flags) +
+               MemoryConsumption::memory_consumption(level->direction_flags);
+      cell_indices +=
+        MemoryConsumption::memory_consumption(level->active_cell_indices) +
+        MemoryConsumption::memory_consumption(
+          level->global_active_cell_indices) +
+        MemoryConsumption::memory_consumption(
+          level->global_level_cell_indices) +
+        MemoryConsumption::memory_consumption(level->parents);
+      subdomain_ids +=
+        MemoryConsumption::memory_consumption(level->subdomain_ids) +
+        MemoryConsumption::memory_consumption(level->level_subdomain_ids);
+      orientations +=
+        MemoryConsumption::memory_consumption(level->face_orientations) +
+        MemoryConsumption::memory_consumption(level->reference_cell);
+      vertex_indices += MemoryConsumption::memory_consumption(
+        level->cell_vertex_indices_cache);
+    }
+
+  out << "Memory consumption of the triangulation (bytes):" << std::endl;
+  out << "  vertices:                   "
+      << MemoryConsumption::memory_consumption(vertices) +
+           MemoryConsumption::memory_consumption(vertices_used)
+      << std::endl;
+  out << "  cell objects and user data: " << cell_objects << std::endl;
+  out << "  cell neighbors:             " << neighbors << std::endl;
+  out << "  cell flags:                 " << flags << std::endl;
+  out << "  cell indices and parents:   " << cell_indices << std::endl;
+  out << "  cell subdomain ids:         " << subdomain_ids << std::endl;
+  out << "  cell orientations, types:   " << orientations << std::endl;
+  out << "  cell vertex index cache:    " << vertex_indices << std::endl;
+  out << "  faces:                      "
+      << (faces ? MemoryConsumption::memory_consumption(*faces) : 0)
+      << std::endl;
+  out << "  number cache:               "
+      << MemoryConsumption::memory_consumption(number_cache) << std::endl;
+  out << "  total:                      " << memory_consumption() << std::endl;
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 Triangulation<dim, spacedim>::DistortedCellList::~DistortedCellList() noexcept =
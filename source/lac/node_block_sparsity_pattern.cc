@@ -0,0 +1,170 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#include <deal.II/base/memory_consumption.h>
+
+#include <deal.II/lac/node_block_sparsity_pattern.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+NodeBlockSparsityPattern::NodeBlockSparsityPattern()
+  : block_size(1)
+  , compressed(false)
+  , row_starts(1, 0)
+{}
+
+
+
+NodeBlockSparsityPattern::NodeBlockSparsityPattern(
+  const size_type    m,
+  const size_type    n,
+  const unsigned int block_size)
+  : NodeBlockSparsityPattern()
+{
+  reinit(m, n, block_size);
+}
+
+
+
+void
+NodeBlockSparsityPattern::reinit(const size_type    m,
+                                 const size_type    n,
+                                 const unsigned int block_size)
+{
+  Assert(block_size > 0, ExcMessage("The block size must be positive."));
+  AssertThrow(m % block_size == 0, ExcNotMultipleOfBlockSize(m, block_size));
+  AssertThrow(n % block_size == 0, ExcNotMultipleOfBlockSize(n, block_size));
+
+  resize(m, n);
+  this->block_size = block_size;
+  compressed       = false;
+  block_pattern.reinit(m / block_size, n / block_size);
+  row_starts.assign(1, 0);
+  block_columns.clear();
+}
+
+
+
+void
+NodeBlockSparsityPattern::add_row_entries(
+  const size_type                  &row,
+  const ArrayView<const size_type> &columns,
+  const bool                        indices_are_sorted)
+{
+  Assert(!compressed, ExcAlreadyCompressed());
+  AssertIndexRange(row, n_rows());
+
+  // map the columns to block columns, which keeps sorted indices sorted but
+  // introduces duplicates that we remove right away
+  column_buffer.resize(columns.size());
+  for (unsigned int i = 0; i < columns.size(); ++i)
+    {
+      AssertIndexRange(columns[i], n_cols());
+      column_buffer[i] = columns[i] / block_size;
+    }
+  if (!indices_are_sorted)
+    std::sort(column_buffer.begin(), column_buffer.end());
+  column_buffer.erase(std::unique(column_buffer.begin(), column_buffer.end()),
+                      column_buffer.end());
+
+  block_pattern.add_entries(row / block_size,
+                            column_buffer.begin(),
+                            column_buffer.end(),
+                            true);
+}
+
+
+
+void
+NodeBlockSparsityPattern::compress()
+{
+  if (compressed)
+    return;
+
+  const size_type n_block_rows = block_pattern.n_rows();
+  row_starts.resize(n_block_rows + 1);
+  row_starts[0] = 0;
+  for (size_type block_row = 0; block_row < n_block_rows; ++block_row)
+    row_starts[block_row + 1] =
+      row_starts[block_row] + block_pattern.row_length(block_row);
+
+  // the dynamic pattern iterates over the entries of a row in ascending
+  // order of the column index, which we rely on for the search in
+  // block_index()
+  block_columns.resize(row_starts.back());
+  for (size_type block_row = 0; block_row < n_block_rows; ++block_row)
+    {
+      std::size_t index = row_starts[block_row];
+      for (auto entry = block_pattern.begin(block_row);
+           entry != block_pattern.end(block_row);
+           ++entry, ++index)
+        block_columns[index] = entry->column();
+    }
+
+  block_pattern.reinit(0, 0);
+  column_buffer.clear();
+  column_buffer.shrink_to_fit();
+  compressed = true;
+}
+
+
+
+NodeBlockSparsityPattern::size_type
+NodeBlockSparsityPattern::block_index(const size_type block_row,
+                                      const size_type block_col) const
+{
+  Assert(compressed, ExcNotCompressed());
+  AssertIndexRange(block_row, n_block_rows());
+  AssertIndexRange(block_col, n_block_cols());
+
+  const auto begin = block_columns.begin() + row_starts[block_row];
+  const auto end   = block_columns.begin() + row_starts[block_row + 1];
+  const auto entry = std::lower_bound(begin, end, block_col);
+  if (entry != end && *entry == block_col)
+    return entry - block_columns.begin();
+  else
+    return numbers::invalid_size_type;
+}
+
+
+
+bool
+NodeBlockSparsityPattern::exists(const size_type i, const size_type j) const
+{
+  AssertIndexRange(i, n_rows());
+  AssertIndexRange(j, n_cols());
+  if (compressed)
+    return block_index(i / block_size, j / block_size) !=
+           numbers::invalid_size_type;
+  else
+    return block_pattern.exists(i / block_size, j / block_size);
+}
+
+
+
+std::size_t
+NodeBlockSparsityPattern::memory_consumption() const
+{
+  return sizeof(*this) + block_pattern.memory_consumption() -
+         sizeof(block_pattern) +
+         MemoryConsumption::memory_consumption(row_starts) +
+         MemoryConsumption::memory_consumption(block_columns) +
+         MemoryConsumption::memory_consumption(column_buffer);
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,276 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <typename Number>
+SlicedEllpackMatrix<Number>::SlicedEllpackMatrix()
+  : n_rows(0)
+  , n_cols(0)
+  , n_nonzeros(0)
+  , chunk_starts(1, 0)
+{}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::reinit(const SparsityPattern &sparsity,
+                                    const unsigned int     sigma)
+{
+  Assert(sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+  AssertThrow(sparsity.n_rows() < numbers::invalid_unsigned_int &&
+                sparsity.n_cols() < numbers::invalid_unsigned_int,
+              ExcMessage("SlicedEllpackMatrix stores row and column indices "
+                         "as 32-bit integers."));
+
+  n_rows     = sparsity.n_rows();
+  n_cols     = sparsity.n_cols();
+  n_nonzeros = sparsity.n_nonzero_elements();
+
+  const unsigned int n_chunks = (n_rows + chunk_size - 1) / chunk_size;
+
+  // sort the rows by descending length within windows of sigma rows, keeping
+  // the original order for rows of the same length
+  sorted_rows.resize(n_chunks * chunk_size);
+  for (unsigned int i = 0; i < sorted_rows.size(); ++i)
+    sorted_rows[i] = (i < n_rows) ? i : numbers::invalid_unsigned_int;
+
+  const unsigned int window =
+    (sigma <= 1) ? 1 : (sigma + chunk_size - 1) / chunk_size * chunk_size;
+  if (window > 1)
+    for (unsigned int start = 0; start < n_rows; start += window)
+      std::stable_sort(sorted_rows.begin() + start,
+                       sorted_rows.begin() +
+                         std::min<size_type>(start + window, n_rows),
+                       [&sparsity](const unsigned int a, const unsigned int b) {
+                         return sparsity.row_length(a) >
+                                sparsity.row_length(b);
+                       });
+
+  row_positions.resize(n_rows);
+  row_lengths.assign(n_chunks * chunk_size, 0);
+  for (unsigned int position = 0; position < n_rows; ++position)
+    {
+      const unsigned int row = sorted_rows[position];
+      row_positions[row]     = position;
+      row_lengths[position]  = sparsity.row_length(row);
+    }
+
+  // the width of each chunk is given by its longest row
+  chunk_starts.resize(n_chunks + 1);
+  chunk_starts[0] = 0;
+  for (unsigned int c = 0; c < n_chunks; ++c)
+    {
+      const unsigned int width =
+        *std::max_element(row_lengths.begin() + c * chunk_size,
+                          row_lengths.begin() + (c + 1) * chunk_size);
+      chunk_starts[c + 1] =
+        chunk_starts[c] + static_cast<std::size_t>(width) * chunk_size;
+    }
+
+  // fill the column indices in the same order as the entries of the rows in
+  // SparseMatrix. Padded entries repeat the last valid column of the row such
+  // that the access to the source vector stays within cache lines already
+  // loaded
+  values.clear();
+  values.resize(chunk_starts.back());
+  column_indices.resize(chunk_starts.back());
+  for (unsigned int c = 0; c < n_chunks; ++c)
+    {
+      const unsigned int width =
+        (chunk_starts[c + 1] - chunk_starts[c]) / chunk_size;
+      for (unsigned int lane = 0; lane < chunk_size; ++lane)
+        {
+          const unsigned int position = c * chunk_size + lane;
+          unsigned int      *indices  =
+            column_indices.data() + chunk_starts[c] + lane;
+
+          unsigned int index = 0, last_column = 0;
+          if (position < n_rows)
+            for (auto entry = sparsity.begin(sorted_rows[position]);
+                 entry != sparsity.end(sorted_rows[position]);
+                 ++entry, ++index)
+              {
+                last_column                 = entry->column();
+                indices[index * chunk_size] = last_column;
+              }
+          for (; index < width; ++index)
+            indices[index * chunk_size] = last_column;
+        }
+    }
+
+  diagonal.clear();
+  diagonal.resize(n_rows);
+}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::clear()
+{
+  n_rows     = 0;
+  n_cols     = 0;
+  n_nonzeros = 0;
+  chunk_starts.resize(1);
+  chunk_starts[0] = 0;
+  values.clear();
+  column_indices.clear();
+  sorted_rows.clear();
+  row_positions.clear();
+  row_lengths.clear();
+  diagonal.clear();
+}
+
+
+
+template <typename Number>
+Number
+SlicedEllpackMatrix<Number>::el(const size_type i, const size_type j) const
+{
+  AssertIndexRange(i, n_rows);
+  AssertIndexRange(j, n_cols);
+
+  const unsigned int position = row_positions[i];
+  const std::size_t  start =
+    chunk_starts[position / chunk_size] + position % chunk_size;
+  for (unsigned int index = 0; index < row_lengths[position]; ++index)
+    if (column_indices[start + index * chunk_size] == j)
+      return values[start + index * chunk_size];
+
+  return Number();
+}
+
+
+
+template <typename Number>
+std::size_t
+SlicedEllpackMatrix<Number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(chunk_starts) +
+         MemoryConsumption::memory_consumption(values) +
+         MemoryConsumption::memory_consumption(column_indices) +
+         MemoryConsumption::memory_consumption(sorted_rows) +
+         MemoryConsumption::memory_consumption(row_positions) +
+         MemoryConsumption::memory_consumption(row_lengths) +
+         MemoryConsumption::memory_consumption(diagonal);
+}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::vmult_on_chunks(const unsigned int begin_chunk,
+                                             const unsigned int end_chunk,
+                                             const Number      *src,
+                                             Number            *dst,
+                                             const bool         add) const
+{
+  for (unsigned int c = begin_chunk; c < end_chunk; ++c)
+    {
+      VectorizedArray<Number> sum = Number();
+      for (std::size_t k = chunk_starts[c]; k < chunk_starts[c + 1];
+           k += chunk_size)
+        {
+          VectorizedArray<Number> matrix_entries, vector_entries;
+          matrix_entries.load(values.data() + k);
+          vector_entries.gather(src, column_indices.data() + k);
+          sum += matrix_entries * vector_entries;
+        }
+
+      const unsigned int *rows = sorted_rows.data() + c * chunk_size;
+      if ((c + 1) * chunk_size <= n_rows)
+        {
+          if (add)
+            {
+              VectorizedArray<Number> old_values;
+              old_values.gather(dst, rows);
+              sum += old_values;
+            }
+          sum.scatter(rows, dst);
+        }
+      else
+        {
+          // the last chunk is only partially filled
+          for (unsigned int lane = 0; lane < chunk_size; ++lane)
+            if (rows[lane] != numbers::invalid_unsigned_int)
+              {
+                if (add)
+                  dst[rows[lane]] += sum[lane];
+                else
+                  dst[rows[lane]] = sum[lane];
+              }
+        }
+    }
+}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::do_vmult(const Number *src,
+                                      Number       *dst,
+                                      const bool    add) const
+{
+  const unsigned int n_chunks = chunk_starts.size() - 1;
+  parallel::apply_to_subranges(
+    0U,
+    n_chunks,
+    [&](const unsigned int begin_chunk, const unsigned int end_chunk) {
+      vmult_on_chunks(begin_chunk, end_chunk, src, dst, add);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        chunk_size +
+      1);
+}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::do_Tvmult(const Number *src,
+                                       Number       *dst,
+                                       const bool    add) const
+{
+  if (!add)
+    std::fill(dst, dst + n_cols, Number());
+
+  for (unsigned int position = 0; position < n_rows; ++position)
+    {
+      const std::size_t start =
+        chunk_starts[position / chunk_size] + position % chunk_size;
+      const Number src_value = src[sorted_rows[position]];
+      for (unsigned int index = 0; index < row_lengths[position]; ++index)
+        dst[column_indices[start + index * chunk_size]] +=
+          values[start + index * chunk_size] * src_value;
+    }
+}
+
+
+
+// explicit instantiations
+template class SlicedEllpackMatrix<float>;
+template class SlicedEllpackMatrix<double>;
+
+DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,932 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/thread_local_storage.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/householder.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_amg.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <algorithm>
+#include <cmath>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace SparseAMGImplementation
+  {
+    using size_type = types::global_dof_index;
+
+    /**
+     * The rows of a sparse matrix under construction, each holding pairs of
+     * column index and value sorted by the column index.
+     */
+    using MatrixRows = std::vector<std::vector<std::pair<size_type, double>>>;
+
+    /**
+     * The number of rows that are worked on by one task in the loops over
+     * the rows of a matrix.
+     */
+    constexpr unsigned int row_grain_size = 256;
+
+    /**
+     * A matrix together with the sparsity pattern it is based on, such that
+     * both can be owned by a single std::shared_ptr.
+     */
+    struct MatrixWithSparsityPattern
+    {
+      SparsityPattern      sparsity_pattern;
+      SparseMatrix<double> matrix;
+    };
+
+
+
+    /**
+     * Create a matrix with @p n_columns columns from the given rows.
+     */
+    std::shared_ptr<const SparseMatrix<double>>
+    create_matrix(const size_type n_columns, const MatrixRows &rows)
+    {
+      const auto data = std::make_shared<MatrixWithSparsityPattern>();
+      data->sparsity_pattern.copy_from(rows.size(),
+                                       n_columns,
+                                       rows.begin(),
+                                       rows.end());
+      data->matrix.reinit(data->sparsity_pattern);
+      data->matrix.copy_from(rows.begin(), rows.end());
+
+      return std::shared_ptr<const SparseMatrix<double>>(data, &data->matrix);
+    }
+
+
+
+    /**
+     * Compute the product of the two matrices @p A and @p B, in parallel over
+     * the rows of @p A. Each thread accumulates the entries of a row in a
+     * dense array of the size of the number of columns of @p B.
+     */
+    MatrixRows
+    multiply(const SparseMatrix<double> &A, const SparseMatrix<double> &B)
+    {
+      AssertDimension(A.n(), B.m());
+
+      struct Scratch
+      {
+        std::vector<double>    values;
+        std::vector<size_type> last_row;
+        std::vector<size_type> columns;
+      };
+      Threads::ThreadLocalStorage<Scratch> scratch;
+
+      MatrixRows result(A.m());
+      dealii::parallel::apply_to_subranges(
+        0,
+        A.m(),
+        [&](const size_type begin, const size_type end) {
+          Scratch &data = scratch.get();
+          if (data.values.size() != B.n())
+            {
+              data.values.resize(B.n());
+              data.last_row.assign(B.n(), numbers::invalid_dof_index);
+            }
+
+          for (size_type row = begin; row < end; ++row)
+            {
+              data.columns.clear();
+              for (auto a = A.begin(row); a != A.end(row); ++a)
+                for (auto b = B.begin(a->column()); b != B.end(a->column());
+                     ++b)
+                  {
+                    const size_type column = b->column();
+                    if (data.last_row[column] != row)
+                      {
+                        data.last_row[column] = row;
+                        data.values[column]   = 0.;
+                        data.columns.push_back(column);
+                      }
+                    data.values[column] += a->value() * b->value();
+                  }
+
+              std::sort(data.columns.begin(), data.columns.end());
+              result[row].reserve(data.columns.size());
+              for (const size_type column : data.columns)
+                result[row].emplace_back(column, data.values[column]);
+            }
+        },
+        row_grain_size);
+
+      return result;
+    }
+
+
+
+    /**
+     * Compute the transpose of the matrix @p A.
+     */
+    MatrixRows
+    transpose(const SparseMatrix<double> &A)
+    {
+      std::vector<unsigned int> row_lengths(A.n());
+      for (auto entry = A.begin(); entry != A.end(); ++entry)
+        ++row_lengths[entry->column()];
+
+      MatrixRows result(A.n());
+      for (size_type i = 0; i < A.n(); ++i)
+        result[i].reserve(row_lengths[i]);
+
+      // the loop runs over the rows of A in ascending order, so the entries
+      // of the rows of the transpose are sorted by column index
+      for (auto entry = A.begin(); entry != A.end(); ++entry)
+        result[entry->column()].emplace_back(entry->row(), entry->value());
+
+      return result;
+    }
+
+
+
+    /**
+     * The strong connections of the unknowns of a matrix in compressed row
+     * storage, not including the diagonal.
+     */
+    struct StrengthGraph
+    {
+      std::vector<size_type> row_starts;
+      std::vector<size_type> columns;
+      std::vector<double>    strengths;
+    };
+
+
+
+    /**
+     * Set up the graph of strong connections of @p A, given the diagonal of
+     * @p A, see the documentation of the SparseAMG class.
+     */
+    StrengthGraph
+    compute_strength_graph(const SparseMatrix<double> &A,
+                           const std::vector<double>  &diagonal,
+                           const double                threshold)
+    {
+      const size_type n = A.m();
+
+      const auto strength =
+        [&](const size_type i, const size_type j, const double value) {
+          const double scaling =
+            std::sqrt(std::abs(diagonal[i] * diagonal[j]));
+          return (scaling > 0.) ? std::abs(value) / scaling : 0.;
+        };
+
+      StrengthGraph graph;
+      graph.row_starts.resize(n + 1);
+      graph.row_starts[0] = 0;
+      dealii::parallel::apply_to_subranges(
+        0,
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            {
+              size_type count = 0;
+              for (auto entry = A.begin(i); entry != A.end(i); ++entry)
+                if (entry->column() != i &&
+                    strength(i, entry->column(), entry->value()) > threshold)
+                  ++count;
+              graph.row_starts[i + 1] = count;
+            }
+        },
+        row_grain_size);
+
+      for (size_type i = 0; i < n; ++i)
+        graph.row_starts[i + 1] += graph.row_starts[i];
+
+      graph.columns.resize(graph.row_starts[n]);
+      graph.strengths.resize(graph.row_starts[n]);
+      dealii::parallel::apply_to_subranges(
+        0,
+        n,
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            {
+              size_type index = graph.row_starts[i];
+              for (auto entry = A.begin(i); entry != A.end(i); ++entry)
+                {
+                  const double value =
+                    strength(i, entry->column(), entry->value());
+                  if (entry->column() != i && value > threshold)
+                    {
+                      graph.columns[index]   = entry->column();
+                      graph.strengths[index] = value;
+                      ++index;
+                    }
+                }
+            }
+        },
+        row_grain_size);
+
+      return graph;
+    }
+
+
+
+    /**
+     * Aggregate the unknowns in the range [begin, end) by a greedy algorithm
+     * that only takes into account the strong connections within the range.
+     * The aggregates are numbered from zero, and the number of aggregates is
+     * returned. Unknowns without any strong connection are left with an
+     * invalid aggregate index.
+     */
+    size_type
+    aggregate_chunk(const StrengthGraph    &graph,
+                    const size_type         begin,
+                    const size_type         end,
+                    std::vector<size_type> &aggregate_index)
+    {
+      const size_type invalid      = numbers::invalid_dof_index;
+      size_type       n_aggregates = 0;
+
+      const auto in_chunk = [&](const size_type j) {
+        return j >= begin && j < end;
+      };
+      const auto is_connected = [&](const size_type i) {
+        return graph.row_starts[i + 1] > graph.row_starts[i];
+      };
+
+      // phase 1: unknowns whose strong neighbors are all free form a new
+      // aggregate together with their neighbors
+      for (size_type i = begin; i < end; ++i)
+        {
+          if (aggregate_index[i] != invalid || !is_connected(i))
+            continue;
+
+          bool all_free = true;
+          for (size_type k = graph.row_starts[i]; k < graph.row_starts[i + 1];
+               ++k)
+            if (in_chunk(graph.columns[k]) &&
+                aggregate_index[graph.columns[k]] != invalid)
+              {
+                all_free = false;
+                break;
+              }
+          if (!all_free)
+            continue;
+
+          aggregate_index[i] = n_aggregates;
+          for (size_type k = graph.row_starts[i]; k < graph.row_starts[i + 1];
+               ++k)
+            if (in_chunk(graph.columns[k]))
+              aggregate_index[graph.columns[k]] = n_aggregates;
+          ++n_aggregates;
+        }
+
+      // phase 2: the remaining unknowns join the aggregate of phase 1 they
+      // are most strongly connected to. We look up the aggregates from a copy
+      // such that the result does not depend on the order of the unknowns
+      const std::vector<size_type> phase_1_aggregates(aggregate_index.begin() +
+                                                        begin,
+                                                      aggregate_index.begin() +
+                                                        end);
+      for (size_type i = begin; i < end; ++i)
+        {
+          if (aggregate_index[i] != invalid)
+            continue;
+
+          double max_strength = 0.;
+          for (size_type k = graph.row_starts[i]; k < graph.row_starts[i + 1];
+               ++k)
+            {
+              const size_type j = graph.columns[k];
+              if (in_chunk(j) && phase_1_aggregates[j - begin] != invalid &&
+                  graph.strengths[k] > max_strength)
+                {
+                  max_strength       = graph.strengths[k];
+                  aggregate_index[i] = phase_1_aggregates[j - begin];
+                }
+            }
+        }
+
+      // phase 3: unknowns without an aggregated neighbor form new aggregates
+      // with their free neighbors
+      for (size_type i = begin; i < end; ++i)
+        {
+          if (aggregate_index[i] != invalid || !is_connected(i))
+            continue;
+
+          aggregate_index[i] = n_aggregates;
+          for (size_type k = graph.row_starts[i]; k < graph.row_starts[i + 1];
+               ++k)
+            if (in_chunk(graph.columns[k]) &&
+                aggregate_index[graph.columns[k]] == invalid)
+              aggregate_index[graph.columns[k]] = n_aggregates;
+          ++n_aggregates;
+        }
+
+      return n_aggregates;
+    }
+
+
+
+    /**
+     * Aggregate the unknowns described by the strength graph, working on
+     * chunks of @p chunk_size unknowns in parallel. On return,
+     * @p aggregate_index contains the global index of the aggregate of each
+     * unknown, and @p aggregate_sizes the number of unknowns in each
+     * aggregate.
+     */
+    void
+    aggregate(const StrengthGraph       &graph,
+              const unsigned int         chunk_size,
+              std::vector<size_type>    &aggregate_index,
+              std::vector<unsigned int> &aggregate_sizes)
+    {
+      const size_type n        = graph.row_starts.size() - 1;
+      const size_type n_chunks = (n + chunk_size - 1) / chunk_size;
+
+      aggregate_index.assign(n, numbers::invalid_dof_index);
+      std::vector<size_type> aggregate_offsets(n_chunks + 1, 0);
+      dealii::parallel::apply_to_subranges(
+        0,
+        n_chunks,
+        [&](const size_type chunk_begin, const size_type chunk_end) {
+          for (size_type c = chunk_begin; c < chunk_end; ++c)
+            aggregate_offsets[c + 1] =
+              aggregate_chunk(graph,
+                              c * chunk_size,
+                              std::min<size_type>((c + 1) * chunk_size, n),
+                              aggregate_index);
+        },
+        1);
+
+      for (size_type c = 0; c < n_chunks; ++c)
+        aggregate_offsets[c + 1] += aggregate_offsets[c];
+
+      // translate to global aggregate indices. Aggregates do not extend
+      // across chunks, so the tasks count the sizes of disjoint sets of
+      // aggregates
+      aggregate_sizes.assign(aggregate_offsets[n_chunks], 0);
+      dealii::parallel::apply_to_subranges(
+        0,
+        n_chunks,
+        [&](const size_type chunk_begin, const size_type chunk_end) {
+          for (size_type c = chunk_begin; c < chunk_end; ++c)
+            for (size_type i = c * chunk_size;
+                 i < std::min<size_type>((c + 1) * chunk_size, n);
+                 ++i)
+              if (aggregate_index[i] != numbers::invalid_dof_index)
+                {
+                  aggregate_index[i] += aggregate_offsets[c];
+                  ++aggregate_sizes[aggregate_index[i]];
+                }
+        },
+        1);
+    }
+
+
+
+    /**
+     * Set up the smoothed prolongator $P = (I - \omega D^{-1}A)
+     * P_\text{tent}$, where the tentative prolongator is normalized such
+     * that its columns have unit length.
+     */
+    std::shared_ptr<const SparseMatrix<double>>
+    compute_prolongation(const SparseMatrix<double>      &A,
+                         const std::vector<double>       &diagonal,
+                         const std::vector<size_type>    &aggregate_index,
+                         const std::vector<unsigned int> &aggregate_sizes,
+                         const double                     omega)
+    {
+      MatrixRows rows(A.m());
+      dealii::parallel::apply_to_subranges(
+        0,
+        A.m(),
+        [&](const size_type begin, const size_type end) {
+          std::vector<std::pair<size_type, double>> entries;
+          for (size_type i = begin; i < end; ++i)
+            {
+              entries.clear();
+              const double scaling =
+                (diagonal[i] != 0.) ? omega / diagonal[i] : 0.;
+              for (auto entry = A.begin(i); entry != A.end(i); ++entry)
+                {
+                  const size_type j = entry->column();
+                  if (aggregate_index[j] == numbers::invalid_dof_index)
+                    continue;
+
+                  const double tentative =
+                    1. / std::sqrt(aggregate_sizes[aggregate_index[j]]);
+                  entries.emplace_back(aggregate_index[j],
+                                       ((i == j) ? tentative : 0.) -
+                                         scaling * entry->value() * tentative);
+                }
+
+              // merge the contributions to the same aggregate
+              std::sort(entries.begin(), entries.end());
+              for (const auto &entry : entries)
+                if (!rows[i].empty() && rows[i].back().first == entry.first)
+                  rows[i].back().second += entry.second;
+                else
+                  rows[i].push_back(entry);
+            }
+        },
+        row_grain_size);
+
+      return create_matrix(aggregate_sizes.size(), rows);
+    }
+
+
+
+    /**
+     * Estimate the largest eigenvalue of $D^{-1}A$ with a few iterations of
+     * the conjugate gradient method, as done by PreconditionChebyshev.
+     */
+    double
+    estimate_max_eigenvalue(
+      const SparseMatrix<double> &A,
+      const std::shared_ptr<dealii::DiagonalMatrix<Vector<double>>>
+        &inverse_diagonal)
+    {
+      using ChebyshevType =
+        PreconditionChebyshev<SparseMatrix<double>,
+                              Vector<double>,
+                              dealii::DiagonalMatrix<Vector<double>>>;
+      ChebyshevType::AdditionalData data;
+      data.preconditioner      = inverse_diagonal;
+      data.eig_cg_n_iterations = 10;
+
+      ChebyshevType chebyshev;
+      chebyshev.initialize(A, data);
+      Vector<double> vector(A.m());
+      return chebyshev.estimate_eigenvalues(vector).max_eigenvalue_estimate;
+    }
+
+
+
+    /**
+     * The coarse grid solver of SparseAMG. It inverts the matrix on the
+     * coarsest level by a direct method if that matrix has no more than
+     * AdditionalData::max_coarse_size rows, and applies the smoother
+     * otherwise.
+     */
+    class CoarseGridSolver : public MGCoarseGridBase<Vector<double>>
+    {
+    public:
+      CoarseGridSolver(const SparseMatrix<double>           &matrix,
+                       const unsigned int                    max_coarse_size,
+                       const MGSmootherBase<Vector<double>> &smoother)
+        : use_direct_solver(matrix.m() <= max_coarse_size)
+        , smoother(&smoother)
+      {
+        if (!use_direct_solver)
+          return;
+
+        FullMatrix<double> full_matrix(matrix.m(), matrix.n());
+        full_matrix.copy_from(matrix);
+#ifdef DEAL_II_WITH_LAPACK
+        // treat tiny singular values as zero to also support singular
+        // matrices, like the ones from Laplace problems with pure Neumann
+        // boundary conditions
+        inverse.reinit(full_matrix.m(), full_matrix.n());
+        inverse = full_matrix;
+        inverse.compute_inverse_svd(1e-12);
+#else
+        householder.initialize(full_matrix);
+#endif
+      }
+
+      virtual void
+      operator()(const unsigned int    level,
+                 Vector<double>       &dst,
+                 const Vector<double> &src) const override
+      {
+        if (!use_direct_solver)
+          smoother->apply(level, dst, src);
+        else
+#ifdef DEAL_II_WITH_LAPACK
+          inverse.vmult(dst, src);
+#else
+          householder.least_squares(dst, src);
+#endif
+      }
+
+    private:
+      const bool use_direct_solver;
+
+      const MGSmootherBase<Vector<double>> *smoother;
+
+#ifdef DEAL_II_WITH_LAPACK
+      LAPACKFullMatrix<double> inverse;
+#else
+      Householder<double> householder;
+#endif
+    };
+  } // namespace SparseAMGImplementation
+} // namespace internal
+
+
+
+void
+MGTransferSparseAMG::initialize(
+  const MGLevelObject<std::shared_ptr<const SparseMatrix<double>>>
+    &prolongation_matrices)
+{
+  const unsigned int min_level = prolongation_matrices.min_level();
+  const unsigned int max_level = prolongation_matrices.max_level();
+
+  this->prolongation_matrices.resize(min_level, max_level);
+  restriction_matrices.resize(min_level, max_level);
+  level_sizes.resize(min_level, max_level);
+  for (unsigned int level = min_level + 1; level <= max_level; ++level)
+    {
+      const SparseMatrix<double> &prolongation = *prolongation_matrices[level];
+      this->prolongation_matrices[level] = prolongation_matrices[level];
+      restriction_matrices[level] = internal::SparseAMGImplementation::
+        create_matrix(prolongation.m(),
+                      internal::SparseAMGImplementation::transpose(
+                        prolongation));
+      level_sizes[level]     = prolongation.m();
+      level_sizes[level - 1] = prolongation.n();
+    }
+}
+
+
+
+void
+MGTransferSparseAMG::clear()
+{
+  level_sizes.resize(0, 0);
+  prolongation_matrices.resize(0, 0);
+  restriction_matrices.resize(0, 0);
+}
+
+
+
+void
+MGTransferSparseAMG::prolongate(const unsigned int    to_level,
+                                Vector<double>       &dst,
+                                const Vector<double> &src) const
+{
+  Assert(to_level > prolongation_matrices.min_level() &&
+           to_level <= prolongation_matrices.max_level(),
+         ExcIndexRange(to_level,
+                       prolongation_matrices.min_level() + 1,
+                       prolongation_matrices.max_level() + 1));
+  prolongation_matrices[to_level]->vmult(dst, src);
+}
+
+
+
+void
+MGTransferSparseAMG::prolongate_and_add(const unsigned int    to_level,
+                                        Vector<double>       &dst,
+                                        const Vector<double> &src) const
+{
+  Assert(to_level > prolongation_matrices.min_level() &&
+           to_level <= prolongation_matrices.max_level(),
+         ExcIndexRange(to_level,
+                       prolongation_matrices.min_level() + 1,
+                       prolongation_matrices.max_level() + 1));
+  prolongation_matrices[to_level]->vmult_add(dst, src);
+}
+
+
+
+void
+MGTransferSparseAMG::restrict_and_add(const unsigned int    from_level,
+                                      Vector<double>       &dst,
+                                      const Vector<double> &src) const
+{
+  Assert(from_level > restriction_matrices.min_level() &&
+           from_level <= restriction_matrices.max_level(),
+         ExcIndexRange(from_level,
+                       restriction_matrices.min_level() + 1,
+                       restriction_matrices.max_level() + 1));
+  restriction_matrices[from_level]->vmult_add(dst, src);
+}
+
+
+
+void
+MGTransferSparseAMG::copy_to_mg(MGLevelObject<Vector<double>> &dst,
+                                const Vector<double>          &src) const
+{
+  AssertDimension(src.size(), level_sizes[level_sizes.max_level()]);
+
+  dst.resize(level_sizes.min_level(), level_sizes.max_level());
+  for (unsigned int level = dst.min_level(); level < dst.max_level(); ++level)
+    dst[level].reinit(level_sizes[level]);
+  dst[dst.max_level()] = src;
+}
+
+
+
+std::size_t
+MGTransferSparseAMG::memory_consumption() const
+{
+  std::size_t memory = level_sizes.n_levels() * sizeof(size_type);
+  for (unsigned int level = prolongation_matrices.min_level() + 1;
+       level <= prolongation_matrices.max_level();
+       ++level)
+    memory += prolongation_matrices[level]->memory_consumption() +
+              prolongation_matrices[level]
+                ->get_sparsity_pattern()
+                .memory_consumption() +
+              restriction_matrices[level]->memory_consumption() +
+              restriction_matrices[level]
+                ->get_sparsity_pattern()
+                .memory_consumption();
+  return memory;
+}
+
+
+
+SparseAMG::AdditionalData::AdditionalData(
+  const double       aggregation_threshold,
+  const SmootherType smoother_type,
+  const unsigned int smoother_sweeps,
+  const double       smoothing_range,
+  const bool         w_cycle,
+  const unsigned int max_coarse_size,
+  const unsigned int max_levels,
+  const unsigned int aggregation_chunk_size)
+  : aggregation_threshold(aggregation_threshold)
+  , smoother_type(smoother_type)
+  , smoother_sweeps(smoother_sweeps)
+  , smoothing_range(smoothing_range)
+  , w_cycle(w_cycle)
+  , max_coarse_size(max_coarse_size)
+  , max_levels(max_levels)
+  , aggregation_chunk_size(aggregation_chunk_size)
+{}
+
+
+
+SparseAMG::SparseAMG() = default;
+
+
+
+SparseAMG::~SparseAMG() = default;
+
+
+
+void
+SparseAMG::initialize(const SparseMatrix<double> &matrix,
+                      const AdditionalData       &additional_data)
+{
+  using namespace internal::SparseAMGImplementation;
+
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+  Assert(additional_data.max_levels > 0,
+         ExcMessage("The hierarchy needs at least one level."));
+  Assert(additional_data.smoother_sweeps > 0,
+         ExcMessage("The smoother needs to perform at least one sweep."));
+  Assert(additional_data.aggregation_chunk_size > 0,
+         ExcMessage("The chunk size for aggregation must be positive."));
+
+  clear();
+
+  // the matrix on the finest level is owned by the user, so do not delete it
+  std::vector<std::shared_ptr<const SparseMatrix<double>>> matrices(
+    1,
+    std::shared_ptr<const SparseMatrix<double>>(
+      std::shared_ptr<const SparseMatrix<double>>(), &matrix));
+  std::vector<std::shared_ptr<const SparseMatrix<double>>> prolongations(1);
+  std::vector<std::shared_ptr<DiagonalMatrix<Vector<double>>>>
+                      inverse_diagonals;
+  std::vector<double> max_eigenvalues;
+
+  // build the hierarchy from the finest to the coarsest level
+  while (true)
+    {
+      const SparseMatrix<double> &A = *matrices.back();
+
+      std::vector<double> diagonal(A.m());
+      inverse_diagonals.push_back(
+        std::make_shared<DiagonalMatrix<Vector<double>>>());
+      Vector<double> &inverse_diagonal = inverse_diagonals.back()->get_vector();
+      inverse_diagonal.reinit(A.m());
+      parallel::apply_to_subranges(
+        0,
+        A.m(),
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            {
+              diagonal[i]         = A.diag_element(i);
+              inverse_diagonal[i] = (diagonal[i] != 0.) ? 1. / diagonal[i] : 1.;
+            }
+        },
+        row_grain_size);
+
+      max_eigenvalues.push_back(
+        estimate_max_eigenvalue(A, inverse_diagonals.back()));
+
+      if (A.m() <= additional_data.max_coarse_size ||
+          matrices.size() >= additional_data.max_levels)
+        break;
+
+      const StrengthGraph graph =
+        compute_strength_graph(A,
+                               diagonal,
+                               additional_data.aggregation_threshold);
+
+      std::vector<size_type>    aggregate_index;
+      std::vector<unsigned int> aggregate_sizes;
+      aggregate(graph,
+                additional_data.aggregation_chunk_size,
+                aggregate_index,
+                aggregate_sizes);
+      if (aggregate_sizes.empty() || aggregate_sizes.size() >= A.m())
+        break;
+
+      const std::shared_ptr<const SparseMatrix<double>> prolongation =
+        compute_prolongation(A,
+                             diagonal,
+                             aggregate_index,
+                             aggregate_sizes,
+                             4. / (3. * max_eigenvalues.back()));
+
+      const std::shared_ptr<const SparseMatrix<double>> AP =
+        create_matrix(prolongation->n(), multiply(A, *prolongation));
+      const std::shared_ptr<const SparseMatrix<double>> R =
+        create_matrix(prolongation->m(), transpose(*prolongation));
+      matrices.push_back(create_matrix(prolongation->n(), multiply(*R, *AP)));
+      prolongations.push_back(prolongation);
+    }
+
+  // store the levels in the order used by the Multigrid class, with the
+  // coarsest level as level zero
+  const unsigned int max_level = matrices.size() - 1;
+  level_matrices.resize(0, max_level);
+  MGLevelObject<std::shared_ptr<const SparseMatrix<double>>>
+    prolongation_matrices(0, max_level);
+  for (unsigned int level = 0; level <= max_level; ++level)
+    {
+      level_matrices[level] = matrices[max_level - level];
+      // prolongations[i] maps from matrices[i] to the finer matrices[i-1]
+      if (level > 0)
+        prolongation_matrices[level] = prolongations[max_level - level + 1];
+    }
+  transfer.initialize(prolongation_matrices);
+
+  mg_matrix =
+    std::make_unique<mg::Matrix<Vector<double>>>(level_matrices);
+
+  // set up the smoothers with the eigenvalue estimates computed above
+  if (additional_data.smoother_type == SmootherType::chebyshev)
+    {
+      using ChebyshevType =
+        PreconditionChebyshev<SparseMatrix<double>,
+                              Vector<double>,
+                              DiagonalMatrix<Vector<double>>>;
+      MGLevelObject<ChebyshevType::AdditionalData> smoother_data(0, max_level);
+      for (unsigned int level = 0; level <= max_level; ++level)
+        {
+          smoother_data[level].preconditioner =
+            inverse_diagonals[max_level - level];
+          smoother_data[level].degree = additional_data.smoother_sweeps;
+          smoother_data[level].smoothing_range =
+            additional_data.smoothing_range;
+          smoother_data[level].max_eigenvalue =
+            max_eigenvalues[max_level - level];
+          smoother_data[level].eig_cg_n_iterations = 0;
+        }
+
+      auto smoother = std::make_unique<
+        MGSmootherPrecondition<SparseMatrix<double>,
+                               ChebyshevType,
+                               Vector<double>>>();
+      smoother->initialize(level_matrices, smoother_data);
+      mg_smoother = std::move(smoother);
+    }
+  else
+    {
+      using JacobiType = PreconditionJacobi<SparseMatrix<double>>;
+      MGLevelObject<JacobiType::AdditionalData> smoother_data(0, max_level);
+      for (unsigned int level = 0; level <= max_level; ++level)
+        {
+          smoother_data[level].relaxation =
+            4. / (3. * max_eigenvalues[max_level - level]);
+          smoother_data[level].n_iterations = additional_data.smoother_sweeps;
+        }
+
+      auto smoother = std::make_unique<
+        MGSmootherPrecondition<SparseMatrix<double>,
+                               JacobiType,
+                               Vector<double>>>();
+      smoother->initialize(level_matrices, smoother_data);
+      mg_smoother = std::move(smoother);
+    }
+
+  // invert the matrix on the coarsest level, unless the coarsening stopped
+  // early with a large matrix
+  mg_coarse =
+    std::make_unique<internal::SparseAMGImplementation::CoarseGridSolver>(
+      *level_matrices[0], additional_data.max_coarse_size, *mg_smoother);
+
+  multigrid = std::make_unique<Multigrid<Vector<double>>>(
+    *mg_matrix,
+    *mg_coarse,
+    transfer,
+    *mg_smoother,
+    *mg_smoother,
+    0,
+    max_level,
+    additional_data.w_cycle ? Multigrid<Vector<double>>::w_cycle :
+                              Multigrid<Vector<double>>::v_cycle);
+}
+
+
+
+void
+SparseAMG::clear()
+{
+  multigrid.reset();
+  mg_coarse.reset();
+  mg_smoother.reset();
+  mg_matrix.reset();
+  transfer.clear();
+  level_matrices.resize(0, 0);
+}
+
+
+
+void
+SparseAMG::vmult(Vector<double> &dst, const Vector<double> &src) const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+
+  transfer.copy_to_mg(multigrid->defect, src);
+  multigrid->cycle();
+  dst = multigrid->solution[multigrid->solution.max_level()];
+}
+
+
+
+SparseAMG::size_type
+SparseAMG::m() const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+  return level_matrices[level_matrices.max_level()]->m();
+}
+
+
+
+SparseAMG::size_type
+SparseAMG::n() const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+  return level_matrices[level_matrices.max_level()]->n();
+}
+
+
+
+double
+SparseAMG::operator_complexity() const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+
+  std::size_t n_nonzeros = 0;
+  for (unsigned int level = level_matrices.min_level();
+       level <= level_matrices.max_level();
+       ++level)
+    n_nonzeros += level_matrices[level]->n_nonzero_elements();
+  return static_cast<double>(n_nonzeros) /
+         level_matrices[level_matrices.max_level()]->n_nonzero_elements();
+}
+
+
+
+std::size_t
+SparseAMG::memory_consumption() const
+{
+  std::size_t memory = transfer.memory_consumption();
+  for (unsigned int level = level_matrices.min_level();
+       level < level_matrices.max_level();
+       ++level)
+    memory +=
+      level_matrices[level]->memory_consumption() +
+      level_matrices[level]->get_sparsity_pattern().memory_consumption();
+  return memory;
+}
+
+DEAL_II_NAMESPACE_CLOSE
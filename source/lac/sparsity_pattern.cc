@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
@@ -537,6 +538,82 @@ SparsityPattern::copy_from(const DynamicSparsityPattern &dsp)
 
 
 
+void
+SparsityPattern::copy_from(
+  const size_type                                                  n_rows,
+  const size_type                                                  n_cols,
+  const std::vector<std::vector<std::pair<size_type, size_type>>> &entries)
+{
+  const bool do_diag_optimize = (n_rows == n_cols);
+
+  if constexpr (running_in_debug_mode())
+    {
+      size_type first_row = 0;
+      for (const auto &list : entries)
+        if (!list.empty())
+          {
+            Assert(list.front().first >= first_row,
+                   ExcMessage("The rows in the lists must be increasing."));
+            Assert(std::adjacent_find(list.begin(),
+                                      list.end(),
+                                      std::greater_equal<>()) == list.end(),
+                   ExcMessage("The entries in each list must be sorted and "
+                              "must not contain duplicates."));
+            AssertIndexRange(list.back().first, n_rows);
+            first_row = list.back().first + 1;
+          }
+    }
+
+  // the lists describe disjoint row ranges, so the tasks below never write
+  // to the same row
+  const auto for_each_list = [&entries](const auto &operation) {
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      entries.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+          operation(entries[i]);
+      },
+      1);
+  };
+
+  // count the entries in each row, adding the diagonal for square patterns
+  // if it is not yet present
+  std::vector<unsigned int> row_lengths(n_rows, do_diag_optimize ? 1 : 0);
+  for_each_list([&](const auto &list) {
+    for (const auto &[row, col] : list)
+      {
+        AssertIndexRange(col, n_cols);
+        if ((col != row) || !do_diag_optimize)
+          ++row_lengths[row];
+      }
+  });
+  reinit(n_rows, n_cols, row_lengths);
+
+  // since the entries are sorted, each row is filled from front to back
+  // while walking through the lists once
+  const unsigned int diagonal_offset = do_diag_optimize ? 1 : 0;
+  if (n_rows != 0 && n_cols != 0)
+    for_each_list([&](const auto &list) {
+      size_type  current_row = numbers::invalid_size_type;
+      size_type *cols        = nullptr;
+      for (const auto &[row, col] : list)
+        {
+          if (row != current_row)
+            {
+              current_row = row;
+              cols        = colnums.get() + rowstart[row] + diagonal_offset;
+            }
+          if ((col != row) || !do_diag_optimize)
+            *cols++ = col;
+        }
+    });
+
+  compressed = true;
+}
+
+
+
 template <typename number>
 void
 SparsityPattern::copy_from(const FullMatrix<number> &matrix)
@@ -14,6 +14,8 @@
 
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/lac/exceptions.h>
 #include <deal.II/lac/sparsity_pattern.h>
@@ -22,6 +24,8 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <set>
 
 #ifdef DEAL_II_WITH_MPI
@@ -518,6 +522,14 @@ namespace SparsityTools
 
   namespace internal
   {
+    /**
+     * The minimal number of nodes of a front of the Cuthill-McKee algorithm
+     * a thread works on when searching for the nodes of the next front.
+     */
+    constexpr std::size_t cuthill_mckee_grain_size = 1024;
+
+
+
     /**
      * Given a connectivity graph and a list of indices (where
      * invalid_size_type indicates that a node has not been numbered yet),
@@ -630,33 +642,50 @@ namespace SparsityTools
     // now do as many steps as needed to renumber all dofs
     while (true)
       {
-        next_round_dofs.clear();
-
-        // find all neighbors of the dofs numbered in the last round
-        for (const auto dof : last_round_dofs)
-          {
-            const unsigned int row_length = sparsity.row_length(dof);
-            for (unsigned int i = 0; i < row_length; ++i)
+        // find all neighbors of the dofs numbered in the last round together
+        // with their coordination number. large fronts are split into chunks
+        // that are worked on in parallel; a neighbor may be found from
+        // several dofs (and chunks), so remove duplicates afterwards. since
+        // the result is sorted, it does not depend on the order in which the
+        // chunks are merged
+        dofs_by_coordination.clear();
+        std::mutex mutex;
+        parallel::apply_to_subranges(
+          std::size_t(0),
+          last_round_dofs.size(),
+          [&](const std::size_t begin, const std::size_t end) {
+            std::vector<
+              std::pair<unsigned int, DynamicSparsityPattern::size_type>>
+              local_dofs;
+            for (std::size_t d = begin; d < end; ++d)
               {
-                // skip dofs which are already numbered
-                const auto column = sparsity.column_number(dof, i);
-                if (new_indices[column] == numbers::invalid_size_type)
+                const auto         dof        = last_round_dofs[d];
+                const unsigned int row_length = sparsity.row_length(dof);
+                for (unsigned int i = 0; i < row_length; ++i)
                   {
-                    next_round_dofs.push_back(column);
-
-                    // assign a dummy value to 'new_indices' to avoid adding
-                    // the same index again; those will get the right number
-                    // at the end of the outer 'while' loop
-                    new_indices[column] = 0;
+                    // skip dofs which are already numbered
+                    const auto column = sparsity.column_number(dof, i);
+                    if (new_indices[column] == numbers::invalid_size_type)
+                      local_dofs.emplace_back(sparsity.row_length(column),
+                                              column);
                   }
               }
-          }
+            std::lock_guard<std::mutex> lock(mutex);
+            dofs_by_coordination.insert(dofs_by_coordination.end(),
+                                        local_dofs.begin(),
+                                        local_dofs.end());
+          },
+          internal::cuthill_mckee_grain_size);
+        std::sort(dofs_by_coordination.begin(), dofs_by_coordination.end());
+        dofs_by_coordination.erase(std::unique(dofs_by_coordination.begin(),
+                                               dofs_by_coordination.end()),
+                                   dofs_by_coordination.end());
 
         // check whether there are any new dofs in the list. if there are
         // none, then we have completely numbered the current component of the
         // graph. check if there are as yet unnumbered components of the graph
         // that we would then have to do next
-        if (next_round_dofs.empty())
+        if (dofs_by_coordination.empty())
           {
             if (std::find(new_indices.begin(),
                           new_indices.end(),
@@ -676,17 +705,16 @@ namespace SparsityTools
                               "starting indices are given. The function was "
                               "called with starting indices, however."));
 
-            next_round_dofs.push_back(
-              internal::find_unnumbered_starting_index(sparsity, new_indices));
+            const DynamicSparsityPattern::size_type starting_index =
+              internal::find_unnumbered_starting_index(sparsity, new_indices);
+            dofs_by_coordination.emplace_back(sparsity.row_length(
+                                                starting_index),
+                                              starting_index);
           }
 
-
-        // find coordination number for each of these dofs
-        dofs_by_coordination.clear();
-        for (const types::global_dof_index next_round_dof : next_round_dofs)
-          dofs_by_coordination.emplace_back(sparsity.row_length(next_round_dof),
-                                            next_round_dof);
-        std::sort(dofs_by_coordination.begin(), dofs_by_coordination.end());
+        next_round_dofs.clear();
+        for (const auto &i : dofs_by_coordination)
+          next_round_dofs.push_back(i.second);
 
         // assign new DoF numbers to the elements of the present front:
         for (const auto &i : dofs_by_coordination)
@@ -943,6 +971,282 @@ namespace SparsityTools
 
 
 
+  namespace internal
+  {
+    /**
+     * Data shared by the recursive calls of reorder_nested_dissection().
+     *
+     * Every node carries the label of the subgraph it currently belongs to
+     * (the first new index of that subgraph), or numbers::invalid_size_type
+     * once it has received its final number. Concurrent recursive calls
+     * work on disjoint subgraphs that are only connected through separators
+     * that are already numbered, so each call only writes the entries of
+     * its own nodes.
+     */
+    struct NestedDissectionData
+    {
+      NestedDissectionData(const DynamicSparsityPattern &sparsity,
+                           std::vector<DynamicSparsityPattern::size_type>
+                                             &new_indices,
+                           const unsigned int max_block_size)
+        : sparsity(sparsity)
+        , new_indices(new_indices)
+        , max_block_size(max_block_size)
+        , subgraph(sparsity.n_rows(), 0)
+        , distance(sparsity.n_rows(), numbers::invalid_unsigned_int)
+      {}
+
+      const DynamicSparsityPattern                   &sparsity;
+      std::vector<DynamicSparsityPattern::size_type> &new_indices;
+      const unsigned int                              max_block_size;
+      std::vector<DynamicSparsityPattern::size_type>  subgraph;
+      std::vector<unsigned int>                       distance;
+    };
+
+
+
+    /**
+     * Run a breadth-first search from @p start through the nodes with
+     * subgraph label @p label, i.e., the nodes in @p nodes. Return the
+     * nodes reached in the order in which they were found and set their
+     * distance to @p start. The distances of all @p nodes must be invalid
+     * before the call.
+     */
+    std::vector<DynamicSparsityPattern::size_type>
+    breadth_first_search(NestedDissectionData                   &data,
+                         const DynamicSparsityPattern::size_type label,
+                         const DynamicSparsityPattern::size_type start)
+    {
+      std::vector<DynamicSparsityPattern::size_type> reached;
+      reached.push_back(start);
+      data.distance[start] = 0;
+      for (std::size_t i = 0; i < reached.size(); ++i)
+        {
+          const auto         node       = reached[i];
+          const unsigned int row_length = data.sparsity.row_length(node);
+          for (unsigned int j = 0; j < row_length; ++j)
+            {
+              const auto column = data.sparsity.column_number(node, j);
+              if (data.subgraph[column] == label &&
+                  data.distance[column] == numbers::invalid_unsigned_int)
+                {
+                  data.distance[column] = data.distance[node] + 1;
+                  reached.push_back(column);
+                }
+            }
+        }
+      return reached;
+    }
+
+
+
+    /**
+     * Number the nodes of the subgraph with the given @p label, consisting
+     * of @p nodes, starting at @p first_index. See
+     * SparsityTools::reorder_nested_dissection() for the algorithm.
+     */
+    void
+    reorder_nested_dissection(
+      NestedDissectionData                                 &data,
+      const std::vector<DynamicSparsityPattern::size_type> &nodes,
+      const DynamicSparsityPattern::size_type               first_index)
+    {
+      const DynamicSparsityPattern::size_type label = first_index;
+      DynamicSparsityPattern::size_type       next_index = first_index;
+
+      const auto number_nodes =
+        [&](const std::vector<DynamicSparsityPattern::size_type> &nodes) {
+          for (const auto node : nodes)
+            {
+              data.new_indices[node] = next_index++;
+              data.subgraph[node]    = numbers::invalid_size_type;
+            }
+        };
+
+      const auto reset_distances = [&]() {
+        for (const auto node : nodes)
+          data.distance[node] = numbers::invalid_unsigned_int;
+      };
+
+      // small subgraphs form one block, which we number in breadth-first
+      // order, one connected component after the other
+      if (nodes.size() <= data.max_block_size)
+        {
+          std::vector<DynamicSparsityPattern::size_type> block;
+          block.reserve(nodes.size());
+          for (const auto node : nodes)
+            if (data.distance[node] == numbers::invalid_unsigned_int)
+              {
+                const auto component =
+                  breadth_first_search(data, label, node);
+                block.insert(block.end(), component.begin(), component.end());
+              }
+          reset_distances();
+          number_nodes(block);
+          return;
+        }
+
+      // find a pseudo-peripheral node: start at a node with minimal
+      // coordination number and move to the farthest node with minimal
+      // coordination number as long as this increases the eccentricity
+      DynamicSparsityPattern::size_type start = nodes[0];
+      for (const auto node : nodes)
+        if (data.sparsity.row_length(node) < data.sparsity.row_length(start))
+          start = node;
+      std::vector<DynamicSparsityPattern::size_type> reached =
+        breadth_first_search(data, label, start);
+      while (true)
+        {
+          const unsigned int eccentricity = data.distance[reached.back()];
+          DynamicSparsityPattern::size_type candidate = reached.back();
+          for (auto node = reached.rbegin();
+               node != reached.rend() &&
+               data.distance[*node] == eccentricity;
+               ++node)
+            if (data.sparsity.row_length(*node) <
+                data.sparsity.row_length(candidate))
+              candidate = *node;
+
+          reset_distances();
+          std::vector<DynamicSparsityPattern::size_type> candidate_reached =
+            breadth_first_search(data, label, candidate);
+          if (data.distance[candidate_reached.back()] <= eccentricity)
+            {
+              reached.swap(candidate_reached);
+              break;
+            }
+          reached.swap(candidate_reached);
+        }
+
+      // split the subgraph into two parts and a separator. if the subgraph
+      // is not connected, we distribute its connected components to the two
+      // parts, which then need no separator. otherwise, the separator is the
+      // level of the breadth-first search that contains the median node
+      std::vector<DynamicSparsityPattern::size_type> part_1, part_2, separator;
+      if (reached.size() < nodes.size())
+        {
+          part_1 = reached;
+          for (const auto node : nodes)
+            if (data.distance[node] == numbers::invalid_unsigned_int)
+              {
+                const auto component = breadth_first_search(data, label, node);
+                auto &part = (part_1.size() + component.size() <=
+                              nodes.size() / 2) ?
+                               part_1 :
+                               part_2;
+                part.insert(part.end(), component.begin(), component.end());
+              }
+        }
+      else
+        {
+          // a graph with less than three levels cannot be split by a level,
+          // so we number it as one block
+          const unsigned int n_levels = data.distance[reached.back()] + 1;
+          if (n_levels < 3)
+            {
+              reset_distances();
+              number_nodes(reached);
+              return;
+            }
+
+          const unsigned int separator_level =
+            std::min(std::max(data.distance[reached[reached.size() / 2]], 1U),
+                     n_levels - 2);
+          for (const auto node : reached)
+            if (data.distance[node] < separator_level)
+              part_1.push_back(node);
+            else if (data.distance[node] > separator_level)
+              part_2.push_back(node);
+            else
+              separator.push_back(node);
+        }
+      reset_distances();
+
+      // number the separator last, and the two parts before it. the two
+      // parts are independent of each other, so work on them in parallel
+      next_index += part_1.size() + part_2.size();
+      number_nodes(separator);
+
+      const DynamicSparsityPattern::size_type first_index_2 =
+        first_index + part_1.size();
+      for (const auto node : part_1)
+        data.subgraph[node] = first_index;
+      for (const auto node : part_2)
+        data.subgraph[node] = first_index_2;
+
+      Threads::TaskGroup<> tasks;
+      if (part_1.size() > data.max_block_size)
+        tasks += Threads::new_task(
+          [&]() { reorder_nested_dissection(data, part_1, first_index); });
+      else
+        reorder_nested_dissection(data, part_1, first_index);
+      reorder_nested_dissection(data, part_2, first_index_2);
+      tasks.join_all();
+    }
+  } // namespace internal
+
+
+
+  void
+  reorder_nested_dissection(
+    const DynamicSparsityPattern                   &sparsity,
+    std::vector<DynamicSparsityPattern::size_type> &new_indices,
+    const unsigned int                              max_block_size)
+  {
+    Assert(sparsity.n_rows() == sparsity.n_cols(),
+           ExcDimensionMismatch(sparsity.n_rows(), sparsity.n_cols()));
+    Assert(sparsity.n_rows() == new_indices.size(),
+           ExcDimensionMismatch(sparsity.n_rows(), new_indices.size()));
+    Assert(sparsity.row_index_set().size() == 0 ||
+             sparsity.row_index_set().size() == sparsity.n_rows(),
+           ExcMessage(
+             "Only valid for sparsity patterns which store all rows."));
+    Assert(max_block_size > 0, ExcMessage("The block size must be positive."));
+
+    std::fill(new_indices.begin(),
+              new_indices.end(),
+              numbers::invalid_size_type);
+    if (sparsity.n_rows() == 0)
+      return;
+
+    internal::NestedDissectionData data(sparsity, new_indices, max_block_size);
+    std::vector<DynamicSparsityPattern::size_type> nodes(sparsity.n_rows());
+    std::iota(nodes.begin(), nodes.end(), DynamicSparsityPattern::size_type(0));
+    internal::reorder_nested_dissection(data, nodes, 0);
+
+    Assert(std::find(new_indices.begin(),
+                     new_indices.end(),
+                     numbers::invalid_size_type) == new_indices.end(),
+           ExcInternalError());
+  }
+
+
+
+  DynamicSparsityPattern::size_type
+  compute_profile(const DynamicSparsityPattern &sparsity)
+  {
+    Assert(sparsity.row_index_set().size() == 0 ||
+             sparsity.row_index_set().size() == sparsity.n_rows(),
+           ExcMessage(
+             "Only valid for sparsity patterns which store all rows."));
+
+    DynamicSparsityPattern::size_type profile = 0;
+    for (DynamicSparsityPattern::size_type row = 0; row < sparsity.n_rows();
+         ++row)
+      if (sparsity.row_length(row) > 0)
+        {
+          // the columns of each row are sorted, so the first one is the
+          // leftmost entry
+          const DynamicSparsityPattern::size_type first_column =
+            sparsity.column_number(row, 0);
+          if (first_column < row)
+            profile += row - first_column;
+        }
+    return profile;
+  }
+
+
+
 #ifdef DEAL_II_WITH_MPI
 
   void
@@ -0,0 +1,321 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/multigrid/mg_coarse_sparse_direct.h>
+
+#include <algorithm>
+#include <limits>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace internal
+{
+  namespace MGCoarseGridSparseDirectImplementation
+  {
+    // Collect the entries of local_data from all processes, either on the
+    // first process only or on all processes, in the order of the
+    // processes. The number of entries sent by each process is returned in
+    // counts and the offsets into the result in displacements, both only
+    // filled on the receiving process(es).
+    template <typename T>
+    std::vector<T>
+    gather(const std::vector<T> &local_data,
+           const bool            to_all,
+           const MPI_Comm        communicator,
+           std::vector<int>     &counts,
+           std::vector<int>     &displacements)
+    {
+      const unsigned int n_procs =
+        Utilities::MPI::n_mpi_processes(communicator);
+
+      const bool is_receiver =
+        to_all || Utilities::MPI::this_mpi_process(communicator) == 0;
+
+      counts.clear();
+      displacements.clear();
+      std::vector<T> result;
+
+#ifdef DEAL_II_WITH_MPI
+      if (n_procs > 1)
+        {
+          AssertThrow(local_data.size() <
+                        static_cast<std::size_t>(
+                          std::numeric_limits<int>::max()),
+                      ExcMessage("Too many entries to gather"));
+          const int local_count = local_data.size();
+          if (is_receiver)
+            counts.resize(n_procs);
+          int ierr;
+          if (to_all)
+            ierr = MPI_Allgather(&local_count,
+                                 1,
+                                 MPI_INT,
+                                 counts.data(),
+                                 1,
+                                 MPI_INT,
+                                 communicator);
+          else
+            ierr = MPI_Gather(&local_count,
+                              1,
+                              MPI_INT,
+                              counts.data(),
+                              1,
+                              MPI_INT,
+                              0,
+                              communicator);
+          AssertThrowMPI(ierr);
+
+          if (is_receiver)
+            {
+              displacements.resize(n_procs + 1);
+              displacements[0] = 0;
+              for (unsigned int p = 0; p < n_procs; ++p)
+                {
+                  AssertThrow(displacements[p] <=
+                                std::numeric_limits<int>::max() - counts[p],
+                              ExcMessage("Too many entries to gather"));
+                  displacements[p + 1] = displacements[p] + counts[p];
+                }
+              result.resize(displacements.back());
+            }
+
+          if (to_all)
+            ierr = MPI_Allgatherv(local_data.data(),
+                                  local_count,
+                                  Utilities::MPI::mpi_type_id_for_type<T>,
+                                  result.data(),
+                                  counts.data(),
+                                  displacements.data(),
+                                  Utilities::MPI::mpi_type_id_for_type<T>,
+                                  communicator);
+          else
+            ierr = MPI_Gatherv(local_data.data(),
+                               local_count,
+                               Utilities::MPI::mpi_type_id_for_type<T>,
+                               result.data(),
+                               counts.data(),
+                               displacements.data(),
+                               Utilities::MPI::mpi_type_id_for_type<T>,
+                               0,
+                               communicator);
+          AssertThrowMPI(ierr);
+          displacements.pop_back();
+          return result;
+        }
+#endif
+
+      (void)n_procs;
+      (void)is_receiver;
+      counts.push_back(local_data.size());
+      displacements.push_back(0);
+      return local_data;
+    }
+  } // namespace MGCoarseGridSparseDirectImplementation
+} // namespace internal
+
+
+
+template <typename Number>
+void
+MGCoarseGridSparseDirect<Number>::initialize_from_entries(
+  const std::vector<types::global_dof_index>               &rows,
+  const std::vector<types::global_dof_index>               &columns,
+  const std::vector<double>                                &values,
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+  const AdditionalData                                     &additional_data)
+{
+  AssertDimension(rows.size(), columns.size());
+  AssertDimension(rows.size(), values.size());
+  Assert(partitioner.get() != nullptr, ExcNotInitialized());
+
+  clear();
+  this->partitioner     = partitioner;
+  this->redundant_solve = additional_data.redundant_solve;
+
+  const MPI_Comm communicator = partitioner->get_mpi_communicator();
+
+  const bool is_solver_rank =
+    redundant_solve || Utilities::MPI::this_mpi_process(communicator) == 0;
+
+  // the layout of the vectors passed to operator()
+  gathered_indices =
+    internal::MGCoarseGridSparseDirectImplementation::gather(
+      partitioner->locally_owned_range().get_index_vector(),
+      redundant_solve,
+      communicator,
+      vector_counts,
+      vector_displacements);
+
+  // the matrix entries in coordinate format
+  std::vector<int>                           counts, displacements;
+  const std::vector<types::global_dof_index> all_rows =
+    internal::MGCoarseGridSparseDirectImplementation::gather(
+      rows, redundant_solve, communicator, counts, displacements);
+  const std::vector<types::global_dof_index> all_columns =
+    internal::MGCoarseGridSparseDirectImplementation::gather(
+      columns, redundant_solve, communicator, counts, displacements);
+  const std::vector<double> all_values =
+    internal::MGCoarseGridSparseDirectImplementation::gather(
+      values, redundant_solve, communicator, counts, displacements);
+
+  if (is_solver_rank)
+    {
+      const types::global_dof_index n = partitioner->size();
+      AssertDimension(gathered_indices.size(), n);
+
+      DynamicSparsityPattern dsp(n, n);
+      for (std::size_t i = 0; i < all_rows.size(); ++i)
+        dsp.add(all_rows[i], all_columns[i]);
+      SparsityPattern sparsity_pattern;
+      sparsity_pattern.copy_from(dsp);
+
+      SparseMatrix<double> matrix(sparsity_pattern);
+      for (std::size_t i = 0; i < all_rows.size(); ++i)
+        matrix.add(all_rows[i], all_columns[i], all_values[i]);
+
+      // the factorization keeps its own copy of the matrix
+      solver = std::make_unique<SparseDirectUMFPACK>();
+      solver->initialize(matrix);
+
+      gathered_values.resize(n);
+      rhs_and_solution.reinit(n);
+    }
+}
+
+
+
+template <typename Number>
+void
+MGCoarseGridSparseDirect<Number>::clear()
+{
+  partitioner.reset();
+  redundant_solve = false;
+  vector_counts.clear();
+  vector_displacements.clear();
+  gathered_indices.clear();
+  solver.reset();
+  gathered_values.clear();
+  rhs_and_solution.reinit(0);
+}
+
+
+
+template <typename Number>
+void
+MGCoarseGridSparseDirect<Number>::operator()(const unsigned int,
+                                             VectorType       &dst,
+                                             const VectorType &src) const
+{
+  Assert(partitioner.get() != nullptr, ExcNotInitialized());
+  AssertDimension(src.locally_owned_size(), partitioner->locally_owned_size());
+  AssertDimension(dst.locally_owned_size(), partitioner->locally_owned_size());
+
+  const MPI_Comm communicator = partitioner->get_mpi_communicator();
+
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(communicator);
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(communicator);
+
+  const int  local_size     = partitioner->locally_owned_size();
+  const bool is_solver_rank = redundant_solve || my_rank == 0;
+
+  // collect the right hand side
+  if (n_procs == 1)
+    std::copy(src.begin(), src.begin() + local_size, gathered_values.begin());
+#ifdef DEAL_II_WITH_MPI
+  else if (redundant_solve)
+    {
+      const int ierr =
+        MPI_Allgatherv(src.begin(),
+                       local_size,
+                       Utilities::MPI::mpi_type_id_for_type<Number>,
+                       gathered_values.data(),
+                       vector_counts.data(),
+                       vector_displacements.data(),
+                       Utilities::MPI::mpi_type_id_for_type<Number>,
+                       communicator);
+      AssertThrowMPI(ierr);
+    }
+  else
+    {
+      const int ierr =
+        MPI_Gatherv(src.begin(),
+                    local_size,
+                    Utilities::MPI::mpi_type_id_for_type<Number>,
+                    gathered_values.data(),
+                    vector_counts.data(),
+                    vector_displacements.data(),
+                    Utilities::MPI::mpi_type_id_for_type<Number>,
+                    0,
+                    communicator);
+      AssertThrowMPI(ierr);
+    }
+#endif
+
+  if (is_solver_rank)
+    {
+      for (std::size_t i = 0; i < gathered_indices.size(); ++i)
+        rhs_and_solution(gathered_indices[i]) = gathered_values[i];
+      solver->solve(rhs_and_solution);
+      for (std::size_t i = 0; i < gathered_indices.size(); ++i)
+        gathered_values[i] = rhs_and_solution(gathered_indices[i]);
+    }
+
+  // distribute the solution
+  if (n_procs == 1 || redundant_solve)
+    {
+      const unsigned int offset =
+        n_procs == 1 ? 0 : vector_displacements[my_rank];
+      std::copy(gathered_values.begin() + offset,
+                gathered_values.begin() + offset + local_size,
+                dst.begin());
+    }
+#ifdef DEAL_II_WITH_MPI
+  else
+    {
+      const int ierr =
+        MPI_Scatterv(gathered_values.data(),
+                     vector_counts.data(),
+                     vector_displacements.data(),
+                     Utilities::MPI::mpi_type_id_for_type<Number>,
+                     dst.begin(),
+                     local_size,
+                     Utilities::MPI::mpi_type_id_for_type<Number>,
+                     0,
+                     communicator);
+      AssertThrowMPI(ierr);
+    }
+#endif
+}
+
+
+
+template <typename Number>
+types::global_dof_index
+MGCoarseGridSparseDirect<Number>::m() const
+{
+  return partitioner.get() != nullptr ? partitioner->size() : 0;
+}
+
+
+// explicit instantiations
+#include "multigrid/mg_coarse_sparse_direct.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -12,6 +12,10 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/vectorization.h>
 #include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_accessor.h>
@@ -27,6 +31,9 @@
 
 #include <deal.II/hp/fe_values.h>
 
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
 #include <deal.II/numerics/data_out.h>
 
 #include <sstream>
@@ -58,6 +65,147 @@ namespace internal
                                         false)
       , cell_to_patch_index_map(&cell_to_patch_index_map)
     {}
+
+
+
+    /**
+     * If the values of the given data set on the patches can be computed
+     * with the tensor-product kernels of the matrix-free framework rather
+     * than through FEValues, return the shape information for the points of
+     * the patches; otherwise, return a null pointer. This is the case for
+     * real-valued data without a postprocessor on a DoFHandler with a single
+     * element that is a tensor product of one-dimensional polynomials, like
+     * FE_Q and FE_DGQ, or an FESystem of several copies of such an element.
+     */
+    template <int dim, int spacedim>
+    std::unique_ptr<MatrixFreeFunctions::ShapeInfo<double>>
+    create_sum_factorization_shape_info(
+      const DataEntryBase<dim, spacedim> &dataset,
+      const unsigned int                  n_subdivisions)
+    {
+      if (dataset.postprocessor != nullptr || dataset.is_complex_valued() ||
+          dataset.dof_handler->get_fe_collection().size() != 1)
+        return nullptr;
+
+      const FiniteElement<dim, spacedim> &fe = dataset.dof_handler->get_fe(0);
+      if (fe.n_base_elements() != 1 || fe.n_dofs_per_cell() == 0 ||
+          fe.reference_cell() != ReferenceCells::get_hypercube<dim>() ||
+          MatrixFreeFunctions::ShapeInfo<double>::is_supported(fe) == false)
+        return nullptr;
+
+      // the points of the patches are the ones of the iterated trapezoidal
+      // rule, see ParallelDataBase
+      auto shape_info = std::make_unique<MatrixFreeFunctions::ShapeInfo<double>>(
+        QIterated<1>(QTrapezoid<1>(), n_subdivisions), fe);
+      if (shape_info->element_type > MatrixFreeFunctions::tensor_general)
+        return nullptr;
+
+      return shape_info;
+    }
+
+
+
+    /**
+     * Evaluate the given data set on the points of the patches of the given
+     * cells and write the values into the rows of the patch data starting at
+     * @p first_row. The cells are processed in batches of the width of
+     * VectorizedArray<double>, with the values of one cell in each lane.
+     */
+    template <int dim, int spacedim>
+    void
+    evaluate_by_sum_factorization(
+      const DataEntryBase<dim, spacedim>            &dataset,
+      const MatrixFreeFunctions::ShapeInfo<double> &shape_info,
+      const unsigned int                            first_row,
+      const std::pair<typename Triangulation<dim, spacedim>::cell_iterator,
+                      unsigned int>                 *cells,
+      const unsigned int                            n_cells,
+      DataOutBase::Patch<dim, spacedim>            *patches)
+    {
+      using VectorizedArrayType          = VectorizedArray<double>;
+      constexpr unsigned int n_lanes     = VectorizedArrayType::size();
+      const unsigned int     n_dofs_1d   = shape_info.data[0].fe_degree + 1;
+      const unsigned int     n_points_1d = shape_info.data[0].n_q_points_1d;
+      const unsigned int     n_components = shape_info.n_components;
+      const unsigned int     dofs_per_component =
+        shape_info.dofs_per_component_on_cell;
+      const unsigned int n_points = shape_info.n_q_points;
+
+      EvaluatorTensorProduct<evaluate_general,
+                             dim,
+                             0,
+                             0,
+                             VectorizedArrayType,
+                             double>
+        evaluator(shape_info.data[0].shape_values,
+                  shape_info.data[0].shape_gradients,
+                  shape_info.data[0].shape_hessians,
+                  n_dofs_1d,
+                  n_points_1d);
+
+      std::vector<double> dof_values(n_components * dofs_per_component);
+      AlignedVector<VectorizedArrayType> values_dofs(n_components *
+                                                     dofs_per_component);
+      AlignedVector<VectorizedArrayType> temp(
+        2 * Utilities::fixed_power<dim>(std::max(n_dofs_1d, n_points_1d)));
+      AlignedVector<VectorizedArrayType> values_points(n_points);
+
+      for (unsigned int batch = 0; batch < n_cells; batch += n_lanes)
+        {
+          const unsigned int n_filled_lanes =
+            std::min(n_lanes, n_cells - batch);
+
+          // gather the degrees of freedom of the cells of this batch in
+          // lexicographic order, one component after the other
+          for (unsigned int v = 0; v < n_filled_lanes; ++v)
+            {
+              const auto &cell = cells[batch + v].first;
+              const typename DoFHandler<dim, spacedim>::cell_iterator dh_cell(
+                &cell->get_triangulation(),
+                cell->level(),
+                cell->index(),
+                dataset.dof_handler);
+              dataset.get_dof_values(dh_cell,
+                                     ComponentExtractor::real_part,
+                                     dof_values);
+              for (unsigned int i = 0; i < dof_values.size(); ++i)
+                values_dofs[i][v] =
+                  dof_values[shape_info.lexicographic_numbering[i]];
+            }
+
+          for (unsigned int c = 0; c < n_components; ++c)
+            {
+              const VectorizedArrayType *in =
+                values_dofs.data() + c * dofs_per_component;
+              VectorizedArrayType *tmp1 = temp.data();
+              VectorizedArrayType *tmp2 = temp.data() + temp.size() / 2;
+              if constexpr (dim == 1)
+                evaluator.template values<0, true, false>(in,
+                                                          values_points.data());
+              else if constexpr (dim == 2)
+                {
+                  evaluator.template values<0, true, false>(in, tmp1);
+                  evaluator.template values<1, true, false>(
+                    tmp1, values_points.data());
+                }
+              else if constexpr (dim == 3)
+                {
+                  evaluator.template values<0, true, false>(in, tmp1);
+                  evaluator.template values<1, true, false>(tmp1, tmp2);
+                  evaluator.template values<2, true, false>(
+                    tmp2, values_points.data());
+                }
+
+              for (unsigned int v = 0; v < n_filled_lanes; ++v)
+                {
+                  DataOutBase::Patch<dim, spacedim> &patch =
+                    patches[batch + v];
+                  for (unsigned int q = 0; q < n_points; ++q)
+                    patch.data(first_row + c, q) = values_points[q][v];
+                }
+            }
+        }
+    }
   } // namespace DataOutImplementation
 } // namespace internal
 
@@ -96,7 +244,8 @@ DataOut<dim, spacedim>::build_one_patch(
   const std::pair<cell_iterator, unsigned int>                 *cell_and_index,
   internal::DataOutImplementation::ParallelData<dim, spacedim> &scratch_data,
   const unsigned int                                            n_subdivisions,
-  const CurvedCellRegion curved_cell_region)
+  const CurvedCellRegion   curved_cell_region,
+  const std::vector<bool> &evaluated_by_sum_factorization)
 {
   // first create the output object that we will write into
 
@@ -178,6 +327,16 @@ DataOut<dim, spacedim>::build_one_patch(
       unsigned int dataset_number = 0;
       for (const auto &dataset : this->dof_data)
         {
+          // data sets evaluated with sum factorization are filled in by
+          // build_patches() once all patches have been set up, so only
+          // reserve their rows here
+          if (evaluated_by_sum_factorization[dataset_number])
+            {
+              offset += dataset->n_output_variables;
+              ++dataset_number;
+              continue;
+            }
+
           const FEValuesBase<dim, spacedim> &this_fe_patch_values =
             scratch_data.get_present_fe_values(dataset_number);
           const unsigned int n_components =
@@ -1225,6 +1384,29 @@ DataOut<dim, spacedim>::build_patches(
       "The update of normal vectors may not be requested for evaluation of "
       "data on cells via DataPostprocessor."));
 
+  // Data sets of tensor-product elements without postprocessor are not
+  // evaluated through FEValues in build_one_patch(), but afterwards with sum
+  // factorization, vectorized over several cells. They occupy
+  // n_output_variables rows of the patch data, starting at the row computed
+  // here.
+  std::vector<
+    std::unique_ptr<internal::MatrixFreeFunctions::ShapeInfo<double>>>
+                            shape_infos(this->dof_data.size());
+  std::vector<bool>         evaluated_by_sum_factorization(this->dof_data.size());
+  std::vector<unsigned int> first_rows(this->dof_data.size());
+  for (unsigned int i = 0, row = 0; i < this->dof_data.size(); ++i)
+    {
+      shape_infos[i] = internal::DataOutImplementation::
+        create_sum_factorization_shape_info(*this->dof_data[i], n_subdivisions);
+      evaluated_by_sum_factorization[i] = (shape_infos[i] != nullptr);
+      first_rows[i]                     = row;
+      row += (this->dof_data[i]->n_output_variables *
+              (this->dof_data[i]->is_complex_valued() &&
+                   (this->dof_data[i]->postprocessor == nullptr) ?
+                 2 :
+                 1));
+    }
+
   internal::DataOutImplementation::ParallelData<dim, spacedim> thread_data(
     n_datasets,
     n_subdivisions,
@@ -1234,7 +1416,10 @@ DataOut<dim, spacedim>::build_patches(
     update_flags,
     cell_to_patch_index_map);
 
-  auto worker = [this, n_subdivisions, curved_cell_region](
+  auto worker = [this,
+                 n_subdivisions,
+                 curved_cell_region,
+                 &evaluated_by_sum_factorization](
                   const std::pair<cell_iterator, unsigned int> *cell_and_index,
                   internal::DataOutImplementation::ParallelData<dim, spacedim>
                     &scratch_data,
@@ -1244,7 +1429,8 @@ DataOut<dim, spacedim>::build_patches(
     this->build_one_patch(cell_and_index,
                           scratch_data,
                           n_subdivisions,
-                          curved_cell_region);
+                          curved_cell_region,
+                          evaluated_by_sum_factorization);
   };
 
   // now build the patches in parallel
@@ -1264,6 +1450,37 @@ DataOut<dim, spacedim>::build_patches(
                     // @ref workstream_paper, on 32 cores) and if
                     8 * MultithreadInfo::n_threads(),
                     64);
+
+  // then fill in the values of the data sets evaluated with sum
+  // factorization, working on batches of as many cells as there are lanes
+  // in a VectorizedArray
+  if (std::find(evaluated_by_sum_factorization.begin(),
+                evaluated_by_sum_factorization.end(),
+                true) != evaluated_by_sum_factorization.end())
+    {
+      constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+      const unsigned int     n_batches =
+        (all_cells.size() + n_lanes - 1) / n_lanes;
+      parallel::apply_to_subranges(
+        0U,
+        n_batches,
+        [&](const unsigned int begin, const unsigned int end) {
+          const unsigned int first_cell = begin * n_lanes;
+          const unsigned int n_cells =
+            std::min<unsigned int>(end * n_lanes, all_cells.size()) -
+            first_cell;
+          for (unsigned int i = 0; i < this->dof_data.size(); ++i)
+            if (evaluated_by_sum_factorization[i])
+              internal::DataOutImplementation::evaluate_by_sum_factorization(
+                *this->dof_data[i],
+                *shape_infos[i],
+                first_rows[i],
+                all_cells.data() + first_cell,
+                n_cells,
+                this->patches.data() + first_cell);
+        },
+        16);
+    }
 }
 
 
@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that DataOutAsyncWriter writes the same files as DataOut, even if the
+// DataOut object is rebuilt with other data while the output is still in
+// flight, and that errors during writing are reported by wait().
+
+#include <deal.II/base/data_out_async_writer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "../tests.h"
+
+
+std::string
+read_file(const std::string &filename)
+{
+  std::ifstream     in(filename);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim=" << dim << std::endl;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  DataOutAsyncWriter<dim> writer(2);
+  DataOutBase::VtkFlags   flags;
+  flags.print_date_and_time = false;
+
+  std::vector<std::string> reference(4);
+  DataOut<dim>             data_out;
+  Vector<double>           solution(dof_handler.n_dofs());
+  for (unsigned int step = 0; step < reference.size(); ++step)
+    {
+      for (unsigned int i = 0; i < solution.size(); ++i)
+        solution(i) = std::sin(0.1 * i + step);
+
+      data_out.clear();
+      data_out.set_flags(flags);
+      data_out.attach_dof_handler(dof_handler);
+      data_out.add_data_vector(solution, "solution");
+      data_out.build_patches(2);
+
+      std::ostringstream out;
+      data_out.write_vtu(out);
+      reference[step] = out.str();
+
+      if (step % 2 == 0)
+        writer.write_vtu(data_out,
+                         "output_" + std::to_string(dim) + "_" +
+                           std::to_string(step) + ".vtu");
+      else
+        deallog << "pvtu file: "
+                << writer.write_vtu_with_pvtu_record(data_out,
+                                                     "./",
+                                                     "output_" +
+                                                       std::to_string(dim),
+                                                     step,
+                                                     MPI_COMM_SELF,
+                                                     2)
+                << std::endl;
+      deallog << "Outputs in flight: " << writer.n_outputs_in_flight()
+              << std::endl;
+    }
+  writer.wait();
+  deallog << "Outputs in flight after wait(): "
+          << writer.n_outputs_in_flight() << std::endl;
+
+  for (unsigned int step = 0; step < reference.size(); ++step)
+    {
+      const std::string filename =
+        "output_" + std::to_string(dim) + "_" +
+        (step % 2 == 0 ? std::to_string(step) + ".vtu" :
+                         Utilities::int_to_string(step, 2) + ".0.vtu");
+      deallog << filename << ": "
+              << (read_file(filename) == reference[step] ? "identical" :
+                                                           "different")
+              << std::endl;
+    }
+  deallog << "pvtu record written: "
+          << (read_file("output_" + std::to_string(dim) + "_01.pvtu").find(
+                "output_" + std::to_string(dim) + "_01.0.vtu") !=
+                  std::string::npos ?
+                "yes" :
+                "no")
+          << std::endl;
+
+  writer.write_vtu(data_out, "nonexistent_directory/output.vtu");
+  try
+    {
+      writer.wait();
+      deallog << "No exception" << std::endl;
+    }
+  catch (const ExcFileNotOpen &)
+    {
+      deallog << "Caught ExcFileNotOpen" << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,190 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check the appended raw encoding of VTU files: without compression, read
+// the arrays back from their offsets in the appended data section and print
+// them; with compression, check the block structure of the arrays for a set
+// of patches large enough to need several blocks per array.
+
+#include <deal.II/base/data_out_base.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../tests.h"
+
+#include "patches.h"
+
+
+const std::string data_start_marker = "<AppendedData encoding=\"raw\">\n_";
+const std::string data_end_marker   = "\n</AppendedData>\n</VTKFile>\n";
+
+
+template <int dim, int spacedim>
+std::string
+write(const unsigned int n_patches, const DataOutBase::VtkFlags &flags)
+{
+  std::vector<DataOutBase::Patch<dim, spacedim>> patches(n_patches);
+  create_patches(patches);
+
+  std::vector<std::string> names(5);
+  names[0] = "x1";
+  names[1] = "x2";
+  names[2] = "x3";
+  names[3] = "x4";
+  names[4] = "i";
+  std::vector<
+    std::tuple<unsigned int,
+               unsigned int,
+               std::string,
+               DataComponentInterpretation::DataComponentInterpretation>>
+    vectors;
+
+  std::ostringstream out;
+  DataOutBase::write_vtu(patches, names, vectors, flags, out);
+  return out.str();
+}
+
+
+
+// Return the type and the offset of all data arrays listed in the XML part
+// of the file
+std::vector<std::pair<std::string, std::uint64_t>>
+get_arrays(const std::string &xml)
+{
+  std::vector<std::pair<std::string, std::uint64_t>> arrays;
+  for (std::size_t position = xml.find("format=\"appended\"");
+       position != std::string::npos;
+       position = xml.find("format=\"appended\"", position + 1))
+    {
+      const std::size_t element = xml.rfind("<DataArray", position);
+      const std::size_t type    = xml.find("type=\"", element) + 6;
+      const std::size_t offset  = xml.find("offset=\"", position) + 8;
+      arrays.emplace_back(xml.substr(type, xml.find('"', type) - type),
+                          std::stoull(xml.substr(offset)));
+    }
+  return arrays;
+}
+
+
+
+template <typename T>
+void
+print_values(const char *data, const std::uint64_t n_bytes)
+{
+  for (std::uint64_t i = 0; i < n_bytes / sizeof(T); ++i)
+    {
+      T value;
+      std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+      deallog.get_file_stream() << +value << ' ';
+    }
+  deallog.get_file_stream() << std::endl;
+}
+
+
+
+template <int dim, int spacedim>
+void
+check_uncompressed()
+{
+  DataOutBase::VtkFlags flags;
+  flags.print_date_and_time     = false;
+  flags.compression_level       = DataOutBase::CompressionLevel::plain_text;
+  flags.write_appended_raw_data = true;
+
+  const std::string file       = write<dim, spacedim>(4, flags);
+  const std::size_t data_start = file.find(data_start_marker) +
+                                 data_start_marker.size();
+  deallog.get_file_stream() << file.substr(0, data_start) << std::endl;
+
+  std::uint64_t expected_offset = 0;
+  for (const auto &[type, offset] : get_arrays(file.substr(0, data_start)))
+    {
+      AssertDimension(offset, expected_offset);
+      std::uint64_t n_bytes;
+      std::memcpy(&n_bytes, file.data() + data_start + offset, 8);
+      const char *data = file.data() + data_start + offset + 8;
+      deallog.get_file_stream() << type << ' ' << n_bytes << ": ";
+      if (type == "Float32")
+        print_values<float>(data, n_bytes);
+      else if (type == "Int32")
+        print_values<std::int32_t>(data, n_bytes);
+      else if (type == "UInt8")
+        print_values<std::uint8_t>(data, n_bytes);
+      expected_offset = offset + 8 + n_bytes;
+    }
+
+  deallog << "Appended data section closed correctly: "
+          << (file.substr(data_start + expected_offset) == data_end_marker ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+
+template <int dim, int spacedim>
+void
+check_compressed(const unsigned int n_patches)
+{
+  DataOutBase::VtkFlags flags;
+  flags.print_date_and_time     = false;
+  flags.compression_level       = DataOutBase::CompressionLevel::best_speed;
+  flags.write_appended_raw_data = true;
+
+  const std::string file       = write<dim, spacedim>(n_patches, flags);
+  const std::size_t data_start = file.find(data_start_marker) +
+                                 data_start_marker.size();
+
+  std::uint64_t expected_offset = 0;
+  for (const auto &[type, offset] : get_arrays(file.substr(0, data_start)))
+    {
+      AssertDimension(offset, expected_offset);
+      std::uint64_t header[3];
+      std::memcpy(header, file.data() + data_start + offset, 3 * 8);
+      std::uint64_t compressed_size = 0;
+      for (std::uint64_t block = 0; block < header[0]; ++block)
+        {
+          std::uint64_t block_size;
+          std::memcpy(&block_size,
+                      file.data() + data_start + offset + (3 + block) * 8,
+                      8);
+          compressed_size += block_size;
+        }
+      deallog << type << ": " << header[0] << " blocks of size " << header[1]
+              << ", last block " << header[2] << std::endl;
+      expected_offset = offset + (3 + header[0]) * 8 + compressed_size;
+    }
+
+  deallog << "Appended data section closed correctly: "
+          << (file.substr(data_start + expected_offset) == data_end_marker ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  check_uncompressed<1, 1>();
+  check_uncompressed<2, 2>();
+  check_compressed<2, 2>(100);
+  check_compressed<3, 3>(25);
+}
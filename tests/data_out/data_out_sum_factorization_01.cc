@@ -0,0 +1,192 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// DataOut::build_patches() evaluates data sets of tensor-product elements
+// without postprocessor with sum factorization. Check that this gives the
+// same patches as the evaluation through FEValues, which we force by
+// attaching the same vector once more with a postprocessor that simply
+// passes the values through. Also check non-active cells, for which
+// DataOut can not evaluate the postprocessor, against FEValues on the
+// DoFHandler cells, and a number of cells that does not fill the last batch
+// of a VectorizedArray.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/data_postprocessor.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+class Identity : public DataPostprocessor<dim>
+{
+public:
+  Identity(const unsigned int n_components)
+    : n_components(n_components)
+  {}
+
+  virtual void
+  evaluate_scalar_field(
+    const DataPostprocessorInputs::Scalar<dim> &inputs,
+    std::vector<Vector<double>> &computed_quantities) const override
+  {
+    for (unsigned int q = 0; q < inputs.solution_values.size(); ++q)
+      computed_quantities[q](0) = inputs.solution_values[q];
+  }
+
+  virtual void
+  evaluate_vector_field(
+    const DataPostprocessorInputs::Vector<dim> &inputs,
+    std::vector<Vector<double>> &computed_quantities) const override
+  {
+    for (unsigned int q = 0; q < inputs.solution_values.size(); ++q)
+      computed_quantities[q] = inputs.solution_values[q];
+  }
+
+  virtual std::vector<std::string>
+  get_names() const override
+  {
+    std::vector<std::string> names;
+    for (unsigned int c = 0; c < n_components; ++c)
+      names.push_back("reference_" + std::to_string(c));
+    return names;
+  }
+
+  virtual UpdateFlags
+  get_needed_update_flags() const override
+  {
+    return update_values;
+  }
+
+private:
+  const unsigned int n_components;
+};
+
+
+
+template <int dim>
+void
+check(const FiniteElement<dim> &fe,
+      const unsigned int        n_subdivisions,
+      const bool                level_cells)
+{
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube(tria, 3);
+  tria.refine_global(1);
+  GridTools::distort_random(0.1, tria);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < solution.size(); ++i)
+    solution(i) = std::sin(0.37 * i);
+
+  std::vector<std::string> names;
+  for (unsigned int c = 0; c < fe.n_components(); ++c)
+    names.push_back("solution_" + std::to_string(c));
+
+  const Identity<dim> identity(fe.n_components());
+  DataOut<dim>        data_out;
+  data_out.attach_dof_handler(dof_handler);
+  data_out.add_data_vector(solution, names);
+  if (!level_cells)
+    data_out.add_data_vector(solution, identity);
+  else
+    data_out.set_cell_selection(
+      [](const Triangulation<dim> &tria) { return tria.begin(0); },
+      [](const Triangulation<dim>                         &tria,
+         const typename Triangulation<dim>::cell_iterator &cell) {
+        typename Triangulation<dim>::cell_iterator next = cell;
+        ++next;
+        return (next == tria.end(0) ? tria.end() : next);
+      });
+  data_out.build_patches(n_subdivisions);
+
+  float max_difference = 0;
+  if (!level_cells)
+    for (const auto &patch : data_out.get_patches())
+      for (unsigned int c = 0; c < fe.n_components(); ++c)
+        for (unsigned int q = 0; q < patch.data.size(1); ++q)
+          max_difference =
+            std::max(max_difference,
+                     std::abs(patch.data(c, q) -
+                              patch.data(fe.n_components() + c, q)));
+  else
+    {
+      // evaluate on the same points as DataOut, with the DoFHandler cells
+      // that allow to interpolate the solution to the coarse cells
+      FEValues<dim> fe_values(fe,
+                              QIterated<dim>(QTrapezoid<1>(), n_subdivisions),
+                              update_values);
+      std::vector<Vector<double>> values(fe_values.n_quadrature_points,
+                                         Vector<double>(fe.n_components()));
+      auto patch = data_out.get_patches().begin();
+      for (const auto &cell : dof_handler.cell_iterators_on_level(0))
+        {
+          fe_values.reinit(cell);
+          fe_values.get_function_values(solution, values);
+          for (unsigned int c = 0; c < fe.n_components(); ++c)
+            for (unsigned int q = 0; q < values.size(); ++q)
+              max_difference = std::max<float>(max_difference,
+                                               std::abs(patch->data(c, q) -
+                                                        values[q](c)));
+          ++patch;
+        }
+    }
+
+  deallog << fe.get_name() << ", n_subdivisions=" << n_subdivisions
+          << (level_cells ? ", level cells" : "")
+          << ", patches: " << data_out.get_patches().size()
+          << ", values agree: " << (max_difference < 1e-6 ? "yes" : "no")
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  check(FE_DGQ<dim>(4), 4, false);
+  check(FE_Q<dim>(3), 2, false);
+  check(FE_Q<dim>(2), 1, true);
+  check(FESystem<dim>(FE_Q<dim>(2), 2), 3, false);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
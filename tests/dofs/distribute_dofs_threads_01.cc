@@ -0,0 +1,113 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// DoFHandler::distribute_dofs() enumerates the degrees of freedom of large
+// meshes in parallel. Check that the result is the same with several
+// threads as with a single thread, for adaptively refined meshes, for
+// faces that are not in standard orientation, and for elements with
+// degrees of freedom on all kinds of objects.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+std::vector<types::global_dof_index>
+get_all_dof_indices(const DoFHandler<dim> &dof_handler)
+{
+  std::vector<types::global_dof_index> all_dof_indices;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      std::vector<types::global_dof_index> dof_indices(
+        cell->get_fe().n_dofs_per_cell());
+      cell->get_dof_indices(dof_indices);
+      all_dof_indices.insert(all_dof_indices.end(),
+                             dof_indices.begin(),
+                             dof_indices.end());
+    }
+  return all_dof_indices;
+}
+
+
+
+template <int dim>
+void
+test(const Triangulation<dim> &tria, const FiniteElement<dim> &fe)
+{
+  DoFHandler<dim> dof_handler(tria);
+
+  MultithreadInfo::set_thread_limit(1);
+  dof_handler.distribute_dofs(fe);
+  const types::global_dof_index n_dofs_serial = dof_handler.n_dofs();
+  const std::vector<types::global_dof_index> serial =
+    get_all_dof_indices(dof_handler);
+
+  MultithreadInfo::set_thread_limit(std::max(2U, testing_max_num_threads()));
+  dof_handler.distribute_dofs(fe);
+  const std::vector<types::global_dof_index> threaded =
+    get_all_dof_indices(dof_handler);
+
+  deallog << fe.get_name() << ": " << tria.n_active_cells() << " cells, "
+          << dof_handler.n_dofs() << " dofs, "
+          << (n_dofs_serial == dof_handler.n_dofs() && serial == threaded ?
+                "ok" :
+                "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<2> tria;
+    GridGenerator::hyper_cube(tria);
+    tria.refine_global(4);
+    for (const auto &cell : tria.active_cell_iterators())
+      if (cell->center()[0] < 0.3)
+        cell->set_refine_flag();
+    tria.execute_coarsening_and_refinement();
+
+    test(tria, FE_Q<2>(1));
+    test(tria, FE_Q<2>(3));
+    test(tria, FESystem<2>(FE_Q<2>(2), 2, FE_DGQ<2>(1), 1));
+  }
+
+  {
+    Triangulation<3> tria;
+    GridGenerator::non_standard_orientation_mesh(tria, false, true, true, true);
+    tria.refine_global(2);
+    for (const auto &cell : tria.active_cell_iterators())
+      if (cell->center()[1] < 0.2)
+        cell->set_refine_flag();
+    tria.execute_coarsening_and_refinement();
+
+    test(tria, FE_Q<3>(1));
+    test(tria, FE_Q<3>(3));
+    test(tria, FESystem<3>(FE_Q<3>(2), 3, FE_DGQ<3>(1), 1));
+  }
+}
@@ -0,0 +1,142 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check DoFRenumbering::nested_dissection() and
+// DoFRenumbering::compute_nested_dissection() for a Q2 element on an
+// adaptively refined mesh, with and without hanging node constraints: the
+// computed numbering must be a permutation, it must be the one applied by
+// nested_dissection(), and it must not depend on the number of threads.
+// Print the profile of the sparsity pattern for the original numbering, the
+// nested dissection numbering, and the Cuthill-McKee numbering.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+types::global_dof_index
+compute_profile(const DoFHandler<dim> &dof_handler)
+{
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+  return SparsityTools::compute_profile(dsp);
+}
+
+
+
+template <int dim>
+void
+test(const unsigned int n_refinements, const bool use_constraints)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(n_refinements);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0.2)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  deallog << "dim=" << dim << ", " << dof_handler.n_dofs() << " dofs"
+          << (use_constraints ? ", with constraints" : "") << std::endl;
+  deallog << "original profile: " << compute_profile(dof_handler)
+          << std::endl;
+
+  const unsigned int block_size = 64;
+  const unsigned int n_threads  = std::max(2U, testing_max_num_threads());
+
+  std::vector<types::global_dof_index> serial(dof_handler.n_dofs()),
+    threaded(dof_handler.n_dofs());
+  MultithreadInfo::set_thread_limit(1);
+  DoFRenumbering::compute_nested_dissection(serial,
+                                            dof_handler,
+                                            block_size,
+                                            use_constraints);
+  MultithreadInfo::set_thread_limit(n_threads);
+  DoFRenumbering::compute_nested_dissection(threaded,
+                                            dof_handler,
+                                            block_size,
+                                            use_constraints);
+  deallog << "independent of threads: "
+          << (serial == threaded ? "ok" : "wrong") << std::endl;
+
+  std::vector<bool> found(serial.size(), false);
+  bool              is_permutation = serial.size() == dof_handler.n_dofs();
+  for (const auto index : serial)
+    if (index >= serial.size() || found[index])
+      is_permutation = false;
+    else
+      found[index] = true;
+  deallog << "permutation: " << (is_permutation ? "ok" : "wrong")
+          << std::endl;
+
+  // the numbering applied by nested_dissection() must be the computed one
+  std::vector<types::global_dof_index> old_indices(fe.n_dofs_per_cell()),
+    new_indices(fe.n_dofs_per_cell());
+  std::vector<std::vector<types::global_dof_index>> cell_indices;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(old_indices);
+      cell_indices.push_back(old_indices);
+    }
+  DoFRenumbering::nested_dissection(dof_handler, block_size, use_constraints);
+  bool         same_numbering = true;
+  unsigned int c              = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(new_indices);
+      for (unsigned int i = 0; i < new_indices.size(); ++i)
+        if (new_indices[i] != serial[cell_indices[c][i]])
+          same_numbering = false;
+      ++c;
+    }
+  deallog << "renumbering applied: " << (same_numbering ? "ok" : "wrong")
+          << std::endl;
+  deallog << "nested dissection profile: " << compute_profile(dof_handler)
+          << std::endl;
+
+  DoFRenumbering::Cuthill_McKee(dof_handler, false, use_constraints);
+  deallog << "Cuthill-McKee profile: " << compute_profile(dof_handler)
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(4, false);
+  test<2>(4, true);
+  test<3>(2, false);
+  test<3>(2, true);
+}
@@ -0,0 +1,145 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that DoFTools::make_compressed_sparsity_pattern() produces the same
+// pattern as DoFTools::make_sparsity_pattern() followed by
+// SparsityPattern::copy_from() on adaptively refined meshes with hanging
+// node constraints, for hp and vector-valued elements, with and without
+// keeping constrained entries, and for different numbers of threads.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+check(const DoFHandler<dim> &dof)
+{
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  constraints.close();
+
+  for (const bool keep_constrained_dofs : {true, false})
+    {
+      SparsityPattern reference;
+      {
+        DynamicSparsityPattern dsp(dof.n_dofs());
+        DoFTools::make_sparsity_pattern(dof,
+                                        dsp,
+                                        constraints,
+                                        keep_constrained_dofs);
+        reference.copy_from(dsp);
+      }
+
+      for (const unsigned int n_threads : {1U, 3U, 8U})
+        {
+          MultithreadInfo::set_thread_limit(n_threads);
+
+          SparsityPattern sparsity;
+          DoFTools::make_compressed_sparsity_pattern(dof,
+                                                     sparsity,
+                                                     constraints,
+                                                     keep_constrained_dofs);
+
+          bool same = sparsity.is_compressed() &&
+                      sparsity.n_rows() == reference.n_rows() &&
+                      sparsity.n_nonzero_elements() ==
+                        reference.n_nonzero_elements();
+          for (unsigned int row = 0; same && row < reference.n_rows(); ++row)
+            {
+              if (sparsity.row_length(row) != reference.row_length(row))
+                same = false;
+              for (unsigned int k = 0; same && k < reference.row_length(row);
+                   ++k)
+                if (sparsity.column_number(row, k) !=
+                    reference.column_number(row, k))
+                  same = false;
+            }
+
+          deallog << "keep constrained: " << keep_constrained_dofs
+                  << ", threads: " << n_threads
+                  << ", entries: " << sparsity.n_nonzero_elements()
+                  << (same ? ", same" : ", different") << std::endl;
+        }
+    }
+  MultithreadInfo::set_thread_limit();
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(dim == 2 ? 5 : 3);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] < 0.3)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  {
+    deallog << "dim=" << dim << ", FE_Q(2)" << std::endl;
+    DoFHandler<dim> dof(tria);
+    dof.distribute_dofs(FE_Q<dim>(2));
+    check(dof);
+  }
+
+  {
+    deallog << "dim=" << dim << ", FESystem(FE_Q(1), dim)" << std::endl;
+    DoFHandler<dim> dof(tria);
+    dof.distribute_dofs(FESystem<dim>(FE_Q<dim>(1), dim));
+    check(dof);
+  }
+
+  {
+    deallog << "dim=" << dim << ", hp FE_Q(1..3)" << std::endl;
+    hp::FECollection<dim> fe_collection;
+    for (unsigned int degree = 1; degree <= 3; ++degree)
+      fe_collection.push_back(FE_Q<dim>(degree));
+    DoFHandler<dim> dof(tria);
+    for (const auto &cell : dof.active_cell_iterators())
+      cell->set_active_fe_index(cell->active_cell_index() % 3);
+    dof.distribute_dofs(fe_collection);
+    check(dof);
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,292 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Write the same mesh as a Gmsh 4.1 file in ASCII and in binary form, read
+// both versions with GridIn::read_msh() and check that they result in the
+// same triangulation. The mesh is large enough for the binary reader to
+// split the nodes and elements into several chunks. The files start with a
+// comment block, which must be skipped before detecting the binary format.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_in.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include <sstream>
+
+#include "../tests.h"
+
+
+// the tags of the nodes are not consecutive and start at a value other than
+// one
+std::size_t
+node_tag(const unsigned int vertex)
+{
+  return 2 * vertex + 5;
+}
+
+
+
+template <typename T>
+void
+write_binary(std::ostream &out, const T value)
+{
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+
+
+// Write the active cells of the given triangulation in Gmsh format 4.1. The
+// cells get the physical tag 3, the faces at x=0 the physical tag 7, all
+// other boundary faces are not listed.
+template <int dim>
+void
+write_msh(const Triangulation<dim> &tria, std::ostream &out, const bool binary)
+{
+  // the order in which GridIn::read_msh() expects the vertices of a cell
+  const std::vector<unsigned int> cell_vertices =
+    (dim == 2 ? std::vector<unsigned int>{0, 1, 3, 2} :
+                std::vector<unsigned int>{0, 1, 5, 4, 2, 3, 7, 6});
+  const std::vector<unsigned int> face_vertices =
+    (dim == 2 ? std::vector<unsigned int>{0, 1} :
+                std::vector<unsigned int>{0, 1, 3, 2});
+
+  std::vector<std::vector<std::size_t>> cells, faces;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      cells.emplace_back();
+      for (const unsigned int v : cell_vertices)
+        cells.back().push_back(node_tag(cell->vertex_index(v)));
+      for (const auto &face : cell->face_iterators())
+        if (face->at_boundary() && std::abs(face->center()[0]) < 1e-10)
+          {
+            faces.emplace_back();
+            for (const unsigned int v : face_vertices)
+              faces.back().push_back(node_tag(face->vertex_index(v)));
+          }
+    }
+
+  const std::size_t n_nodes = tria.n_vertices();
+  // split the nodes into two blocks
+  const std::size_t block_sizes[2] = {n_nodes / 3, n_nodes - n_nodes / 3};
+
+  out << "$Comments\nwritten by grid_in_msh_binary_01\n$EndComments\n";
+  out << "$MeshFormat\n4.1 " << (binary ? 1 : 0) << ' ' << sizeof(std::size_t)
+      << '\n';
+  if (binary)
+    {
+      write_binary(out, int(1));
+      out << '\n';
+    }
+  out << "$EndMeshFormat\n";
+
+  // a section the reader does not need
+  out << "$PhysicalNames\n2\n" << dim - 1 << " 7 \"left\"\n"
+      << dim << " 3 \"domain\"\n$EndPhysicalNames\n";
+
+  // one entity for the boundary faces with physical tag 7 and one entity for
+  // the cells with physical tag 3
+  out << "$Entities\n";
+  std::size_t n_entities[4] = {0, 0, 0, 0};
+  n_entities[dim - 1]       = 1;
+  n_entities[dim]           = 1;
+  if (binary)
+    {
+      for (const std::size_t n : n_entities)
+        write_binary(out, n);
+      for (const int d : {dim - 1, dim})
+        {
+          write_binary(out, int(1));
+          for (unsigned int i = 0; i < 6; ++i)
+            write_binary(out, i < 3 ? 0. : 1.);
+          write_binary(out, std::size_t(1));
+          write_binary(out, int(d == dim ? 3 : 7));
+          write_binary(out, std::size_t(d == dim ? 1 : 0));
+          if (d == dim)
+            write_binary(out, int(1));
+        }
+      out << '\n';
+    }
+  else
+    {
+      out << n_entities[0] << ' ' << n_entities[1] << ' ' << n_entities[2]
+          << ' ' << n_entities[3] << '\n';
+      out << "1 0 0 0 1 1 1 1 7 0\n";
+      out << "1 0 0 0 1 1 1 1 3 1 1\n";
+    }
+  out << "$EndEntities\n";
+
+  out << "$Nodes\n";
+  if (binary)
+    {
+      write_binary(out, std::size_t(2));
+      write_binary(out, n_nodes);
+      write_binary(out, node_tag(0));
+      write_binary(out, node_tag(n_nodes - 1));
+    }
+  else
+    out << "2 " << n_nodes << ' ' << node_tag(0) << ' '
+        << node_tag(n_nodes - 1) << '\n';
+  std::size_t first_node = 0;
+  for (const std::size_t block_size : block_sizes)
+    {
+      if (binary)
+        {
+          write_binary(out, int(dim));
+          write_binary(out, int(1));
+          write_binary(out, int(0));
+          write_binary(out, block_size);
+          for (std::size_t i = first_node; i < first_node + block_size; ++i)
+            write_binary(out, node_tag(i));
+          for (std::size_t i = first_node; i < first_node + block_size; ++i)
+            for (unsigned int d = 0; d < 3; ++d)
+              write_binary(out, d < dim ? tria.get_vertices()[i][d] : 0.);
+        }
+      else
+        {
+          out << dim << " 1 0 " << block_size << '\n';
+          for (std::size_t i = first_node; i < first_node + block_size; ++i)
+            out << node_tag(i) << '\n';
+          for (std::size_t i = first_node; i < first_node + block_size; ++i)
+            {
+              for (unsigned int d = 0; d < 3; ++d)
+                out << (d < dim ? tria.get_vertices()[i][d] : 0.) << ' ';
+              out << '\n';
+            }
+        }
+      first_node += block_size;
+    }
+  if (binary)
+    out << '\n';
+  out << "$EndNodes\n";
+
+  out << "$Elements\n";
+  const std::size_t n_elements = faces.size() + cells.size();
+  if (binary)
+    {
+      write_binary(out, std::size_t(2));
+      write_binary(out, n_elements);
+      write_binary(out, std::size_t(1));
+      write_binary(out, n_elements);
+    }
+  else
+    out << "2 " << n_elements << " 1 " << n_elements << '\n';
+  std::size_t element_tag = 1;
+  for (const int d : {dim - 1, dim})
+    {
+      const auto &elements  = (d == dim ? cells : faces);
+      const int   cell_type =
+        (d == dim ? (dim == 2 ? 3 : 5) : (dim == 2 ? 1 : 3));
+      if (binary)
+        {
+          write_binary(out, d);
+          write_binary(out, int(1));
+          write_binary(out, cell_type);
+          write_binary(out, elements.size());
+        }
+      else
+        out << d << " 1 " << cell_type << ' ' << elements.size() << '\n';
+      for (const auto &element : elements)
+        {
+          if (binary)
+            {
+              write_binary(out, element_tag);
+              for (const std::size_t tag : element)
+                write_binary(out, tag);
+            }
+          else
+            {
+              out << element_tag;
+              for (const std::size_t tag : element)
+                out << ' ' << tag;
+              out << '\n';
+            }
+          ++element_tag;
+        }
+    }
+  if (binary)
+    out << '\n';
+  out << "$EndElements\n";
+}
+
+
+
+template <int dim>
+void
+test(const unsigned int n_subdivisions)
+{
+  Triangulation<dim> original;
+  GridGenerator::subdivided_hyper_cube(original, n_subdivisions);
+
+  Triangulation<dim> tria[2];
+  for (unsigned int binary = 0; binary < 2; ++binary)
+    {
+      std::stringstream file;
+      file << std::setprecision(17);
+      write_msh(original, file, binary == 1);
+
+      GridIn<dim> grid_in;
+      grid_in.attach_triangulation(tria[binary]);
+      grid_in.read_msh(file);
+    }
+
+  deallog << "dim=" << dim << ": " << tria[1].n_active_cells() << " cells, "
+          << tria[1].n_vertices() << " vertices" << std::endl;
+
+  bool same = (tria[0].n_active_cells() == tria[1].n_active_cells() &&
+               tria[0].get_vertices() == tria[1].get_vertices());
+  std::map<types::boundary_id, unsigned int> boundary_faces;
+  std::map<types::material_id, unsigned int> material_ids;
+  if (same)
+    for (auto cell        = tria[0].begin_active(),
+              binary_cell = tria[1].begin_active();
+         cell != tria[0].end();
+         ++cell, ++binary_cell)
+      {
+        if (cell->material_id() != binary_cell->material_id())
+          same = false;
+        ++material_ids[binary_cell->material_id()];
+        for (const unsigned int v : cell->vertex_indices())
+          if (cell->vertex_index(v) != binary_cell->vertex_index(v))
+            same = false;
+        for (const unsigned int f : cell->face_indices())
+          if (cell->face(f)->at_boundary())
+            {
+              if (cell->face(f)->boundary_id() !=
+                  binary_cell->face(f)->boundary_id())
+                same = false;
+              ++boundary_faces[binary_cell->face(f)->boundary_id()];
+            }
+      }
+  deallog << "ASCII and binary file give the same mesh: "
+          << (same ? "ok" : "wrong") << std::endl;
+
+  for (const auto &[id, n] : material_ids)
+    deallog << "material_id " << id << ": " << n << " cells" << std::endl;
+  for (const auto &[id, n] : boundary_faces)
+    deallog << "boundary_id " << id << ": " << n << " faces" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(80);
+  test<3>(20);
+}
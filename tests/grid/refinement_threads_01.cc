@@ -0,0 +1,86 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Triangulation::execute_coarsening_and_refinement() computes the neighbor
+// information and the vertex index cache in parallel over chunks of cells.
+// Check that adaptive refinement and coarsening give the same neighbors and
+// vertices with several threads as with a single thread, on meshes large
+// enough to be split into several chunks.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+std::vector<int>
+refine_and_collect(const unsigned int n_threads)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube(tria, dim == 2 ? 48 : 12);
+  for (unsigned int step = 0; step < 3; ++step)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->center().norm() < 0.5 - 0.15 * step)
+          cell->set_refine_flag();
+        else if (cell->level() > 0 && cell->center()[0] > 0.3 - 0.1 * step)
+          cell->set_coarsen_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  // collect the neighbors and vertex indices of all cells
+  std::vector<int> data;
+  for (const auto &cell : tria.cell_iterators())
+    {
+      for (const unsigned int f : cell->face_indices())
+        {
+          data.push_back(cell->neighbor_level(f));
+          data.push_back(cell->neighbor_index(f));
+        }
+      for (const unsigned int v : cell->vertex_indices())
+        data.push_back(static_cast<int>(cell->vertex_index(v)));
+    }
+  deallog << "dim=" << dim << (n_threads == 1 ? " serial" : " threaded")
+          << " active cells: " << tria.n_active_cells() << std::endl;
+  return data;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const std::vector<int> serial = refine_and_collect<dim>(1);
+  const std::vector<int> threaded =
+    refine_and_collect<dim>(std::max(2U, testing_max_num_threads()));
+  deallog << "dim=" << dim << " neighbors and vertices "
+          << (serial == threaded ? "ok" : "wrong") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
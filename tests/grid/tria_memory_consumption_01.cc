@@ -0,0 +1,115 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check the values of the user data, the level subdomain ids and the global
+// cell indices of a serial triangulation through refinement and coarsening,
+// and that Triangulation::print_memory_consumption() reports the same total
+// as Triangulation::memory_consumption().
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  // user data is zero initially
+  bool ok = true;
+  for (const auto &cell : tria.cell_iterators())
+    {
+      ok = ok && cell->user_index() == 0;
+      if constexpr (dim > 1)
+        for (const auto &face : cell->face_iterators())
+          ok = ok && face->user_index() == 0;
+    }
+  deallog << "dim=" << dim << " user data read: " << (ok ? "ok" : "wrong")
+          << std::endl;
+
+  // write user data and read it back
+  for (const auto &cell : tria.active_cell_iterators())
+    cell->set_user_index(cell->active_cell_index() + 1);
+  ok = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    ok = ok && cell->user_index() == cell->active_cell_index() + 1;
+  deallog << "dim=" << dim << " user data write: " << (ok ? "ok" : "wrong")
+          << std::endl;
+
+  // refinement keeps the user data of existing cells
+  tria.begin_active()->set_refine_flag();
+  std::next(tria.begin_active())->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+  ok = true;
+  for (const auto &cell : tria.cell_iterators_on_level(2))
+    ok = ok && cell->user_index() > 0;
+  deallog << "dim=" << dim << " user data after refinement: "
+          << (ok ? "ok" : "wrong") << std::endl;
+
+  tria.clear_user_data();
+  for (const auto &cell : tria.active_cell_iterators())
+    ok = ok && cell->user_index() == 0;
+  deallog << "dim=" << dim << " user data cleared: " << (ok ? "ok" : "wrong")
+          << std::endl;
+
+  // coarsening leaves unused cells behind, which must be skipped by the
+  // global level cell indices
+  for (const auto &child : tria.begin(2)->child_iterators())
+    child->set_coarsen_flag();
+  tria.execute_coarsening_and_refinement();
+  for (unsigned int l = 0; l < tria.n_levels(); ++l)
+    {
+      types::global_cell_index index = 0;
+      for (const auto &cell : tria.cell_iterators_on_level(l))
+        ok = ok && cell->global_level_cell_index() == index++;
+    }
+  for (const auto &cell : tria.active_cell_iterators())
+    ok = ok && cell->global_active_cell_index() == cell->active_cell_index();
+  deallog << "dim=" << dim << " global cell indices: " << (ok ? "ok" : "wrong")
+          << std::endl;
+
+  // level subdomain ids default to zero
+  const auto cell = std::next(tria.begin(1));
+  cell->set_level_subdomain_id(3);
+  for (const auto &c : tria.cell_iterators())
+    ok = ok && c->level_subdomain_id() == (c == cell ? 3 : 0);
+  deallog << "dim=" << dim << " level subdomain ids: " << (ok ? "ok" : "wrong")
+          << std::endl;
+
+  // the total printed by print_memory_consumption() is the last entry
+  std::ostringstream stream;
+  tria.print_memory_consumption(stream);
+  const std::string output = stream.str();
+  const std::string total =
+    output.substr(output.find("total:") + std::string("total:").size());
+  deallog << "dim=" << dim << " print_memory_consumption: "
+          << (std::stoul(total) == tria.memory_consumption() ? "ok" : "wrong")
+          << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
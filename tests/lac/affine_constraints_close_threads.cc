@@ -0,0 +1,110 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check AffineConstraints::close() and AffineConstraints::distribute() with
+// several threads for a large set of randomly generated constraints with
+// long chains: the constraints must be the same as the ones obtained with a
+// single thread, and distributed vectors must satisfy the original
+// constraints.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int n_dofs = 100000;
+
+  // constrain about a third of the dofs to up to three distinct dofs with
+  // smaller indices, which may be constrained themselves, so that there are
+  // no cycles. also add lines that are only constrained to an inhomogeneity.
+  std::vector<
+    std::pair<unsigned int,
+              std::pair<std::vector<std::pair<types::global_dof_index, double>>,
+                        double>>>
+    original_lines;
+  for (unsigned int i = 150; i < n_dofs; ++i)
+    if (Testing::rand() % 3 == 0)
+      {
+        std::vector<std::pair<types::global_dof_index, double>> entries;
+        const unsigned int n_entries = Testing::rand() % 4;
+        for (unsigned int e = 0; e < n_entries; ++e)
+          entries.emplace_back(i - 1 - 50 * e - Testing::rand() % 50,
+                               random_value<double>());
+        original_lines.emplace_back(
+          i, std::make_pair(entries, random_value<double>()));
+      }
+
+  // insert the lines in reverse order, so that close() needs to sort them
+  AffineConstraints<double> constraints_serial, constraints_parallel;
+  for (auto line = original_lines.rbegin(); line != original_lines.rend();
+       ++line)
+    {
+      constraints_serial.add_constraint(line->first,
+                                        line->second.first,
+                                        line->second.second);
+      constraints_parallel.add_constraint(line->first,
+                                          line->second.first,
+                                          line->second.second);
+    }
+
+  MultithreadInfo::set_thread_limit(1);
+  constraints_serial.close();
+  MultithreadInfo::set_thread_limit(4);
+  constraints_parallel.close();
+
+  deallog << "Number of constraints: " << constraints_parallel.n_constraints()
+          << std::endl;
+
+  const auto  &lines_serial   = constraints_serial.get_lines();
+  const auto  &lines_parallel = constraints_parallel.get_lines();
+  bool         same           = (lines_serial.size() == lines_parallel.size());
+  unsigned int n_entries      = 0;
+  for (unsigned int i = 0; same && i < lines_serial.size(); ++i)
+    {
+      const auto &line_serial   = lines_serial[i];
+      const auto &line_parallel = lines_parallel[i];
+      same = line_serial.index == line_parallel.index &&
+             line_serial.entries == line_parallel.entries &&
+             line_serial.inhomogeneity == line_parallel.inhomogeneity;
+      n_entries += line_parallel.entries.size();
+    }
+  deallog << "Number of entries: " << n_entries << std::endl;
+  deallog << "Serial and parallel close(): " << (same ? "same" : "different")
+          << std::endl;
+
+  Vector<double> vec(n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    vec(i) = random_value<double>();
+  constraints_parallel.distribute(vec);
+
+  // check the original, unresolved constraints on the distributed vector
+  double error = 0;
+  for (const auto &line : original_lines)
+    {
+      double value = line.second.second;
+      for (const auto &entry : line.second.first)
+        value += entry.second * vec(entry.first);
+      error = std::max(error, std::abs(vec(line.first) - value));
+    }
+  deallog << "Constraints satisfied: " << (error < 1e-10 ? "yes" : "no")
+          << std::endl;
+}
@@ -0,0 +1,158 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check BatchedFullMatrix against FullMatrix: matrix-vector and
+// matrix-matrix products, the LU factorization with pivoting, the Cholesky
+// factorization, and the inversion, for sizes given at run time and at
+// compile time and a number of matrices that is not a multiple of the SIMD
+// width.
+
+
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/batched_full_matrix.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <int n_static>
+void
+test(const unsigned int size)
+{
+  using Number                 = VectorizedArray<double>;
+  constexpr unsigned int width = Number::size();
+
+  const unsigned int n_matrices = 2 * width + 1;
+  const unsigned int n_batches  = (n_matrices + width - 1) / width;
+
+  // a general matrix with a small entry in the top left corner that
+  // requires pivoting, and a symmetric positive definite matrix
+  std::vector<FullMatrix<double>> matrices(n_matrices,
+                                           FullMatrix<double>(size, size));
+  std::vector<FullMatrix<double>> spd_matrices(n_matrices,
+                                               FullMatrix<double>(size, size));
+  for (unsigned int m = 0; m < n_matrices; ++m)
+    {
+      for (unsigned int i = 0; i < size; ++i)
+        for (unsigned int j = 0; j < size; ++j)
+          matrices[m](i, j) = random_value<double>(-1., 1.);
+      matrices[m](0, 0) = 1e-3 * random_value<double>();
+      spd_matrices[m].Tmmult(matrices[m], matrices[m]);
+      for (unsigned int i = 0; i < size; ++i)
+        spd_matrices[m](i, i) += 1.;
+    }
+
+  BatchedFullMatrix<Number, n_static> batched(n_matrices, size, size);
+  BatchedFullMatrix<Number, n_static> batched_spd(n_matrices, size, size);
+  for (unsigned int m = 0; m < n_matrices; ++m)
+    {
+      batched.set_matrix(m, matrices[m]);
+      batched_spd.set_matrix(m, spd_matrices[m]);
+    }
+
+  AlignedVector<Number> src(n_batches * size), dst(n_batches * size);
+  for (unsigned int b = 0; b < n_batches; ++b)
+    for (unsigned int i = 0; i < size; ++i)
+      for (unsigned int v = 0; v < width; ++v)
+        src[b * size + i][v] = random_value<double>();
+
+  const auto compare_vectors = [&](const std::vector<FullMatrix<double>> &A,
+                                   const bool apply_inverse) {
+    double error = 0;
+    for (unsigned int m = 0; m < n_matrices; ++m)
+      {
+        Vector<double> x(size), y(size);
+        for (unsigned int i = 0; i < size; ++i)
+          x(i) = src[(m / width) * size + i][m % width];
+        if (apply_inverse)
+          {
+            FullMatrix<double> inverse(size, size);
+            inverse.invert(A[m]);
+            inverse.vmult(y, x);
+          }
+        else
+          A[m].vmult(y, x);
+        for (unsigned int i = 0; i < size; ++i)
+          error = std::max(
+            error, std::abs(y(i) - dst[(m / width) * size + i][m % width]));
+      }
+    return error;
+  };
+
+  deallog << "Size " << size << (n_static > 0 ? " (static)" : " (runtime)")
+          << std::endl;
+
+  batched.vmult(make_array_view(dst), make_array_view(src));
+  deallog << "vmult: " << (compare_vectors(matrices, false) < 1e-12 ? "ok" :
+                                                                       "wrong")
+          << std::endl;
+
+  BatchedFullMatrix<Number, n_static> product;
+  batched.mmult(product, batched_spd);
+  double error = 0;
+  for (unsigned int m = 0; m < n_matrices; ++m)
+    {
+      FullMatrix<double> reference(size, size), result;
+      matrices[m].mmult(reference, spd_matrices[m]);
+      product.get_matrix(m, result);
+      result.add(-1., reference);
+      error = std::max(error, result.frobenius_norm());
+    }
+  deallog << "mmult: " << (error < 1e-12 ? "ok" : "wrong") << std::endl;
+
+  // LU factorization with pivoting and solve
+  BatchedFullMatrix<Number, n_static> batched_lu = batched;
+  batched_lu.compute_lu_factorization();
+  dst = src;
+  batched_lu.solve(make_array_view(dst));
+  deallog << "LU solve: " << (compare_vectors(matrices, true) < 1e-8 ? "ok" :
+                                                                        "wrong")
+          << std::endl;
+
+  // Cholesky factorization and solve
+  BatchedFullMatrix<Number, n_static> batched_cholesky = batched_spd;
+  batched_cholesky.compute_cholesky_factorization();
+  dst = src;
+  batched_cholesky.solve(make_array_view(dst));
+  deallog << "Cholesky solve: "
+          << (compare_vectors(spd_matrices, true) < 1e-10 ? "ok" : "wrong")
+          << std::endl;
+
+  // inversion via LU and via an existing Cholesky factorization
+  batched.invert();
+  batched.vmult(make_array_view(dst), make_array_view(src));
+  deallog << "invert (LU): "
+          << (compare_vectors(matrices, true) < 1e-8 ? "ok" : "wrong")
+          << std::endl;
+
+  batched_cholesky.invert();
+  batched_cholesky.vmult(make_array_view(dst), make_array_view(src));
+  deallog << "invert (Cholesky): "
+          << (compare_vectors(spd_matrices, true) < 1e-10 ? "ok" : "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<-1>(5);
+  test<3>(3);
+  test<8>(8);
+}
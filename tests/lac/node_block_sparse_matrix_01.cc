@@ -0,0 +1,157 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check NodeBlockSparsityPattern and NodeBlockSparseMatrix for a
+// vector-valued FESystem on an adaptively refined mesh with hanging nodes:
+// the pattern is built with DoFTools::make_sparsity_pattern, the matrix is
+// assembled with AffineConstraints::distribute_local_to_global, and the
+// entries and matrix-vector products are compared to SparseMatrix.
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/node_block_sparse_matrix.h>
+#include <deal.II/lac/node_block_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int degree)
+{
+  deallog << "dim=" << dim << ", degree=" << degree << std::endl;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(1);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FESystem<dim>   fe(FE_Q<dim>(degree), dim);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  constraints.close();
+
+  SparsityPattern          sparsity;
+  NodeBlockSparsityPattern node_sparsity(dof.n_dofs(), dof.n_dofs(), dim);
+  {
+    DynamicSparsityPattern dsp(dof.n_dofs(), dof.n_dofs());
+    DoFTools::make_sparsity_pattern(dof, dsp, constraints, false);
+    sparsity.copy_from(dsp);
+  }
+  DoFTools::make_sparsity_pattern(dof, node_sparsity, constraints, false);
+  node_sparsity.compress();
+
+  bool pattern_ok = true;
+  for (unsigned int i = 0; i < sparsity.n_rows(); ++i)
+    for (auto entry = sparsity.begin(i); entry != sparsity.end(i); ++entry)
+      if (!node_sparsity.exists(i, entry->column()))
+        pattern_ok = false;
+  deallog << "Entries: " << sparsity.n_nonzero_elements()
+          << ", blocks: " << node_sparsity.n_nonzero_blocks()
+          << ", entries in blocks: " << node_sparsity.n_nonzero_elements()
+          << ", pattern " << (pattern_ok ? "ok" : "wrong") << std::endl;
+
+  SparseMatrix<double>               sparse(sparsity);
+  NodeBlockSparseMatrix<double, dim> node_sparse(node_sparsity);
+
+  // assemble a nonsymmetric matrix with random values but a dominant
+  // diagonal
+  FullMatrix<double> local_matrix(fe.dofs_per_cell, fe.dofs_per_cell);
+  std::vector<types::global_dof_index> local_dof_indices(fe.dofs_per_cell);
+  for (const auto &cell : dof.active_cell_iterators())
+    {
+      for (unsigned int i = 0; i < fe.dofs_per_cell; ++i)
+        for (unsigned int j = 0; j < fe.dofs_per_cell; ++j)
+          local_matrix(i, j) = random_value<double>() + (i == j ? 10. : 0.);
+      cell->get_dof_indices(local_dof_indices);
+      constraints.distribute_local_to_global(local_matrix,
+                                             local_dof_indices,
+                                             sparse);
+      constraints.distribute_local_to_global(local_matrix,
+                                             local_dof_indices,
+                                             node_sparse);
+    }
+
+  double difference = 0.;
+  for (unsigned int i = 0; i < sparse.m(); ++i)
+    for (unsigned int j = 0; j < sparse.n(); ++j)
+      difference += std::abs(sparse.el(i, j) - node_sparse.el(i, j));
+  deallog << "Difference between entries: " << difference << std::endl;
+
+  Vector<double> src(dof.n_dofs()), dst(dof.n_dofs()), reference(dof.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  sparse.vmult(reference, src);
+  node_sparse.vmult(dst, src);
+  dst -= reference;
+  deallog << "vmult: " << (dst.linfty_norm() < 1e-12 ? "ok" : "wrong")
+          << std::endl;
+
+  dst = src;
+  node_sparse.vmult_add(dst, src);
+  dst -= src;
+  dst -= reference;
+  deallog << "vmult_add: " << (dst.linfty_norm() < 1e-12 ? "ok" : "wrong")
+          << std::endl;
+
+  sparse.Tvmult(reference, src);
+  node_sparse.Tvmult(dst, src);
+  dst -= reference;
+  deallog << "Tvmult: " << (dst.linfty_norm() < 1e-12 ? "ok" : "wrong")
+          << std::endl;
+
+  dst = src;
+  node_sparse.Tvmult_add(dst, src);
+  dst -= src;
+  dst -= reference;
+  deallog << "Tvmult_add: " << (dst.linfty_norm() < 1e-12 ? "ok" : "wrong")
+          << std::endl;
+
+  sparse.precondition_Jacobi(reference, src, 0.7);
+  node_sparse.precondition_Jacobi(dst, src, 0.7);
+  dst -= reference;
+  deallog << "precondition_Jacobi: "
+          << (dst.linfty_norm() < 1e-12 ? "ok" : "wrong") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(1);
+  test<2>(2);
+  test<3>(1);
+  test<3>(2);
+}
@@ -0,0 +1,187 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check SlicedEllpackMatrix against SparseMatrix for a symmetric matrix with
+// strongly varying row lengths and a number of rows that is not a multiple
+// of the chunk size, for various values of sigma.
+
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename Number>
+void
+test(const unsigned int size)
+{
+  // a symmetric and diagonally dominant matrix with a random number of
+  // off-diagonal entries per row
+  DynamicSparsityPattern dsp(size, size);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      dsp.add(i, i);
+      const unsigned int n_entries = Testing::rand() % ((i % 5 == 0) ? 20 : 4);
+      for (unsigned int k = 0; k < n_entries; ++k)
+        {
+          const unsigned int j = Testing::rand() % size;
+          dsp.add(i, j);
+          dsp.add(j, i);
+        }
+    }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<Number> matrix(sparsity);
+  for (unsigned int i = 0; i < size; ++i)
+    for (auto entry = sparsity.begin(i); entry != sparsity.end(i); ++entry)
+      if (entry->column() > i)
+        {
+          const Number value = -random_value<Number>();
+          matrix.set(i, entry->column(), value);
+          matrix.set(entry->column(), i, value);
+          matrix.add(i, i, -value);
+          matrix.add(entry->column(), entry->column(), -value);
+        }
+  for (unsigned int i = 0; i < size; ++i)
+    matrix.add(i, i, Number(1.));
+
+  Vector<Number> src(size), dst(size), reference(size);
+  for (unsigned int i = 0; i < size; ++i)
+    src(i) = random_value<Number>();
+
+  const Number tolerance = 100 * std::numeric_limits<Number>::epsilon();
+
+  for (const unsigned int sigma : {1, 8, 32, 1000})
+    {
+      SlicedEllpackMatrix<Number> sell(matrix, sigma);
+      deallog << "sigma=" << sigma << ": m=" << sell.m() << " n=" << sell.n()
+              << " nnz=" << sell.n_nonzero_elements() << " stored entries "
+              << (sell.n_stored_elements() >= sell.n_nonzero_elements() ?
+                    "ok" :
+                    "wrong")
+              << std::endl;
+
+      bool entries_ok = true;
+      for (unsigned int i = 0; i < size; ++i)
+        {
+          if (sell.diag_element(i) != matrix.diag_element(i))
+            entries_ok = false;
+          for (unsigned int j = 0; j < size; j += 7)
+            if (sell.el(i, j) != matrix.el(i, j))
+              entries_ok = false;
+        }
+      deallog << "el: " << (entries_ok ? "ok" : "wrong") << std::endl;
+
+      matrix.vmult(reference, src);
+      sell.vmult(dst, src);
+      dst -= reference;
+      deallog << "vmult: "
+              << (dst.linfty_norm() < tolerance * reference.linfty_norm() ?
+                    "ok" :
+                    "wrong")
+              << std::endl;
+
+      dst = src;
+      sell.vmult_add(dst, src);
+      dst -= src;
+      dst -= reference;
+      deallog << "vmult_add: "
+              << (dst.linfty_norm() < tolerance * reference.linfty_norm() ?
+                    "ok" :
+                    "wrong")
+              << std::endl;
+
+      matrix.Tvmult(reference, src);
+      sell.Tvmult(dst, src);
+      dst -= reference;
+      deallog << "Tvmult: "
+              << (dst.linfty_norm() < tolerance * reference.linfty_norm() ?
+                    "ok" :
+                    "wrong")
+              << std::endl;
+
+      dst = src;
+      sell.Tvmult_add(dst, src);
+      dst -= src;
+      dst -= reference;
+      deallog << "Tvmult_add: "
+              << (dst.linfty_norm() < tolerance * reference.linfty_norm() ?
+                    "ok" :
+                    "wrong")
+              << std::endl;
+
+      matrix.precondition_Jacobi(reference, src, 0.8);
+      sell.precondition_Jacobi(dst, src, 0.8);
+      dst -= reference;
+      deallog << "precondition_Jacobi: "
+              << (dst.linfty_norm() < tolerance * reference.linfty_norm() ?
+                    "ok" :
+                    "wrong")
+              << std::endl;
+    }
+
+  // use the matrix within a solver and a Chebyshev preconditioner
+  SlicedEllpackMatrix<Number> sell(matrix);
+  Vector<Number>              solution(size), solution_reference(size);
+  unsigned int                iterations[2];
+  {
+    PreconditionChebyshev<SparseMatrix<Number>, Vector<Number>> precondition;
+    precondition.initialize(matrix);
+    SolverControl            control(200, 1e-4 * src.l2_norm(), false, false);
+    SolverCG<Vector<Number>> solver(control);
+    solver.solve(matrix, solution_reference, src, precondition);
+    iterations[0] = control.last_step();
+  }
+  {
+    PreconditionChebyshev<SlicedEllpackMatrix<Number>, Vector<Number>>
+      precondition;
+    precondition.initialize(sell);
+    SolverControl            control(200, 1e-4 * src.l2_norm(), false, false);
+    SolverCG<Vector<Number>> solver(control);
+    solver.solve(sell, solution, src, precondition);
+    iterations[1] = control.last_step();
+  }
+  solution -= solution_reference;
+  deallog << "SolverCG with PreconditionChebyshev: iterations "
+          << (iterations[1] <= iterations[0] + 1 ? "ok" : "wrong")
+          << ", solution "
+          << (solution.linfty_norm() < 1e-3 * solution_reference.linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("float");
+  test<float>(103);
+  deallog.pop();
+
+  deallog.push("double");
+  test<double>(103);
+  test<double>(1000);
+  deallog.pop();
+}
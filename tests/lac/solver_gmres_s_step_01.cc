@@ -0,0 +1,217 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check the s-step variant of SolverGMRES with the monomial and Newton
+// bases against the standard variant for a non-symmetric matrix, including
+// restarts, left and right preconditioning with the identity, SSOR and
+// Jacobi preconditioners, and the generic path for block vectors.
+
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+// A 1d convection-diffusion operator with an upwind discretization of the
+// convective term, written in terms of element access so that it works with
+// all vector types
+struct MyMatrix
+{
+  static double
+  diagonal(const unsigned int i)
+  {
+    return 3. + 0.1 * (i % 7);
+  }
+
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    const unsigned int n = src.size();
+    for (unsigned int i = 0; i < n; ++i)
+      {
+        double sum = diagonal(i) * src(i);
+        if (i > 0)
+          sum -= 2. * src(i - 1);
+        if (i + 1 < n)
+          sum -= src(i + 1);
+        dst(i) = sum;
+      }
+  }
+};
+
+
+
+// The same operator as MyMatrix, stored as a sparse matrix such that the
+// preconditioners of the library can be applied
+void
+fill_sparse_matrix(const unsigned int    size,
+                   SparsityPattern      &sparsity,
+                   SparseMatrix<double> &matrix)
+{
+  sparsity.reinit(size, size, 3);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      if (i > 0)
+        sparsity.add(i, i - 1);
+      if (i + 1 < size)
+        sparsity.add(i, i + 1);
+    }
+  sparsity.compress();
+
+  matrix.reinit(sparsity);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      matrix.set(i, i, MyMatrix::diagonal(i));
+      if (i > 0)
+        matrix.set(i, i - 1, -2.);
+      if (i + 1 < size)
+        matrix.set(i, i + 1, -1.);
+    }
+}
+
+
+
+template <typename VectorType>
+void
+reinit_vector(VectorType &vector, const unsigned int size)
+{
+  vector.reinit(size);
+}
+
+
+
+void
+reinit_vector(BlockVector<double> &vector, const unsigned int size)
+{
+  vector.reinit(std::vector<types::global_dof_index>{size / 2,
+                                                     size - size / 2});
+}
+
+
+
+template <typename VectorType,
+          typename MatrixType         = MyMatrix,
+          typename PreconditionerType = PreconditionIdentity>
+void
+test(const unsigned int        size,
+     const unsigned int        basis_size,
+     const bool                right_preconditioning,
+     const MatrixType         &matrix         = MatrixType(),
+     const PreconditionerType &preconditioner = PreconditionerType())
+{
+  deallog << "Size " << size << ", basis size " << basis_size
+          << (right_preconditioning ? ", right" : ", left")
+          << " preconditioning" << std::endl;
+
+  VectorType rhs, reference, solution;
+  reinit_vector(rhs, size);
+  reinit_vector(reference, size);
+  reinit_vector(solution, size);
+  for (unsigned int i = 0; i < size; ++i)
+    rhs(i) = 1. + 0.01 * i;
+
+  typename SolverGMRES<VectorType>::AdditionalData data(basis_size,
+                                                        right_preconditioning);
+
+  unsigned int reference_iterations = 0;
+  {
+    SolverControl           control(500, 1e-10 * rhs.l2_norm(), false, false);
+    SolverGMRES<VectorType> solver(control, data);
+    solver.solve(matrix, reference, rhs, preconditioner);
+    reference_iterations = control.last_step();
+    deallog << "Standard GMRES iterations: " << reference_iterations
+            << std::endl;
+  }
+
+  for (const auto basis : {SolverGMRES<VectorType>::AdditionalData::
+                             SStepBasis::monomial,
+                           SolverGMRES<VectorType>::AdditionalData::
+                             SStepBasis::newton})
+    for (const unsigned int s : {2, 4, 6})
+      {
+        data.s_step_size  = s;
+        data.s_step_basis = basis;
+        solution          = 0.;
+
+        SolverControl control(500, 1e-10 * rhs.l2_norm(), false, false);
+        SolverGMRES<VectorType> solver(control, data);
+        solver.solve(matrix, solution, rhs, preconditioner);
+
+        solution -= reference;
+        deallog << (basis == SolverGMRES<VectorType>::AdditionalData::
+                               SStepBasis::monomial ?
+                      "Monomial" :
+                      "Newton")
+                << " basis, s=" << s << ": iterations "
+                << (control.last_step() <= reference_iterations + 2 ?
+                      "ok" :
+                      "wrong")
+                << ", solution "
+                << (solution.linfty_norm() < 1e-6 * reference.linfty_norm() ?
+                      "ok" :
+                      "wrong")
+                << std::endl;
+      }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("Vector");
+  test<Vector<double>>(60, 30, false);
+  test<Vector<double>>(60, 30, true);
+  test<Vector<double>>(200, 12, false);
+  deallog.pop();
+
+  deallog.push("LA::d::Vector");
+  test<LinearAlgebra::distributed::Vector<double>>(60, 30, false);
+  test<LinearAlgebra::distributed::Vector<double>>(200, 12, true);
+  deallog.pop();
+
+  deallog.push("BlockVector");
+  test<BlockVector<double>>(60, 30, false);
+  test<BlockVector<double>>(200, 12, false);
+  deallog.pop();
+
+  {
+    SparsityPattern      sparsity;
+    SparseMatrix<double> matrix;
+    fill_sparse_matrix(200, sparsity, matrix);
+
+    deallog.push("SSOR");
+    PreconditionSSOR<SparseMatrix<double>> ssor;
+    ssor.initialize(matrix, 1.2);
+    test<Vector<double>>(200, 12, false, matrix, ssor);
+    test<Vector<double>>(200, 12, true, matrix, ssor);
+    deallog.pop();
+
+    deallog.push("Jacobi");
+    PreconditionJacobi<SparseMatrix<double>> jacobi;
+    jacobi.initialize(matrix, 0.8);
+    test<Vector<double>>(200, 12, false, matrix, jacobi);
+    test<Vector<double>>(200, 12, true, matrix, jacobi);
+    deallog.pop();
+  }
+}
@@ -0,0 +1,146 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that SolverMixedPrecision with inner solvers running in single
+// precision reaches a tolerance below the accuracy of single precision, for
+// dealii::Vector, LinearAlgebra::distributed::Vector, and BlockVector.
+
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/solver_mixed_precision.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+// A 1d Laplacian with an additional variable reaction term, written in
+// terms of element access so that it works with all vector types and
+// precisions
+struct MyMatrix
+{
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    const unsigned int n = src.size();
+    for (unsigned int i = 0; i < n; ++i)
+      {
+        typename VectorType::value_type sum = (2. + 0.1 * (i % 7)) * src(i);
+        if (i > 0)
+          sum -= src(i - 1);
+        if (i + 1 < n)
+          sum -= src(i + 1);
+        dst(i) = sum;
+      }
+  }
+};
+
+
+
+template <typename VectorType>
+void
+reinit_vector(VectorType &vector, const unsigned int size)
+{
+  vector.reinit(size);
+}
+
+
+
+template <typename Number>
+void
+reinit_vector(BlockVector<Number> &vector, const unsigned int size)
+{
+  vector.reinit(std::vector<types::global_dof_index>{size / 2,
+                                                     size - size / 2});
+}
+
+
+
+template <typename VectorType, typename InnerSolverType>
+void
+test(const unsigned int size)
+{
+  using InnerVectorType = typename InnerSolverType::vector_type;
+
+  MyMatrix matrix;
+
+  DiagonalMatrix<InnerVectorType> jacobi;
+  reinit_vector(jacobi.get_vector(), size);
+  for (unsigned int i = 0; i < size; ++i)
+    jacobi.get_vector()(i) = 1. / (2. + 0.1 * (i % 7));
+
+  VectorType rhs, solution, residual;
+  reinit_vector(rhs, size);
+  reinit_vector(solution, size);
+  reinit_vector(residual, size);
+  for (unsigned int i = 0; i < size; ++i)
+    rhs(i) = 1. + 0.01 * i;
+
+  const double tolerance = 1e-13 * rhs.l2_norm();
+  {
+    SolverControl control(100, tolerance, false, false);
+    SolverMixedPrecision<VectorType, InnerSolverType> solver(control);
+    solver.solve(matrix, solution, rhs, jacobi);
+  }
+
+  matrix.vmult(residual, solution);
+  residual -= rhs;
+  deallog << "Residual below tolerance: "
+          << (residual.l2_norm() < tolerance ? "ok" : "wrong") << std::endl;
+
+  // use a small reduction in the inner solver that can not be reached in
+  // single precision
+  solution = 0.;
+  {
+    SolverControl control(100, tolerance, false, false);
+    typename SolverMixedPrecision<VectorType, InnerSolverType>::AdditionalData
+      data(1e-10, 20);
+    SolverMixedPrecision<VectorType, InnerSolverType> solver(control, data);
+    solver.solve(matrix, solution, rhs, matrix, jacobi);
+  }
+
+  matrix.vmult(residual, solution);
+  residual -= rhs;
+  deallog << "Residual below tolerance with inexact inner solves: "
+          << (residual.l2_norm() < tolerance ? "ok" : "wrong") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("Vector");
+  test<Vector<double>, SolverCG<Vector<float>>>(100);
+  test<Vector<double>, SolverGMRES<Vector<float>>>(100);
+  deallog.pop();
+
+  deallog.push("LA::d::Vector");
+  test<LinearAlgebra::distributed::Vector<double>,
+       SolverCG<LinearAlgebra::distributed::Vector<float>>>(100);
+  test<LinearAlgebra::distributed::Vector<double>,
+       SolverGMRES<LinearAlgebra::distributed::Vector<float>>>(100);
+  deallog.pop();
+
+  deallog.push("BlockVector");
+  test<BlockVector<double>, SolverCG<BlockVector<float>>>(100);
+  deallog.pop();
+}
@@ -0,0 +1,162 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that SolverPipelinedCG converges in the same number of iterations
+// as SolverCG and computes the same solution, both for the merged vector
+// operations of dealii::Vector and LinearAlgebra::distributed::Vector and
+// for the generic path taken for BlockVector.
+
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_pipelined_cg.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+// A 1d Laplacian with an additional variable reaction term, written in
+// terms of element access so that it works with all vector types
+struct MyMatrix
+{
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    const unsigned int n = src.size();
+    for (unsigned int i = 0; i < n; ++i)
+      {
+        double sum = (2. + 0.1 * (i % 7)) * src(i);
+        if (i > 0)
+          sum -= src(i - 1);
+        if (i + 1 < n)
+          sum -= src(i + 1);
+        dst(i) = sum;
+      }
+  }
+};
+
+
+
+template <typename VectorType>
+void
+reinit_vector(VectorType &vector, const unsigned int size)
+{
+  vector.reinit(size);
+}
+
+
+
+void
+reinit_vector(BlockVector<double> &vector, const unsigned int size)
+{
+  vector.reinit(std::vector<types::global_dof_index>{size / 2,
+                                                     size - size / 2});
+}
+
+
+
+template <typename VectorType>
+void
+test(const unsigned int size)
+{
+  MyMatrix matrix;
+
+  DiagonalMatrix<VectorType> jacobi;
+  reinit_vector(jacobi.get_vector(), size);
+  for (unsigned int i = 0; i < size; ++i)
+    jacobi.get_vector()(i) = 1. / (2. + 0.1 * (i % 7));
+
+  VectorType rhs, sol_cg, sol_pipelined;
+  reinit_vector(rhs, size);
+  reinit_vector(sol_cg, size);
+  reinit_vector(sol_pipelined, size);
+  for (unsigned int i = 0; i < size; ++i)
+    rhs(i) = 1. + 0.01 * i;
+
+  {
+    SolverControl        control(200, 1e-12 * rhs.l2_norm());
+    SolverCG<VectorType> solver(control);
+    solver.solve(matrix, sol_cg, rhs, PreconditionIdentity());
+  }
+  {
+    SolverControl                 control(200, 1e-12 * rhs.l2_norm());
+    SolverPipelinedCG<VectorType> solver(control);
+    solver.solve(matrix, sol_pipelined, rhs, PreconditionIdentity());
+  }
+  sol_pipelined -= sol_cg;
+  deallog << "Difference to SolverCG without preconditioner: "
+          << (sol_pipelined.linfty_norm() < 1e-6 * sol_cg.linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+
+  sol_cg        = 0.;
+  sol_pipelined = 0.;
+  {
+    SolverControl        control(200, 1e-12 * rhs.l2_norm());
+    SolverCG<VectorType> solver(control);
+    solver.solve(matrix, sol_cg, rhs, jacobi);
+  }
+  {
+    SolverControl                 control(200, 1e-12 * rhs.l2_norm());
+    SolverPipelinedCG<VectorType> solver(control);
+    solver.solve(matrix, sol_pipelined, rhs, jacobi);
+  }
+  sol_pipelined -= sol_cg;
+  deallog << "Difference to SolverCG with preconditioner: "
+          << (sol_pipelined.linfty_norm() < 1e-6 * sol_cg.linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+
+  // check that the solver can start from a non-zero initial guess
+  sol_pipelined = 1.;
+  {
+    SolverControl                 control(200, 1e-12 * rhs.l2_norm());
+    SolverPipelinedCG<VectorType> solver(control);
+    solver.solve(matrix, sol_pipelined, rhs, jacobi);
+  }
+  sol_pipelined -= sol_cg;
+  deallog << "Difference for non-zero starting guess: "
+          << (sol_pipelined.linfty_norm() < 1e-6 * sol_cg.linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("Vector");
+  test<Vector<double>>(50);
+  test<Vector<double>>(101);
+  deallog.pop();
+
+  deallog.push("LA::d::Vector");
+  test<LinearAlgebra::distributed::Vector<double>>(50);
+  test<LinearAlgebra::distributed::Vector<double>>(101);
+  deallog.pop();
+
+  deallog.push("BlockVector");
+  test<BlockVector<double>>(50);
+  deallog.pop();
+}
@@ -0,0 +1,160 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Solve the 5-point Laplacian with CG preconditioned by SparseAMG, using the
+// different smoothers and cycles, and check that the number of iterations
+// does not grow with the problem size. Also use the hierarchy of SparseAMG
+// in a Multigrid object with a user-defined smoother.
+
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_amg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+void
+test(const unsigned int               size,
+     const SparseAMG::AdditionalData &additional_data,
+     const std::string               &name)
+{
+  FDMatrix           testproblem(size, size);
+  const unsigned int n = (size - 1) * (size - 1);
+  SparsityPattern    sparsity(n, n, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  SparseAMG amg;
+  amg.initialize(A, additional_data);
+
+  Vector<double> rhs(n), solution(n);
+  rhs = 1.;
+
+  SolverControl            control(100, 1e-8 * rhs.l2_norm());
+  SolverCG<Vector<double>> solver(control);
+  solver.solve(A, solution, rhs, amg);
+
+  Vector<double> residual(n);
+  A.residual(residual, solution, rhs);
+
+  deallog << name << ", n=" << n << ": levels=" << amg.n_levels()
+          << ", coarse size=" << amg.get_level_matrices()[0]->m()
+          << ", iterations=" << control.last_step() << ", converged="
+          << (residual.l2_norm() < 1e-8 * rhs.l2_norm() ? "yes" : "no")
+          << std::endl;
+}
+
+
+
+void
+test_user_smoother(const unsigned int size)
+{
+  FDMatrix           testproblem(size, size);
+  const unsigned int n = (size - 1) * (size - 1);
+  SparsityPattern    sparsity(n, n, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  SparseAMG amg;
+  amg.initialize(A);
+
+  const auto        &matrices = amg.get_level_matrices();
+  const unsigned int max_level = matrices.max_level();
+
+  mg::Matrix<Vector<double>> mg_matrix(matrices);
+
+  MGSmootherPrecondition<SparseMatrix<double>,
+                         PreconditionSSOR<SparseMatrix<double>>,
+                         Vector<double>>
+    mg_smoother(2);
+  mg_smoother.initialize(matrices);
+
+  FullMatrix<double> coarse_matrix(matrices[0]->m(), matrices[0]->n());
+  coarse_matrix.copy_from(*matrices[0]);
+  MGCoarseGridHouseholder<double, Vector<double>> mg_coarse(&coarse_matrix);
+
+  Multigrid<Vector<double>> mg(mg_matrix,
+                               mg_coarse,
+                               amg.get_transfer(),
+                               mg_smoother,
+                               mg_smoother,
+                               0,
+                               max_level);
+
+  // a stationary iteration with the multigrid cycle
+  Vector<double> rhs(n), solution(n), residual(n);
+  rhs = 1.;
+  residual.equ(1., rhs);
+  unsigned int step = 0;
+  for (; step < 50 && residual.l2_norm() > 1e-8 * rhs.l2_norm(); ++step)
+    {
+      amg.get_transfer().copy_to_mg(mg.defect, residual);
+      mg.cycle();
+      solution += mg.solution[max_level];
+      A.residual(residual, solution, rhs);
+    }
+
+  deallog << "SSOR smoother, n=" << n << ": levels=" << max_level + 1
+          << ", iterations=" << step << ", converged="
+          << (residual.l2_norm() <= 1e-8 * rhs.l2_norm() ? "yes" : "no")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog.depth_file(1);
+
+  for (const unsigned int size : {8, 33, 65, 129})
+    test(size, SparseAMG::AdditionalData(), "Chebyshev V-cycle");
+
+  SparseAMG::AdditionalData jacobi;
+  jacobi.smoother_type = SparseAMG::SmootherType::jacobi;
+  for (const unsigned int size : {33, 129})
+    test(size, jacobi, "Jacobi V-cycle");
+
+  SparseAMG::AdditionalData w_cycle;
+  w_cycle.w_cycle = true;
+  for (const unsigned int size : {33, 129})
+    test(size, w_cycle, "Chebyshev W-cycle");
+
+  // several chunks for aggregation and a smaller coarse level
+  SparseAMG::AdditionalData chunks;
+  chunks.aggregation_chunk_size = 1000;
+  chunks.max_coarse_size        = 50;
+  for (const unsigned int size : {65, 129})
+    test(size, chunks, "Small chunks");
+
+  test_user_smoother(65);
+}
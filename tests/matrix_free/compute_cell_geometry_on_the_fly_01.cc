@@ -0,0 +1,134 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check MatrixFree::AdditionalData::compute_cell_geometry_on_the_fly: an
+// operator using values, gradients and quadrature points on a curved mesh
+// with a high-order mapping must give the same result as with the cached
+// geometry, while the mapping data consumes less memory.
+
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree, typename Number>
+void
+test(const unsigned int mapping_degree)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1.);
+  tria.refine_global(1);
+
+  const FE_Q<dim>     fe(fe_degree);
+  const MappingQ<dim> mapping(mapping_degree);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  std::vector<VectorType>  results(2);
+  std::vector<std::size_t> memory(2);
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      typename MatrixFree<dim, Number>::AdditionalData data;
+      data.mapping_update_flags =
+        update_values | update_gradients | update_quadrature_points;
+      data.compute_cell_geometry_on_the_fly = (i == 1);
+
+      MatrixFree<dim, Number> matrix_free;
+      matrix_free.reinit(mapping,
+                         dof_handler,
+                         AffineConstraints<Number>(),
+                         QGauss<1>(fe_degree + 1),
+                         data);
+      memory[i] = matrix_free.get_mapping_info().memory_consumption();
+
+      VectorType src;
+      matrix_free.initialize_dof_vector(src);
+      matrix_free.initialize_dof_vector(results[i]);
+      for (unsigned int j = 0; j < src.locally_owned_size(); ++j)
+        src.local_element(j) = std::sin(0.3 * j) + 0.1;
+
+      matrix_free.template cell_loop<VectorType, VectorType>(
+        [](const MatrixFree<dim, Number>               &matrix_free,
+           VectorType                                  &dst,
+           const VectorType                            &src,
+           const std::pair<unsigned int, unsigned int> &range) {
+          FEEvaluation<dim, fe_degree, fe_degree + 1, 1, Number> phi(
+            matrix_free);
+          for (unsigned int cell = range.first; cell < range.second; ++cell)
+            {
+              phi.reinit(cell);
+              phi.gather_evaluate(src,
+                                  EvaluationFlags::values |
+                                    EvaluationFlags::gradients);
+              for (const unsigned int q : phi.quadrature_point_indices())
+                {
+                  const auto point = phi.quadrature_point(q);
+                  phi.submit_value(phi.get_value(q) * point.norm_square(), q);
+                  phi.submit_gradient(phi.get_gradient(q), q);
+                }
+              phi.integrate_scatter(EvaluationFlags::values |
+                                      EvaluationFlags::gradients,
+                                    dst);
+            }
+        },
+        results[i],
+        src,
+        true);
+    }
+
+  const double reference = results[0].linfty_norm();
+  results[1] -= results[0];
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " mapping_degree=" << mapping_degree << " "
+          << (std::is_same_v<Number, double> ? "double" : "float")
+          << ": difference "
+          << (results[1].linfty_norm() <
+                  (std::is_same_v<Number, double> ? 1e-12 : 1e-5) * reference ?
+                "ok" :
+                "wrong")
+          << ", memory reduced " << (memory[1] < memory[0] ? "ok" : "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 2, double>(3);
+  test<2, 4, double>(4);
+  test<2, 3, float>(2);
+  test<3, 2, double>(2);
+  test<3, 3, double>(4);
+  test<3, 1, float>(3);
+}
@@ -0,0 +1,168 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check FEFaceEvaluation::evaluate_from_cell_quadrature() and
+// FEFaceEvaluation::integrate_into_cell_quadrature() against the evaluation
+// from the degrees of freedom and the integration into the degrees of
+// freedom on the faces of all cells of a curved mesh, as used in
+// cell-centric loops.
+
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree, int n_q_points_1d, int n_components>
+void
+test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1.);
+  tria.refine_global(1);
+
+  const FE_DGQ<dim>   fe_scalar(fe_degree);
+  const FESystem<dim> fe(fe_scalar, n_components);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const MappingQ<dim> mapping(3);
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags                = update_values | update_JxW_values;
+  data.mapping_update_flags_faces_by_cells = update_values | update_JxW_values;
+  data.hold_all_faces_to_owned_cells       = true;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(n_q_points_1d),
+                     data);
+
+  VectorType src;
+  matrix_free.initialize_dof_vector(src);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = std::sin(0.7 * i) + 0.3;
+
+  FEEvaluation<dim, fe_degree, n_q_points_1d, n_components, double> phi(
+    matrix_free);
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components, double>
+    phi_dofs(matrix_free, true);
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components, double>
+    phi_quad(matrix_free, true);
+
+  AlignedVector<VectorizedArray<double>> cell_values(phi.n_q_points *
+                                                     n_components);
+
+  double max_error_eval = 0., max_error_integrate = 0., max_value = 0.;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      const unsigned int n_lanes =
+        matrix_free.n_active_entries_per_cell_batch(cell);
+
+      phi.reinit(cell);
+      phi.gather_evaluate(src, EvaluationFlags::values);
+      for (unsigned int i = 0; i < cell_values.size(); ++i)
+        cell_values[i] = phi.begin_values()[i];
+
+      for (const unsigned int face : GeometryInfo<dim>::face_indices())
+        {
+          phi_dofs.reinit(cell, face);
+          phi_dofs.gather_evaluate(src, EvaluationFlags::values);
+
+          phi_quad.reinit(cell, face);
+          phi_quad.evaluate_from_cell_quadrature(cell_values.data(),
+                                                 EvaluationFlags::values);
+
+          for (unsigned int i = 0; i < phi_dofs.n_q_points * n_components;
+               ++i)
+            for (unsigned int v = 0; v < n_lanes; ++v)
+              {
+                max_error_eval =
+                  std::max(max_error_eval,
+                           std::abs(phi_dofs.begin_values()[i][v] -
+                                    phi_quad.begin_values()[i][v]));
+                max_value =
+                  std::max(max_value, std::abs(phi_dofs.begin_values()[i][v]));
+              }
+
+          // test a flux that depends on the position of the quadrature point
+          for (const unsigned int q : phi_dofs.quadrature_point_indices())
+            {
+              const auto value = phi_dofs.get_value(q);
+              phi_dofs.submit_value(value * (1. + q), q);
+              phi_quad.submit_value(value * (1. + q), q);
+            }
+
+          phi_dofs.integrate(EvaluationFlags::values);
+
+          phi.reinit(cell);
+          for (unsigned int i = 0; i < cell_values.size(); ++i)
+            phi.begin_values()[i] = 0.;
+          phi_quad.integrate_into_cell_quadrature(EvaluationFlags::values,
+                                                  phi.begin_values());
+          phi.integrate(EvaluationFlags::values);
+
+          for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+            for (unsigned int v = 0; v < n_lanes; ++v)
+              max_error_integrate =
+                std::max(max_error_integrate,
+                         std::abs(phi_dofs.begin_dof_values()[i][v] -
+                                  phi.begin_dof_values()[i][v]));
+        }
+    }
+
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " n_q_points_1d=" << n_q_points_1d
+          << " n_components=" << n_components << ": evaluate "
+          << (max_error_eval < 1e-12 * max_value ? "ok" : "wrong")
+          << ", integrate "
+          << (max_error_integrate < 1e-12 * max_value ? "ok" : "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1, 2, 1>();
+  test<2, 3, 4, 1>();
+  test<2, 2, 4, 2>();
+  test<3, 2, 3, 1>();
+  test<3, 1, 3, 3>();
+}
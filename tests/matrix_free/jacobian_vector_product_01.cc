@@ -0,0 +1,264 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check MatrixFreeTools::compute_jacobian_vector_product(): for a scalar
+// nonlinear diffusion-reaction operator with hanging node constraints, the
+// result must match the hand-derived linearized operator, and for a
+// compressible neo-Hookean material the result must match a finite
+// difference approximation of the directional derivative of the residual.
+
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+template <int dim, int fe_degree>
+void
+test_scalar()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ<dim>(1),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe_degree + 1),
+                     typename MatrixFree<dim, double>::AdditionalData());
+
+  VectorType solution, src, dst, reference;
+  matrix_free.initialize_dof_vector(solution);
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  matrix_free.initialize_dof_vector(reference);
+  for (unsigned int i = 0; i < solution.locally_owned_size(); ++i)
+    {
+      solution.local_element(i) = std::sin(0.7 * i);
+      if (!constraints.is_constrained(i))
+        src.local_element(i) = std::cos(0.3 * i);
+    }
+  constraints.distribute(solution);
+  solution.update_ghost_values();
+
+  // residual of -div((1+u^2) grad u) + exp(u)
+  MatrixFreeTools::compute_jacobian_vector_product<dim, fe_degree>(
+    matrix_free,
+    dst,
+    solution,
+    src,
+    EvaluationFlags::values | EvaluationFlags::gradients,
+    EvaluationFlags::values | EvaluationFlags::gradients,
+    [](const auto &, const unsigned int, const auto &value, const auto &grad) {
+      return std::make_pair(std::exp(value), (1. + value * value) * grad);
+    });
+
+  // hand-derived linearization
+  matrix_free.template cell_loop<VectorType, VectorType>(
+    [&](const MatrixFree<dim, double>               &matrix_free,
+        VectorType                                  &dst,
+        const VectorType                            &src,
+        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, fe_degree> phi_solution(matrix_free);
+      FEEvaluation<dim, fe_degree> phi(matrix_free);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi_solution.reinit(cell);
+          phi_solution.read_dof_values_plain(solution);
+          phi_solution.evaluate(EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          phi.reinit(cell);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              const auto u      = phi_solution.get_value(q);
+              const auto grad_u = phi_solution.get_gradient(q);
+              const auto w      = phi.get_value(q);
+              phi.submit_value(std::exp(u) * w, q);
+              phi.submit_gradient((1. + u * u) * phi.get_gradient(q) +
+                                    2. * u * w * grad_u,
+                                  q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    },
+    reference,
+    src,
+    true);
+
+  dst -= reference;
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " scalar: difference to linearized operator "
+          << (dst.linfty_norm() < 1e-12 * reference.linfty_norm() ? "ok" :
+                                                                     "wrong")
+          << std::endl;
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test_neo_hooke()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  const FE_Q<dim>     fe_scalar(fe_degree);
+  const FESystem<dim> fe(fe_scalar, dim);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ<dim>(1),
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(fe_degree + 1),
+                     typename MatrixFree<dim, double>::AdditionalData());
+
+  // first Piola-Kirchhoff stress of a compressible neo-Hookean material,
+  // written for generic number types
+  const auto stress = [](const auto &,
+                         const unsigned int,
+                         const auto &value,
+                         const auto &grad) {
+    const double mu     = 1.;
+    const double lambda = 10.;
+    using TensorType    = std::decay_t<decltype(grad)>;
+    TensorType F        = grad;
+    for (unsigned int d = 0; d < dim; ++d)
+      F[d][d] += 1.;
+    const auto       J         = determinant(F);
+    const TensorType F_inv_T   = transpose(invert(F));
+    const TensorType piola_one = mu * (F - F_inv_T) + lambda * std::log(J) *
+                                                        F_inv_T;
+    return std::make_pair(value, piola_one);
+  };
+
+  VectorType solution, src, dst;
+  matrix_free.initialize_dof_vector(solution);
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  for (unsigned int i = 0; i < solution.locally_owned_size(); ++i)
+    {
+      solution.local_element(i) = 0.1 * std::sin(0.7 * i);
+      src.local_element(i)      = std::cos(0.3 * i);
+    }
+
+  MatrixFreeTools::
+    compute_jacobian_vector_product<dim, fe_degree, fe_degree + 1, dim>(
+      matrix_free,
+      dst,
+      solution,
+      src,
+      EvaluationFlags::gradients,
+      EvaluationFlags::gradients,
+      stress);
+
+  // central finite difference of the residual
+  const auto compute_residual = [&](const VectorType &u, VectorType &result) {
+    matrix_free.template cell_loop<VectorType, VectorType>(
+      [&](const MatrixFree<dim, double>               &matrix_free,
+          VectorType                                  &dst,
+          const VectorType                            &src,
+          const std::pair<unsigned int, unsigned int> &range) {
+        FEEvaluation<dim, fe_degree, fe_degree + 1, dim> phi(matrix_free);
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            phi.gather_evaluate(src, EvaluationFlags::gradients);
+            for (const unsigned int q : phi.quadrature_point_indices())
+              phi.submit_gradient(
+                stress(phi, q, phi.get_value(q), phi.get_gradient(q)).second,
+                q);
+            phi.integrate_scatter(EvaluationFlags::gradients, dst);
+          }
+      },
+      result,
+      u,
+      true);
+  };
+
+  const double h = 1e-5;
+  VectorType   perturbed, residual_plus, residual_minus;
+  perturbed.reinit(solution);
+  residual_plus.reinit(solution);
+  residual_minus.reinit(solution);
+  perturbed = solution;
+  perturbed.add(h, src);
+  compute_residual(perturbed, residual_plus);
+  perturbed = solution;
+  perturbed.add(-h, src);
+  compute_residual(perturbed, residual_minus);
+  residual_plus -= residual_minus;
+  residual_plus /= 2. * h;
+
+  residual_plus -= dst;
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " neo-Hooke: difference to finite differences "
+          << (residual_plus.linfty_norm() < 1e-6 * dst.linfty_norm() ? "ok" :
+                                                                        "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test_scalar<2, 1>();
+  test_scalar<2, 3>();
+  test_scalar<3, 2>();
+  test_neo_hooke<2, 2>();
+  test_neo_hooke<3, 1>();
+}
@@ -0,0 +1,272 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check the vmult() function of MatrixFreeOperators::Base that runs
+// operations before and after the loop over cells against the plain vmult(),
+// both on the active cells with hanging node and Dirichlet constraints and
+// on a multigrid level with refinement edge indices. Also check that
+// PreconditionChebyshev, which embeds its vector updates into the loop over
+// cells through this function, computes the same as with an operator that
+// only provides the plain vmult().
+
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/multigrid/mg_constrained_dofs.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+// operator that hides the vmult() function with pre and post operations of
+// the underlying operator, making PreconditionChebyshev run the unfused
+// vector updates
+template <typename OperatorType>
+class PlainOperator : public EnableObserverPointer
+{
+public:
+  using value_type = typename OperatorType::value_type;
+  using size_type  = typename OperatorType::size_type;
+
+  PlainOperator(const OperatorType &op)
+    : op(op)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    op.vmult(dst, src);
+  }
+
+  size_type
+  m() const
+  {
+    return op.m();
+  }
+
+  size_type
+  n() const
+  {
+    return op.n();
+  }
+
+  value_type
+  el(const unsigned int row, const unsigned int col) const
+  {
+    return op.el(row, col);
+  }
+
+private:
+  const OperatorType &op;
+};
+
+
+
+template <typename OperatorType>
+void
+check_operator(const OperatorType &op, const std::string &name)
+{
+  VectorType src, dst, reference;
+  op.initialize_dof_vector(src);
+  op.initialize_dof_vector(dst);
+  op.initialize_dof_vector(reference);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = std::sin(0.37 * i) + 0.2;
+
+  op.vmult(reference, src);
+
+  // fill dst with garbage, the operation before the loop sets it to zero
+  dst = 1e10;
+  op.vmult(
+    dst,
+    src,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int i = begin; i < end; ++i)
+        dst.local_element(i) = 0.;
+    },
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int i = begin; i < end; ++i)
+        dst.local_element(i) *= 2.;
+    });
+  dst.add(-2., reference);
+  deallog << name << " vmult with pre/post operations "
+          << (dst.linfty_norm() < 1e-12 * reference.linfty_norm() ? "ok" :
+                                                                     "wrong")
+          << std::endl;
+
+  // run Chebyshev with both variants
+  using PreconditionerType = DiagonalMatrix<VectorType>;
+  using FusedType =
+    PreconditionChebyshev<OperatorType, VectorType, PreconditionerType>;
+  using PlainType = PreconditionChebyshev<PlainOperator<OperatorType>,
+                                          VectorType,
+                                          PreconditionerType>;
+
+  typename FusedType::AdditionalData fused_data;
+  fused_data.degree              = 4;
+  fused_data.smoothing_range     = 15.;
+  fused_data.eig_cg_n_iterations = 12;
+  fused_data.preconditioner      = op.get_matrix_diagonal_inverse();
+  FusedType fused;
+  fused.initialize(op, fused_data);
+
+  typename PlainType::AdditionalData plain_data;
+  plain_data.degree              = 4;
+  plain_data.smoothing_range     = 15.;
+  plain_data.eig_cg_n_iterations = 12;
+  plain_data.preconditioner      = op.get_matrix_diagonal_inverse();
+  const PlainOperator<OperatorType> plain_op(op);
+  PlainType                         plain;
+  plain.initialize(plain_op, plain_data);
+
+  fused.vmult(dst, src);
+  plain.vmult(reference, src);
+  dst -= reference;
+  const double error_vmult = dst.linfty_norm() / reference.linfty_norm();
+
+  dst       = src;
+  reference = src;
+  fused.step(dst, src);
+  plain.step(reference, src);
+  dst -= reference;
+  const double error_step = dst.linfty_norm() / reference.linfty_norm();
+
+  deallog << name << " Chebyshev fused vs plain "
+          << (error_vmult < 1e-12 && error_step < 1e-12 ? "ok" : "wrong")
+          << std::endl;
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  Triangulation<dim> tria(
+    Triangulation<dim>::limit_level_difference_at_vertices);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+  dof.distribute_mg_dofs();
+
+  deallog << "Testing " << fe.get_name() << " in " << dim << "d" << std::endl;
+
+  using MatrixFreeType = MatrixFree<dim, double>;
+  for (const auto scheme : {MatrixFreeType::AdditionalData::none,
+                            MatrixFreeType::AdditionalData::partition_color})
+    {
+      if (scheme == MatrixFreeType::AdditionalData::none)
+        deallog.push("serial");
+      else
+        deallog.push("tasks");
+
+      // active cells with hanging node and Dirichlet constraints
+      {
+        AffineConstraints<double> constraints;
+        DoFTools::make_hanging_node_constraints(dof, constraints);
+        VectorTools::interpolate_boundary_values(dof,
+                                                 0,
+                                                 Functions::ZeroFunction<dim>(),
+                                                 constraints);
+        constraints.close();
+
+        typename MatrixFreeType::AdditionalData data;
+        data.tasks_parallel_scheme = scheme;
+        data.tasks_block_size      = 2;
+        const auto mf_data         = std::make_shared<MatrixFreeType>();
+        mf_data->reinit(MappingQ1<dim>(),
+                        dof,
+                        constraints,
+                        QGauss<1>(fe_degree + 1),
+                        data);
+
+        MatrixFreeOperators::LaplaceOperator<dim, fe_degree> laplace;
+        laplace.initialize(mf_data);
+        laplace.compute_diagonal();
+        check_operator(laplace, "Laplace active");
+
+        MatrixFreeOperators::MassOperator<dim, fe_degree> mass;
+        mass.initialize(mf_data);
+        mass.compute_diagonal();
+        check_operator(mass, "Mass active");
+      }
+
+      // finest level with refinement edge indices
+      {
+        const unsigned int level = tria.n_global_levels() - 1;
+
+        MGConstrainedDoFs mg_constrained_dofs;
+        mg_constrained_dofs.initialize(dof);
+        mg_constrained_dofs.make_zero_boundary_constraints(dof, {0});
+
+        AffineConstraints<double> level_constraints;
+        level_constraints.add_lines(
+          mg_constrained_dofs.get_boundary_indices(level));
+        level_constraints.close();
+
+        typename MatrixFreeType::AdditionalData data;
+        data.tasks_parallel_scheme = scheme;
+        data.tasks_block_size      = 2;
+        data.mg_level              = level;
+        const auto mf_data         = std::make_shared<MatrixFreeType>();
+        mf_data->reinit(MappingQ1<dim>(),
+                        dof,
+                        level_constraints,
+                        QGauss<1>(fe_degree + 1),
+                        data);
+
+        MatrixFreeOperators::LaplaceOperator<dim, fe_degree> laplace;
+        laplace.initialize(mf_data, mg_constrained_dofs, level);
+        laplace.compute_diagonal();
+        check_operator(laplace, "Laplace level");
+      }
+
+      deallog.pop();
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>();
+  test<2, 3>();
+  test<3, 2>();
+}
@@ -0,0 +1,159 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that FEEvaluation computing in double precision can read from and
+// write into vectors stored in single precision, for continuous and
+// discontinuous elements, by comparing against the result with vectors in
+// double precision. Also check
+// MatrixFree::AdditionalData::store_cell_geometry_in_single_precision.
+
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree, typename VectorType>
+void
+apply_operator(const MatrixFree<dim, double> &matrix_free,
+               VectorType                    &dst,
+               const VectorType              &src)
+{
+  matrix_free.template cell_loop<VectorType, VectorType>(
+    [](const MatrixFree<dim, double>               &matrix_free,
+       VectorType                                  &dst,
+       const VectorType                            &src,
+       const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, fe_degree, fe_degree + 1, 1, double> phi(matrix_free);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src,
+                              EvaluationFlags::values |
+                                EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q), q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate_scatter(EvaluationFlags::values |
+                                  EvaluationFlags::gradients,
+                                dst);
+        }
+    },
+    dst,
+    src,
+    true);
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1.);
+  tria.refine_global(1);
+
+  const MappingQ<dim> mapping(3);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags = update_values | update_gradients;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(fe_degree + 1),
+                     data);
+
+  // the reference result computed with vectors in double precision, with
+  // the input rounded to single precision
+  LinearAlgebra::distributed::Vector<double> src, dst;
+  LinearAlgebra::distributed::Vector<float>  src_float, dst_float;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  matrix_free.initialize_dof_vector(src_float);
+  matrix_free.initialize_dof_vector(dst_float);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    {
+      src_float.local_element(i) = std::sin(0.3 * i) + 0.1;
+      src.local_element(i)       = src_float.local_element(i);
+    }
+
+  apply_operator<dim, fe_degree>(matrix_free, dst, src);
+  apply_operator<dim, fe_degree>(matrix_free, dst_float, src_float);
+
+  double error = 0.;
+  for (unsigned int i = 0; i < dst.locally_owned_size(); ++i)
+    error = std::max(error,
+                     std::abs(dst.local_element(i) -
+                              static_cast<double>(dst_float.local_element(i))));
+  deallog << fe.get_name() << " vectors in float: "
+          << (error < 1e-6 * dst.linfty_norm() ? "ok" : "wrong") << std::endl;
+
+  // compare the geometry computed from support points in single precision
+  // with the cached geometry
+  data.compute_cell_geometry_on_the_fly        = true;
+  data.store_cell_geometry_in_single_precision = true;
+  MatrixFree<dim, double> matrix_free_float_geometry;
+  matrix_free_float_geometry.reinit(mapping,
+                                    dof_handler,
+                                    AffineConstraints<double>(),
+                                    QGauss<1>(fe_degree + 1),
+                                    data);
+
+  LinearAlgebra::distributed::Vector<double> dst_float_geometry;
+  matrix_free_float_geometry.initialize_dof_vector(dst_float_geometry);
+  apply_operator<dim, fe_degree>(matrix_free_float_geometry,
+                                 dst_float_geometry,
+                                 src);
+  dst_float_geometry -= dst;
+  deallog << fe.get_name() << " geometry in float: "
+          << (dst_float_geometry.linfty_norm() < 1e-5 * dst.linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 2>(FE_Q<2>(2));
+  test<2, 3>(FE_DGQ<2>(3));
+  test<3, 2>(FE_Q<3>(2));
+  test<3, 1>(FE_DGQ<3>(1));
+}
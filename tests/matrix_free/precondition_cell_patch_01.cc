@@ -0,0 +1,211 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check PreconditionCellPatch on a mesh of anisotropic Cartesian cells
+// against the inverse of the cell matrices of the interior penalty Laplacian
+// assembled with FEValues and FEFaceValues, treating all faces as interior
+// faces. Also check that PreconditionRelaxation, which fuses its vector
+// updates into the cell loop of PreconditionCellPatch, computes the same as
+// the plain relaxation steps.
+
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+#include <deal.II/matrix_free/precondition_cell_patch.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree>
+void
+test(const FiniteElement<dim> &fe)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  std::vector<unsigned int> subdivisions(dim, 2);
+  subdivisions[0] = 3;
+  Point<dim> upper_right;
+  for (unsigned int d = 0; d < dim; ++d)
+    upper_right[d] = 0.5 + 0.4 * d;
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_rectangle(tria,
+                                            subdivisions,
+                                            Point<dim>(),
+                                            upper_right);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  matrix_free->reinit(MappingQ1<dim>(),
+                      dof_handler,
+                      AffineConstraints<double>(),
+                      QGauss<1>(fe_degree + 1),
+                      typename MatrixFree<dim, double>::AdditionalData());
+
+  const double penalty_factor = 1.5 * (fe_degree + 1) * (fe_degree + 1);
+
+  const auto preconditioner =
+    std::make_shared<PreconditionCellPatch<dim, fe_degree>>();
+  preconditioner->initialize(
+    matrix_free,
+    typename PreconditionCellPatch<dim, fe_degree>::AdditionalData(
+      penalty_factor));
+
+  VectorType src, dst;
+  matrix_free->initialize_dof_vector(src);
+  matrix_free->initialize_dof_vector(dst);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = std::sin(0.7 * i) + 0.1;
+
+  preconditioner->vmult(dst, src);
+
+  // reference: invert the assembled cell matrices
+  const QGauss<dim>     quadrature(fe_degree + 1);
+  const QGauss<dim - 1> face_quadrature(fe_degree + 1);
+  FEValues<dim>         fe_values(fe,
+                          quadrature,
+                          update_values | update_gradients | update_JxW_values);
+  FEFaceValues<dim>     fe_face_values(fe,
+                                   face_quadrature,
+                                   update_values | update_gradients |
+                                     update_normal_vectors | update_JxW_values);
+
+  const unsigned int dofs_per_cell = fe.n_dofs_per_cell();
+  FullMatrix<double> cell_matrix(dofs_per_cell, dofs_per_cell);
+  Vector<double>     local_src(dofs_per_cell), local_dst(dofs_per_cell);
+  std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+
+  double max_error = 0, max_value = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell_matrix = 0;
+      fe_values.reinit(cell);
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          for (unsigned int j = 0; j < dofs_per_cell; ++j)
+            for (unsigned int c = 0; c < fe.n_components(); ++c)
+              cell_matrix(i, j) += fe_values.shape_grad_component(i, q, c) *
+                                   fe_values.shape_grad_component(j, q, c) *
+                                   fe_values.JxW(q);
+
+      for (const unsigned int face : cell->face_indices())
+        {
+          fe_face_values.reinit(cell, face);
+          const double sigma =
+            penalty_factor / cell->extent_in_direction(face / 2);
+          for (const unsigned int q : fe_face_values.quadrature_point_indices())
+            {
+              const Tensor<1, dim> normal = fe_face_values.normal_vector(q);
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                for (unsigned int j = 0; j < dofs_per_cell; ++j)
+                  for (unsigned int c = 0; c < fe.n_components(); ++c)
+                    cell_matrix(i, j) +=
+                      (-0.5 * (fe_face_values.shape_grad_component(i, q, c) *
+                               normal) *
+                         fe_face_values.shape_value_component(j, q, c) -
+                       0.5 * fe_face_values.shape_value_component(i, q, c) *
+                         (fe_face_values.shape_grad_component(j, q, c) *
+                          normal) +
+                       sigma * fe_face_values.shape_value_component(i, q, c) *
+                         fe_face_values.shape_value_component(j, q, c)) *
+                      fe_face_values.JxW(q);
+            }
+        }
+
+      cell_matrix.gauss_jordan();
+      cell->get_dof_indices(dof_indices);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        local_src(i) = src(dof_indices[i]);
+      cell_matrix.vmult(local_dst, local_src);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        {
+          max_error =
+            std::max(max_error, std::abs(local_dst(i) - dst(dof_indices[i])));
+          max_value = std::max(max_value, std::abs(local_dst(i)));
+        }
+    }
+
+  deallog << fe.get_name() << ": inverse of cell matrices "
+          << (max_error < 1e-10 * max_value ? "ok" : "wrong") << std::endl;
+
+  // compare the fused relaxation steps with the plain ones
+  if (fe.n_components() == 1)
+    {
+      MatrixFreeOperators::
+        LaplaceOperator<dim, fe_degree, fe_degree + 1, 1, VectorType>
+          laplace_operator;
+      laplace_operator.initialize(matrix_free);
+
+      using RelaxationType =
+        PreconditionRelaxation<decltype(laplace_operator),
+                               PreconditionCellPatch<dim, fe_degree>>;
+      typename RelaxationType::AdditionalData relaxation_data;
+      relaxation_data.preconditioner = preconditioner;
+      relaxation_data.relaxation     = 0.7;
+      relaxation_data.n_iterations   = 3;
+
+      RelaxationType relaxation;
+      relaxation.initialize(laplace_operator, relaxation_data);
+      relaxation.vmult(dst, src);
+
+      VectorType reference, residual, correction;
+      reference.reinit(src);
+      residual.reinit(src);
+      correction.reinit(src);
+      for (unsigned int step = 0; step < 3; ++step)
+        {
+          laplace_operator.vmult(residual, reference);
+          residual.sadd(-1., 1., src);
+          preconditioner->vmult(correction, residual);
+          reference.add(0.7, correction);
+        }
+      reference -= dst;
+      deallog << fe.get_name() << ": fused relaxation "
+              << (reference.linfty_norm() < 1e-12 * dst.linfty_norm() ?
+                    "ok" :
+                    "wrong")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>(FE_DGQ<2>(1));
+  test<2, 3>(FE_DGQ<2>(3));
+  test<2, 2>(FESystem<2>(FE_DGQ<2>(2), 2));
+  test<3, 2>(FE_DGQ<3>(2));
+}
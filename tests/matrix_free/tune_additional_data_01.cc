@@ -0,0 +1,180 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check MatrixFreeTools::tune_additional_data() and
+// MatrixFreeTools::find_fastest_variant(): the tuned settings must be among
+// the candidates and give the same operator, and a variant doing twenty
+// times the work must not be selected.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/operators.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+template <int dim, int fe_degree, typename VectorizedArrayType>
+std::function<void()>
+setup_laplace(
+  const std::shared_ptr<const MatrixFree<dim, double, VectorizedArrayType>>
+                     &matrix_free,
+  const unsigned int n_applications)
+{
+  using OperatorType =
+    MatrixFreeOperators::LaplaceOperator<dim,
+                                         fe_degree,
+                                         fe_degree + 1,
+                                         1,
+                                         VectorType,
+                                         VectorizedArrayType>;
+  auto laplace = std::make_shared<OperatorType>();
+  laplace->initialize(matrix_free);
+  auto src = std::make_shared<VectorType>();
+  auto dst = std::make_shared<VectorType>();
+  laplace->initialize_dof_vector(*src);
+  laplace->initialize_dof_vector(*dst);
+  *src = 1.;
+  return [=]() {
+    for (unsigned int i = 0; i < n_applications; ++i)
+      laplace->vmult(*dst, *src);
+  };
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  constraints.close();
+
+  using MatrixFreeType = MatrixFree<dim, double>;
+  typename MatrixFreeType::AdditionalData data;
+
+  const std::vector<unsigned int> block_sizes = {0, 4};
+
+  const auto tuned_data = MatrixFreeTools::
+    tune_additional_data<dim, double, VectorizedArray<double>>(
+      MappingQ1<dim>(),
+      dof,
+      constraints,
+      QGauss<1>(fe_degree + 1),
+      data,
+      [](const std::shared_ptr<const MatrixFreeType> &matrix_free) {
+        return setup_laplace<dim, fe_degree, VectorizedArray<double>>(
+          matrix_free, 1);
+      },
+      block_sizes,
+      2);
+
+  const bool is_candidate =
+    (tuned_data.tasks_parallel_scheme == MatrixFreeType::AdditionalData::none &&
+     tuned_data.tasks_block_size == data.tasks_block_size) ||
+    (tuned_data.tasks_parallel_scheme != MatrixFreeType::AdditionalData::none &&
+     std::find(block_sizes.begin(),
+               block_sizes.end(),
+               tuned_data.tasks_block_size) != block_sizes.end());
+  deallog << "Tuned settings among candidates: " << is_candidate << std::endl;
+
+  // compare the operator with the tuned settings against the default ones
+  std::vector<VectorType> results(2);
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      const auto matrix_free = std::make_shared<MatrixFreeType>();
+      matrix_free->reinit(MappingQ1<dim>(),
+                          dof,
+                          constraints,
+                          QGauss<1>(fe_degree + 1),
+                          i == 0 ? data : tuned_data);
+      MatrixFreeOperators::LaplaceOperator<dim, fe_degree> laplace;
+      laplace.initialize(matrix_free);
+      VectorType src;
+      laplace.initialize_dof_vector(src);
+      laplace.initialize_dof_vector(results[i]);
+      for (unsigned int j = 0; j < src.locally_owned_size(); ++j)
+        src.local_element(j) = std::sin(0.3 * j);
+      laplace.vmult(results[i], src);
+    }
+  results[1] -= results[0];
+  deallog << "Difference tuned vs default: "
+          << (results[1].linfty_norm() < 1e-12 * results[0].linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+
+  // variants with the default vectorization width and without
+  // vectorization, the latter doing much more work
+  const auto matrix_free = std::make_shared<MatrixFreeType>();
+  matrix_free->reinit(
+    MappingQ1<dim>(), dof, constraints, QGauss<1>(fe_degree + 1), data);
+
+  using MatrixFreeScalarType =
+    MatrixFree<dim, double, VectorizedArray<double, 1>>;
+  const auto matrix_free_scalar = std::make_shared<MatrixFreeScalarType>();
+  matrix_free_scalar->reinit(MappingQ1<dim>(),
+                             dof,
+                             constraints,
+                             QGauss<1>(fe_degree + 1),
+                             typename MatrixFreeScalarType::AdditionalData());
+
+  const unsigned int fastest = MatrixFreeTools::find_fastest_variant(
+    {setup_laplace<dim, fe_degree, VectorizedArray<double>>(matrix_free, 1),
+     setup_laplace<dim, fe_degree, VectorizedArray<double, 1>>(
+       matrix_free_scalar, 20)},
+    MPI_COMM_SELF,
+    2);
+  deallog << "Fastest variant: " << fastest << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  MultithreadInfo::set_thread_limit(2);
+
+  test<2, 2>();
+  test<3, 1>();
+}
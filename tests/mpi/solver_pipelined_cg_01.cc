@@ -0,0 +1,122 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check SolverPipelinedCG with LinearAlgebra::distributed::Vector
+// distributed over several MPI ranks, where the inner products are
+// reduced with a non-blocking collective, against SolverCG.
+
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_pipelined_cg.h>
+
+#include "../tests.h"
+
+
+// A 1d Laplacian with an additional variable reaction term, using the
+// ghost entries of the source vector to access the neighbors on other
+// ranks.
+struct MyMatrix
+{
+  void
+  vmult(LinearAlgebra::distributed::Vector<double>       &dst,
+        const LinearAlgebra::distributed::Vector<double> &src) const
+  {
+    src.update_ghost_values();
+    const unsigned int n = src.size();
+    for (const auto i : src.locally_owned_elements())
+      {
+        double sum = (2. + 0.1 * (i % 7)) * src(i);
+        if (i > 0)
+          sum -= src(i - 1);
+        if (i + 1 < n)
+          sum -= src(i + 1);
+        dst(i) = sum;
+      }
+    src.zero_out_ghost_values();
+  }
+};
+
+
+
+void
+test(const unsigned int size)
+{
+  const IndexSet owned =
+    Utilities::MPI::create_evenly_distributed_partitioning(MPI_COMM_WORLD,
+                                                           size);
+  IndexSet ghosted(owned);
+  if (owned.n_elements() > 0)
+    {
+      const types::global_dof_index begin = *owned.begin();
+      const types::global_dof_index end   = begin + owned.n_elements();
+      if (begin > 0)
+        ghosted.add_index(begin - 1);
+      if (end < size)
+        ghosted.add_index(end);
+    }
+
+  MyMatrix matrix;
+
+  DiagonalMatrix<LinearAlgebra::distributed::Vector<double>> jacobi;
+  jacobi.get_vector().reinit(owned, MPI_COMM_WORLD);
+  for (const auto i : owned)
+    jacobi.get_vector()(i) = 1. / (2. + 0.1 * (i % 7));
+
+  LinearAlgebra::distributed::Vector<double> rhs(owned,
+                                                 ghosted,
+                                                 MPI_COMM_WORLD);
+  LinearAlgebra::distributed::Vector<double> sol_cg(rhs), sol_pipelined(rhs);
+  for (const auto i : owned)
+    rhs(i) = 1. + 0.01 * i;
+
+  {
+    SolverControl control(500, 1e-12 * rhs.l2_norm(), false, false);
+    SolverCG<LinearAlgebra::distributed::Vector<double>> solver(control);
+    solver.solve(matrix, sol_cg, rhs, jacobi);
+    deallog << "SolverCG iterations: " << control.last_step() << std::endl;
+  }
+  {
+    SolverControl control(500, 1e-12 * rhs.l2_norm(), false, false);
+    SolverPipelinedCG<LinearAlgebra::distributed::Vector<double>> solver(
+      control);
+    solver.solve(matrix, sol_pipelined, rhs, jacobi);
+    deallog << "SolverPipelinedCG iterations: " << control.last_step()
+            << std::endl;
+  }
+
+  sol_pipelined -= sol_cg;
+  deallog << "Difference to SolverCG: "
+          << (sol_pipelined.linfty_norm() < 1e-6 * sol_cg.linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test(50);
+  test(211);
+}
@@ -0,0 +1,200 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test MGCoarseGridSparseDirect with a matrix computed by
+// MatrixFreeTools::compute_matrix() from the contributions of the locally
+// owned cells on each process, both with the solve on a single process and
+// with the redundant solve, and with vectors in double and float precision.
+
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <deal.II/multigrid/mg_coarse_sparse_direct.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <typename Number, int dim>
+void
+check_solve(const SparseMatrix<double>                       &matrix,
+            const IndexSet                                   &stored_rows,
+            const MatrixFree<dim, double>                    &matrix_free,
+            const LinearAlgebra::distributed::Vector<double> &rhs,
+            const LinearAlgebra::distributed::Vector<double> &reference,
+            const bool                                        redundant,
+            const double                                      tolerance)
+{
+  MGCoarseGridSparseDirect<Number> coarse_solver;
+  coarse_solver.initialize(
+    matrix,
+    stored_rows,
+    matrix_free.get_vector_partitioner(),
+    typename MGCoarseGridSparseDirect<Number>::AdditionalData(redundant));
+
+  LinearAlgebra::distributed::Vector<Number> src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  src.copy_locally_owned_data_from(rhs);
+
+  // apply twice to check that the factorization is reused
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      dst = 0.;
+      coarse_solver(0, dst, src);
+    }
+
+  LinearAlgebra::distributed::Vector<double> error;
+  error.reinit(reference);
+  error.copy_locally_owned_data_from(dst);
+  error -= reference;
+
+  deallog << (redundant ? "redundant" : "single process") << " solve with "
+          << (std::is_same_v<Number, double> ? "double" : "float")
+          << ", n=" << coarse_solver.m() << ": "
+          << (error.linfty_norm() < tolerance * reference.linfty_norm() ?
+                "ok" :
+                "wrong")
+          << std::endl;
+}
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  parallel::shared::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] < 0.3)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler);
+  AffineConstraints<double> constraints(dof_handler.locally_owned_dofs(),
+                                        locally_relevant_dofs);
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  VectorTools::interpolate_boundary_values(dof_handler,
+                                           0,
+                                           Functions::ZeroFunction<dim>(),
+                                           constraints);
+  constraints.close();
+
+  const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  matrix_free->reinit(MappingQ1<dim>(),
+                      dof_handler,
+                      constraints,
+                      QGauss<1>(fe_degree + 1),
+                      typename MatrixFree<dim, double>::AdditionalData());
+
+  // matrix of global size holding the contributions of the locally owned
+  // cells
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+  SparseMatrix<double> matrix(sparsity);
+  MatrixFreeTools::compute_matrix<dim,
+                                  fe_degree,
+                                  fe_degree + 1,
+                                  1,
+                                  double,
+                                  VectorizedArray<double>>(
+    *matrix_free,
+    constraints,
+    matrix,
+    [](FEEvaluation<dim, fe_degree, fe_degree + 1, 1, double> &phi) {
+      phi.evaluate(EvaluationFlags::gradients);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        phi.submit_gradient(phi.get_gradient(q), q);
+      phi.integrate(EvaluationFlags::gradients);
+    });
+
+  // right hand side from a reference solution that is zero on the
+  // constrained entries
+  MatrixFreeOperators::LaplaceOperator<dim, fe_degree> laplace;
+  laplace.initialize(matrix_free);
+  LinearAlgebra::distributed::Vector<double> reference, rhs;
+  laplace.initialize_dof_vector(reference);
+  laplace.initialize_dof_vector(rhs);
+  for (unsigned int i = 0; i < reference.locally_owned_size(); ++i)
+    {
+      const types::global_dof_index index =
+        reference.get_partitioner()->local_to_global(i);
+      if (!constraints.is_constrained(index))
+        reference.local_element(i) = std::sin(0.1 * index) + 1.;
+    }
+  laplace.vmult(rhs, reference);
+
+  deallog << "Testing " << fe.get_name() << std::endl;
+  for (const bool redundant : {false, true})
+    {
+      check_solve<double>(matrix,
+                          locally_relevant_dofs,
+                          *matrix_free,
+                          rhs,
+                          reference,
+                          redundant,
+                          1e-10);
+      check_solve<float>(matrix,
+                         locally_relevant_dofs,
+                         *matrix_free,
+                         rhs,
+                         reference,
+                         redundant,
+                         1e-4);
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_init(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2, 2>();
+  test<3, 1>();
+}
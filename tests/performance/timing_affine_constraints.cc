@@ -0,0 +1,129 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A benchmark for AffineConstraints::close() and
+// AffineConstraints::distribute() with the hanging node constraints of a Q2
+// element on a 3d mesh that is refined adaptively twice, resulting in a large
+// number of constraints. Both functions are timed with a single thread and
+// with all available threads to show the parallel speedup. The computation
+// of the constraints is not timed.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr unsigned int dim = 3;
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"close_single_thread",
+           "close",
+           "distribute_single_thread",
+           "distribute"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(3);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(4);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(5);
+        break;
+    }
+  for (unsigned int cycle = 0; cycle < 2; ++cycle)
+    {
+      for (const auto &cell : triangulation.active_cell_iterators())
+        if (cell->active_cell_index() % 3 == 0)
+          cell->set_refine_flag();
+      triangulation.execute_coarsening_and_refinement();
+    }
+
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(FE_Q<dim>(2));
+
+  AffineConstraints<double> constraints_single_thread;
+  DoFTools::make_hanging_node_constraints(dof_handler,
+                                          constraints_single_thread);
+  AffineConstraints<double> constraints;
+  constraints.copy_from(constraints_single_thread);
+
+  Vector<double> vector(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < vector.size(); ++i)
+    vector(i) = 1. + 0.001 * (i % 1000);
+
+  constexpr unsigned int n_repetitions = 20;
+
+  Timer timer;
+  MultithreadInfo::set_thread_limit(1);
+  constraints_single_thread.close();
+  const double time_close_single_thread = timer.wall_time();
+
+  timer.restart();
+  MultithreadInfo::set_thread_limit();
+  constraints.close();
+  const double time_close = timer.wall_time();
+
+  timer.restart();
+  MultithreadInfo::set_thread_limit(1);
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    constraints_single_thread.distribute(vector);
+  const double time_distribute_single_thread = timer.wall_time();
+
+  timer.restart();
+  MultithreadInfo::set_thread_limit();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    constraints.distribute(vector);
+  const double time_distribute = timer.wall_time();
+
+  return {time_close_single_thread,
+          time_close,
+          time_distribute_single_thread,
+          time_distribute};
+}
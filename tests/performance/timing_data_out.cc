@@ -0,0 +1,121 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A benchmark for DataOut::build_patches() with a vector of a degree 4 DG
+// element in 3d and 4 subdivisions per cell. The patches are built once with
+// the data set attached directly, which is evaluated with sum factorization,
+// and once through a postprocessor that passes the values through, which
+// forces the evaluation with FEValues.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/data_postprocessor.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr unsigned int dim = 3;
+
+
+
+class Identity : public DataPostprocessorScalar<dim>
+{
+public:
+  Identity()
+    : DataPostprocessorScalar<dim>("reference", update_values)
+  {}
+
+  virtual void
+  evaluate_scalar_field(
+    const DataPostprocessorInputs::Scalar<dim> &inputs,
+    std::vector<Vector<double>> &computed_quantities) const override
+  {
+    for (unsigned int q = 0; q < inputs.solution_values.size(); ++q)
+      computed_quantities[q](0) = inputs.solution_values[q];
+  }
+};
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing, 2, {"build_patches_fe_values", "build_patches"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(3);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(4);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(5);
+        break;
+    }
+
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(FE_DGQ<dim>(4));
+
+  Vector<double> solution(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < solution.size(); ++i)
+    solution(i) = 1. + 0.001 * (i % 1000);
+
+  Timer timer;
+  {
+    const Identity identity;
+    DataOut<dim>   data_out;
+    data_out.attach_dof_handler(dof_handler);
+    data_out.add_data_vector(solution, identity);
+    data_out.build_patches(4);
+  }
+  const double time_fe_values = timer.wall_time();
+
+  timer.restart();
+  {
+    DataOut<dim> data_out;
+    data_out.attach_dof_handler(dof_handler);
+    data_out.add_data_vector(solution, "solution");
+    data_out.build_patches(4);
+  }
+  const double time_sum_factorization = timer.wall_time();
+
+  return {time_fe_values, time_sum_factorization};
+}
@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A benchmark for the enumeration of degrees of freedom: it measures
+// DoFHandler::distribute_dofs() for a Q2 element on an adaptively refined
+// mesh in 3d with a single thread and with all available threads, as well
+// as the subsequent DoFRenumbering::Cuthill_McKee().
+//
+// Status: experimental
+//
+
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr unsigned int dim = 3;
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          3,
+          {"distribute_dofs (1 thread)",
+           "distribute_dofs (all threads)",
+           "Cuthill_McKee"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(4);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(5);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(6);
+        break;
+    }
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center()[0] < 0.3)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+
+  const unsigned int n_threads = MultithreadInfo::n_threads();
+  MultithreadInfo::set_thread_limit(1);
+  Timer timer;
+  dof_handler.distribute_dofs(fe);
+  const double time_serial = timer.wall_time();
+
+  MultithreadInfo::set_thread_limit(n_threads);
+  timer.restart();
+  dof_handler.distribute_dofs(fe);
+  const double time_threaded = timer.wall_time();
+
+  timer.restart();
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+  const double time_renumbering = timer.wall_time();
+
+  return {time_serial, time_threaded, time_renumbering};
+}
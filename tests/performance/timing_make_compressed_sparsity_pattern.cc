@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A benchmark comparing the setup of a SparsityPattern through a
+// DynamicSparsityPattern with DoFTools::make_sparsity_pattern() to the
+// threaded DoFTools::make_compressed_sparsity_pattern() for a Q2 element on
+// an adaptively refined mesh in 3d with hanging node constraints.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr unsigned int dim = 3;
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing, 2, {"dynamic_sparsity_pattern", "compressed"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(3);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(4);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(5);
+        break;
+    }
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center()[0] < 0.3)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(FE_Q<dim>(2));
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  Timer timer;
+  {
+    DynamicSparsityPattern dsp(dof_handler.n_dofs());
+    DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+    SparsityPattern sparsity;
+    sparsity.copy_from(dsp);
+  }
+  const double time_dsp = timer.wall_time();
+
+  timer.restart();
+  {
+    SparsityPattern sparsity;
+    DoFTools::make_compressed_sparsity_pattern(dof_handler,
+                                               sparsity,
+                                               constraints,
+                                               false);
+  }
+  const double time_compressed = timer.wall_time();
+
+  return {time_dsp, time_compressed};
+}
@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A benchmark comparing the matrix-vector product of SparseMatrix with the
+// one of NodeBlockSparseMatrix for a vector-valued problem in 3d with
+// FESystem(FE_Q(2), 3), as used for linear elasticity. The setup is not
+// timed, only a fixed number of matrix-vector products.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/node_block_sparse_matrix.h>
+#include <deal.II/lac/node_block_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr unsigned int dim = 3;
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing, 2, {"vmult_csr", "vmult_bsr"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(3);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(4);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(5);
+        break;
+    }
+
+  const FESystem<dim> fe(FE_Q<dim>(2), dim);
+  DoFHandler<dim>     dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  const AffineConstraints<double> constraints;
+
+  SparsityPattern sparsity;
+  {
+    DynamicSparsityPattern dsp(dof_handler.n_dofs());
+    DoFTools::make_sparsity_pattern(dof_handler, dsp);
+    sparsity.copy_from(dsp);
+  }
+  NodeBlockSparsityPattern node_sparsity(dof_handler.n_dofs(),
+                                         dof_handler.n_dofs(),
+                                         dim);
+  DoFTools::make_sparsity_pattern(dof_handler, node_sparsity);
+  node_sparsity.compress();
+
+  SparseMatrix<double>               matrix(sparsity);
+  NodeBlockSparseMatrix<double, dim> node_matrix(node_sparsity);
+
+  FullMatrix<double> cell_matrix(fe.n_dofs_per_cell(), fe.n_dofs_per_cell());
+  for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+    for (unsigned int j = 0; j < fe.n_dofs_per_cell(); ++j)
+      cell_matrix(i, j) = (i == j) ? 1. : 0.01 * ((i + j) % 7);
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(dof_indices);
+      constraints.distribute_local_to_global(cell_matrix, dof_indices, matrix);
+      constraints.distribute_local_to_global(cell_matrix,
+                                             dof_indices,
+                                             node_matrix);
+    }
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = 1. + 0.001 * (i % 1000);
+
+  constexpr unsigned int n_repetitions = 100;
+
+  Timer timer;
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    matrix.vmult(dst, src);
+  const double time_csr = timer.wall_time();
+
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    node_matrix.vmult(dst, src);
+  const double time_bsr = timer.wall_time();
+
+  return {time_csr, time_bsr};
+}
@@ -0,0 +1,176 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A strong-scaling benchmark comparing SolverCG with SolverPipelinedCG for
+// a matrix-free Poisson problem with a point-Jacobi preconditioner. The
+// problem size is fixed by the testing environment and independent of the
+// number of MPI ranks, so running the benchmark with an increasing number
+// of ranks exposes the latency of the global reductions that the pipelined
+// variant hides behind the matrix-vector product. Besides the time for the
+// complete solves, the time per iteration is reported.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_pipelined_cg.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#define ENABLE_MPI
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+const unsigned int dim                   = 3;
+const unsigned int degree_finite_element = 2;
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+template <typename SolverType>
+std::pair<double, unsigned int>
+run_solver(
+  const MatrixFreeOperators::LaplaceOperator<dim, degree_finite_element>
+                                   &laplace_operator,
+  const DiagonalMatrix<VectorType> &preconditioner,
+  const VectorType                 &rhs,
+  VectorType                       &solution)
+{
+  // run a fixed number of iterations to make the comparison independent of
+  // small differences in the convergence history
+  IterationNumberControl control(200, 1e-20, false, false);
+  SolverType             solver(control);
+
+  solution = 0.;
+  Timer time;
+  solver.solve(laplace_operator, solution, rhs, preconditioner);
+  time.stop();
+
+  return {time.wall_time(), control.last_step()};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+#ifdef DEAL_II_WITH_P4EST
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+#else
+  Triangulation<dim> triangulation;
+#endif
+
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(4);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(5);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(6);
+        break;
+    }
+
+  const FE_Q<dim>     fe(degree_finite_element);
+  DoFHandler<dim>     dof_handler(triangulation);
+  const MappingQ1<dim> mapping;
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.reinit(dof_handler.locally_owned_dofs(),
+                     DoFTools::extract_locally_relevant_dofs(dof_handler));
+  VectorTools::interpolate_boundary_values(
+    mapping, dof_handler, 0, Functions::ZeroFunction<dim>(), constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme =
+    MatrixFree<dim, double>::AdditionalData::none;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  matrix_free->reinit(mapping,
+                      dof_handler,
+                      constraints,
+                      QGauss<1>(fe.degree + 1),
+                      additional_data);
+
+  MatrixFreeOperators::LaplaceOperator<dim, degree_finite_element>
+    laplace_operator;
+  laplace_operator.initialize(matrix_free);
+  laplace_operator.compute_diagonal();
+  const DiagonalMatrix<VectorType> &preconditioner =
+    *laplace_operator.get_matrix_diagonal_inverse();
+
+  VectorType solution, rhs;
+  laplace_operator.initialize_dof_vector(solution);
+  laplace_operator.initialize_dof_vector(rhs);
+  rhs = 1.;
+  constraints.set_zero(rhs);
+
+  const auto [time_cg, iterations_cg] =
+    run_solver<SolverCG<VectorType>>(laplace_operator,
+                                     preconditioner,
+                                     rhs,
+                                     solution);
+  const auto [time_pipelined, iterations_pipelined] =
+    run_solver<SolverPipelinedCG<VectorType>>(laplace_operator,
+                                              preconditioner,
+                                              rhs,
+                                              solution);
+
+  return {time_cg,
+          time_pipelined,
+          time_cg / iterations_cg,
+          time_pipelined / iterations_pipelined};
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"solve_cg",
+           "solve_pipelined_cg",
+           "iteration_cg",
+           "iteration_pipelined_cg"}};
+}
@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A benchmark for the refinement of large serial meshes: it measures
+// Triangulation::execute_coarsening_and_refinement() for a refinement of
+// every other cell and a subsequent coarsening of a mesh in 3d, once with a
+// single thread and once with all available threads.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr unsigned int dim = 3;
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          3,
+          {"refinement (1 thread)",
+           "refinement (all threads)",
+           "coarsening (1 thread)",
+           "coarsening (all threads)"}};
+}
+
+
+
+// refine every other cell of the triangulation and coarsen them again,
+// returning the time spent in each of the two steps
+std::pair<double, double>
+refine_and_coarsen(Triangulation<dim> &triangulation)
+{
+  unsigned int counter = 0;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (counter++ % 2 == 0)
+      cell->set_refine_flag();
+
+  Timer timer;
+  triangulation.execute_coarsening_and_refinement();
+  const double time_refinement = timer.wall_time();
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->level() == static_cast<int>(triangulation.n_levels()) - 1)
+      cell->set_coarsen_flag();
+
+  timer.restart();
+  triangulation.execute_coarsening_and_refinement();
+  const double time_coarsening = timer.wall_time();
+
+  return {time_refinement, time_coarsening};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 4;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 5;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 6;
+        break;
+    }
+
+  const unsigned int n_threads = MultithreadInfo::n_threads();
+
+  std::pair<double, double> times[2];
+  for (unsigned int run = 0; run < 2; ++run)
+    {
+      Triangulation<dim> triangulation;
+      GridGenerator::hyper_cube(triangulation);
+      triangulation.refine_global(n_refinements);
+
+      MultithreadInfo::set_thread_limit(run == 0 ? 1 : n_threads);
+      times[run] = refine_and_coarsen(triangulation);
+    }
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  return {times[0].first, times[1].first, times[0].second, times[1].second};
+}
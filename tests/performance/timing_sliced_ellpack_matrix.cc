@@ -0,0 +1,135 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A benchmark comparing the matrix-vector product of SparseMatrix with the
+// one of SlicedEllpackMatrix for a Laplace matrix on an adaptively refined
+// mesh in 3d with a mix of polynomial degrees, resulting in strongly varying
+// row lengths. The setup is not timed, only a fixed number of matrix-vector
+// products.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/matrix_creator.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr unsigned int dim = 3;
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing, 2, {"vmult_csr", "vmult_sell"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(3);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(4);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(5);
+        break;
+    }
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center()[0] < 0.3)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  hp::FECollection<dim> fe_collection;
+  hp::QCollection<dim>  q_collection;
+  for (unsigned int degree = 1; degree <= 3; ++degree)
+    {
+      fe_collection.push_back(FE_Q<dim>(degree));
+      q_collection.push_back(QGauss<dim>(degree + 1));
+    }
+
+  DoFHandler<dim> dof_handler(triangulation);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(cell->active_cell_index() % 3);
+  dof_handler.distribute_dofs(fe_collection);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double>       matrix(sparsity);
+  const Function<dim> *const coefficient = nullptr;
+  MatrixCreator::create_laplace_matrix(
+    dof_handler, q_collection, matrix, coefficient, constraints);
+
+  const SlicedEllpackMatrix<double> sell(matrix);
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = 1. + 0.001 * (i % 1000);
+
+  constexpr unsigned int n_repetitions = 100;
+
+  Timer timer;
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    matrix.vmult(dst, src);
+  const double time_csr = timer.wall_time();
+
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    sell.vmult(dst, src);
+  const double time_sell = timer.wall_time();
+
+  return {time_csr, time_sell};
+}
@@ -0,0 +1,124 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check SparsityTools::reorder_Cuthill_McKee() and
+// SparsityTools::reorder_nested_dissection() on the graph of a 9-point
+// stencil on a structured grid, with randomly permuted node numbers and
+// some additional disconnected nodes: the results must be permutations that
+// do not depend on the number of threads. Print the bandwidth and profile
+// of the original and the reordered sparsity patterns.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_tools.h>
+
+#include "../tests.h"
+
+
+DynamicSparsityPattern
+renumber(const DynamicSparsityPattern               &dsp,
+         const std::vector<types::global_dof_index> &new_indices)
+{
+  DynamicSparsityPattern result(dsp.n_rows(), dsp.n_cols());
+  for (types::global_dof_index row = 0; row < dsp.n_rows(); ++row)
+    for (auto entry = dsp.begin(row); entry != dsp.end(row); ++entry)
+      result.add(new_indices[row], new_indices[entry->column()]);
+  return result;
+}
+
+
+
+void
+print_statistics(const std::string                          &name,
+                 const DynamicSparsityPattern               &dsp,
+                 const std::vector<types::global_dof_index> &new_indices)
+{
+  std::vector<bool> found(new_indices.size(), false);
+  bool              is_permutation = true;
+  for (const auto index : new_indices)
+    if (index >= new_indices.size() || found[index])
+      is_permutation = false;
+    else
+      found[index] = true;
+
+  const DynamicSparsityPattern renumbered = renumber(dsp, new_indices);
+  deallog << name << ": permutation " << (is_permutation ? "ok" : "wrong")
+          << ", bandwidth " << renumbered.bandwidth() << ", profile "
+          << SparsityTools::compute_profile(renumbered) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  // a 9-point stencil on a grid of n x n nodes, and a few isolated nodes
+  // at the end
+  const unsigned int n          = 400;
+  const unsigned int n_isolated = 10;
+  const unsigned int n_nodes    = n * n + n_isolated;
+
+  // number the nodes randomly
+  std::vector<types::global_dof_index> random_numbers(n_nodes);
+  std::iota(random_numbers.begin(), random_numbers.end(), 0);
+  for (unsigned int i = n_nodes - 1; i > 0; --i)
+    std::swap(random_numbers[i], random_numbers[Testing::rand() % (i + 1)]);
+
+  DynamicSparsityPattern dsp(n_nodes, n_nodes);
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int j = 0; j < n; ++j)
+      for (int di = -1; di <= 1; ++di)
+        for (int dj = -1; dj <= 1; ++dj)
+          if (i + di < n && j + dj < n)
+            dsp.add(random_numbers[i * n + j],
+                    random_numbers[(i + di) * n + j + dj]);
+  for (unsigned int i = n * n; i < n_nodes; ++i)
+    dsp.add(random_numbers[i], random_numbers[i]);
+
+  std::vector<types::global_dof_index> identity(n_nodes);
+  std::iota(identity.begin(), identity.end(), 0);
+  print_statistics("original", dsp, identity);
+
+  const unsigned int n_threads = std::max(2U, testing_max_num_threads());
+
+  std::vector<types::global_dof_index> serial(n_nodes), threaded(n_nodes);
+  MultithreadInfo::set_thread_limit(1);
+  SparsityTools::reorder_Cuthill_McKee(dsp, serial);
+  MultithreadInfo::set_thread_limit(n_threads);
+  SparsityTools::reorder_Cuthill_McKee(dsp, threaded);
+  deallog << "Cuthill-McKee independent of threads: "
+          << (serial == threaded ? "ok" : "wrong") << std::endl;
+  print_statistics("Cuthill-McKee", dsp, serial);
+  print_statistics("reverse Cuthill-McKee",
+                   dsp,
+                   Utilities::reverse_permutation(serial));
+
+  for (const unsigned int block_size : {64U, 1024U})
+    {
+      MultithreadInfo::set_thread_limit(1);
+      SparsityTools::reorder_nested_dissection(dsp, serial, block_size);
+      MultithreadInfo::set_thread_limit(n_threads);
+      SparsityTools::reorder_nested_dissection(dsp, threaded, block_size);
+      deallog << "nested dissection (" << block_size
+              << ") independent of threads: "
+              << (serial == threaded ? "ok" : "wrong") << std::endl;
+      print_statistics("nested dissection (" + std::to_string(block_size) +
+                         ")",
+                       dsp,
+                       serial);
+    }
+}